@@ -0,0 +1,269 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniAttributeInfoCache.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineRuntime.h"
+
+#include "Misc/ScopeLock.h"
+
+TMap<int64, FHoudiniAttributeInfoCache::FNodeCache> FHoudiniAttributeInfoCache::CachedNodes;
+FCriticalSection FHoudiniAttributeInfoCache::CacheLock;
+
+void
+FHoudiniAttributeInfoCache::ValidateCookCount(const HAPI_NodeId& InAssetId, const HAPI_NodeId& InGeoId, const int32& InCookCount)
+{
+	if (InGeoId < 0 || InCookCount < 0)
+		return;
+
+	FScopeLock ScopeLock(&CacheLock);
+
+	FNodeCache& NodeCache = CachedNodes.FindOrAdd(GetNodeKey(InGeoId));
+	if (NodeCache.CookCount != InCookCount)
+	{
+		// The node has cooked, its data is stale
+		NodeCache.Parts.Empty();
+		NodeCache.CookCount = InCookCount;
+	}
+
+	NodeCache.SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	NodeCache.AssetId = InAssetId;
+}
+
+void
+FHoudiniAttributeInfoCache::InvalidateNode(const HAPI_NodeId& InNodeId)
+{
+	if (InNodeId < 0)
+		return;
+
+	FScopeLock ScopeLock(&CacheLock);
+
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	CachedNodes.Remove(GetNodeKey(InNodeId));
+	for (auto Iter = CachedNodes.CreateIterator(); Iter; ++Iter)
+	{
+		if (Iter.Value().AssetId == InNodeId && Iter.Value().SessionIndex == SessionIndex)
+			Iter.RemoveCurrent();
+	}
+}
+
+void
+FHoudiniAttributeInfoCache::Clear(const int32& InSessionIndex)
+{
+	FScopeLock ScopeLock(&CacheLock);
+	if (InSessionIndex < 0)
+	{
+		CachedNodes.Empty();
+		return;
+	}
+
+	for (auto Iter = CachedNodes.CreateIterator(); Iter; ++Iter)
+	{
+		if ((int32)(Iter.Key() >> 32) == InSessionIndex)
+			Iter.RemoveCurrent();
+	}
+}
+
+int64
+FHoudiniAttributeInfoCache::GetNodeKey(const HAPI_NodeId& InNodeId)
+{
+	return ((int64)FHoudiniEngineRuntime::GetCurrentSessionIndex() << 32) | (uint32)InNodeId;
+}
+
+bool
+FHoudiniAttributeInfoCache::ResolvePartNames(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, FPartCache& OutPartCache)
+{
+	// Get the attribute counts for this part
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
+		FHoudiniEngine::Get().GetSession(), InGeoId, InPartId, &PartInfo))
+		return false;
+
+	// Get the name handles for all owners and resolve them in one batch
+	TArray<HAPI_StringHandle> AllNameSH;
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+	{
+		const int32 Count = PartInfo.attributeCounts[OwnerIdx];
+		if (Count <= 0)
+			continue;
+
+		const int32 Offset = AllNameSH.Num();
+		AllNameSH.SetNum(Offset + Count);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeNames(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoId, InPartId, (HAPI_AttributeOwner)OwnerIdx,
+			AllNameSH.GetData() + Offset, Count))
+			return false;
+	}
+
+	TArray<FString> AllNames;
+	if (AllNameSH.Num() > 0 && !FHoudiniEngineString::SHArrayToFStringArray(AllNameSH, AllNames))
+		return false;
+
+	int32 NameIdx = 0;
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+	{
+		const int32 Count = FMath::Max(PartInfo.attributeCounts[OwnerIdx], 0);
+		for (int32 Idx = 0; Idx < Count && AllNames.IsValidIndex(NameIdx); Idx++, NameIdx++)
+			OutPartCache.Names[OwnerIdx].Add(AllNames[NameIdx]);
+	}
+
+	OutPartCache.bNamesResolved = true;
+	return true;
+}
+
+bool
+FHoudiniAttributeInfoCache::FindAttributeOwner(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const FString& InAttribName,
+	const HAPI_AttributeOwner& InOwner,
+	HAPI_AttributeOwner& OutOwner,
+	int32& OutCookCount)
+{
+	const int64 NodeKey = GetNodeKey(InGeoId);
+	{
+		FScopeLock ScopeLock(&CacheLock);
+
+		const FNodeCache* NodeCache = CachedNodes.Find(NodeKey);
+		if (!NodeCache)
+			return false;
+
+		OutCookCount = NodeCache->CookCount;
+		const FPartCache* PartCache = NodeCache->Parts.Find(InPartId);
+		if (PartCache && PartCache->bNamesResolved)
+		{
+			OutOwner = FindOwner(*PartCache, InAttribName, InOwner);
+			return true;
+		}
+	}
+
+	// Resolve the names without holding the lock, so other threads' lookups don't wait on HAPI
+	FPartCache NewPartCache;
+	if (!ResolvePartNames(InGeoId, InPartId, NewPartCache))
+		return false;
+
+	OutOwner = FindOwner(NewPartCache, InAttribName, InOwner);
+
+	// Only keep the names if the node hasn't cooked or been invalidated in the meantime
+	FScopeLock ScopeLock(&CacheLock);
+	FNodeCache* NodeCache = CachedNodes.Find(NodeKey);
+	if (NodeCache && NodeCache->CookCount == OutCookCount)
+	{
+		FPartCache& PartCache = NodeCache->Parts.FindOrAdd(InPartId);
+		if (!PartCache.bNamesResolved)
+			PartCache = MoveTemp(NewPartCache);
+	}
+
+	return true;
+}
+
+HAPI_AttributeOwner
+FHoudiniAttributeInfoCache::FindOwner(const FPartCache& InPartCache, const FString& InAttribName, const HAPI_AttributeOwner& InOwner)
+{
+	if (InOwner != HAPI_ATTROWNER_INVALID)
+		return InPartCache.Names[InOwner].Contains(InAttribName) ? InOwner : HAPI_ATTROWNER_INVALID;
+
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+	{
+		if (InPartCache.Names[OwnerIdx].Contains(InAttribName))
+			return (HAPI_AttributeOwner)OwnerIdx;
+	}
+
+	return HAPI_ATTROWNER_INVALID;
+}
+
+bool
+FHoudiniAttributeInfoCache::GetAttributeInfo(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char* InAttribName,
+	const HAPI_AttributeOwner& InOwner,
+	HAPI_AttributeInfo& OutAttributeInfo)
+{
+	const FString AttribName = UTF8_TO_TCHAR(InAttribName);
+	HAPI_AttributeOwner FoundOwner = HAPI_ATTROWNER_INVALID;
+	int32 CookCount = -1;
+	if (!FindAttributeOwner(InGeoId, InPartId, AttribName, InOwner, FoundOwner, CookCount))
+		return false;
+
+	FHoudiniApi::AttributeInfo_Init(&OutAttributeInfo);
+	OutAttributeInfo.exists = false;
+	if (FoundOwner == HAPI_ATTROWNER_INVALID)
+		return true;
+
+	const int64 NodeKey = GetNodeKey(InGeoId);
+	{
+		FScopeLock ScopeLock(&CacheLock);
+
+		const FNodeCache* NodeCache = CachedNodes.Find(NodeKey);
+		const FPartCache* PartCache = NodeCache ? NodeCache->Parts.Find(InPartId) : nullptr;
+		const HAPI_AttributeInfo* FoundInfo = PartCache ? PartCache->Infos[FoundOwner].Find(AttribName) : nullptr;
+		if (FoundInfo)
+		{
+			OutAttributeInfo = *FoundInfo;
+			return true;
+		}
+	}
+
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInfo(
+		FHoudiniEngine::Get().GetSession(),
+		InGeoId, InPartId, InAttribName,
+		FoundOwner, &OutAttributeInfo))
+		return false;
+
+	FScopeLock ScopeLock(&CacheLock);
+	FNodeCache* NodeCache = CachedNodes.Find(NodeKey);
+	FPartCache* PartCache = (NodeCache && NodeCache->CookCount == CookCount) ? NodeCache->Parts.Find(InPartId) : nullptr;
+	if (PartCache)
+		PartCache->Infos[FoundOwner].Add(AttribName, OutAttributeInfo);
+
+	return true;
+}
+
+bool
+FHoudiniAttributeInfoCache::HasAttribute(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char* InAttribName,
+	const HAPI_AttributeOwner& InOwner,
+	bool& bOutExists)
+{
+	HAPI_AttributeOwner FoundOwner = HAPI_ATTROWNER_INVALID;
+	int32 CookCount = -1;
+	if (!FindAttributeOwner(InGeoId, InPartId, UTF8_TO_TCHAR(InAttribName), InOwner, FoundOwner, CookCount))
+		return false;
+
+	bOutExists = FoundOwner != HAPI_ATTROWNER_INVALID;
+	return true;
+}
@@ -0,0 +1,133 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/Crc.h"
+
+// Houdini attribute names are case sensitive, unlike FString's default hashing and comparison
+struct FHoudiniAttributeNameKeyFuncs : BaseKeyFuncs<FString, FString, false>
+{
+	static FORCEINLINE const FString& GetSetKey(const FString& Element) { return Element; }
+	static FORCEINLINE bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+	static FORCEINLINE uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+};
+
+template<typename ValueType>
+struct THoudiniAttributeNameMapKeyFuncs : TDefaultMapKeyFuncs<FString, ValueType, false>
+{
+	static FORCEINLINE bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+	static FORCEINLINE uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+};
+
+// Cook-scoped cache of attribute names and HAPI_AttributeInfos, keyed by (geo, part, name, owner).
+// Only geo nodes whose cook count has been registered via ValidateCookCount() are cached,
+// and their data is dropped as soon as they, or the asset owning them, cook again.
+// This turns most "does this attribute exist" queries into hash lookups.
+struct HOUDINIENGINE_API FHoudiniAttributeInfoCache
+{
+	public:
+
+		// Registers the current cook count of a geo node of the given asset.
+		// If the node cooked since it was last registered, its cached data is discarded.
+		static void ValidateCookCount(const HAPI_NodeId& InAssetId, const HAPI_NodeId& InGeoId, const int32& InCookCount);
+
+		// Discards the cached data of a node, and of all the geo nodes registered for it if it is an asset.
+		static void InvalidateNode(const HAPI_NodeId& InNodeId);
+
+		// Discards all the cached data of a session (ie. when the session changes).
+		// A negative session index clears all the sessions.
+		static void Clear(const int32& InSessionIndex = -1);
+
+		// Gets the attribute info for the given attribute and owner.
+		// If InOwner is invalid, the owners are checked in the same order as the HapiGetAttributeDataAsXXX functions.
+		// Returns false if the geo node isn't cached, in which case HAPI must be queried directly.
+		static bool GetAttributeInfo(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const char* InAttribName,
+			const HAPI_AttributeOwner& InOwner,
+			HAPI_AttributeInfo& OutAttributeInfo);
+
+		// Indicates if the attribute exists on the part.
+		// Returns false if the geo node isn't cached, in which case HAPI must be queried directly.
+		static bool HasAttribute(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const char* InAttribName,
+			const HAPI_AttributeOwner& InOwner,
+			bool& bOutExists);
+
+	protected:
+
+		struct FPartCache
+		{
+			bool bNamesResolved = false;
+
+			// Attribute names and infos per owner
+			TSet<FString, FHoudiniAttributeNameKeyFuncs> Names[HAPI_ATTROWNER_MAX];
+			TMap<FString, HAPI_AttributeInfo, FDefaultSetAllocator, THoudiniAttributeNameMapKeyFuncs<HAPI_AttributeInfo>> Infos[HAPI_ATTROWNER_MAX];
+		};
+
+		struct FNodeCache
+		{
+			int32 SessionIndex = 0;
+			HAPI_NodeId AssetId = -1;
+			int32 CookCount = -1;
+			TMap<HAPI_PartId, FPartCache> Parts;
+		};
+
+		// Finds the owner holding the attribute, resolving and caching the part's attribute names if needed.
+		// Returns false if the node isn't cached. OutCookCount is the node's registered cook count.
+		// HAPI is only called while CacheLock isn't held.
+		static bool FindAttributeOwner(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const FString& InAttribName,
+			const HAPI_AttributeOwner& InOwner,
+			HAPI_AttributeOwner& OutOwner,
+			int32& OutCookCount);
+
+		// Gets the names of all the part's attributes from HAPI.
+		static bool ResolvePartNames(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, FPartCache& OutPartCache);
+
+		// Node ids are only unique within a session, combine them with the current session index
+		static int64 GetNodeKey(const HAPI_NodeId& InNodeId);
+
+		// Finds the owner holding the attribute in the part's resolved names.
+		static HAPI_AttributeOwner FindOwner(const FPartCache& InPartCache, const FString& InAttribName, const HAPI_AttributeOwner& InOwner);
+
+	protected:
+
+		static TMap<int64, FNodeCache> CachedNodes;
+
+		static FCriticalSection CacheLock;
+};
@@ -0,0 +1,322 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniAttributeRequestSet.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniGeoPartObject.h"
+
+FThreadSafeCounter FHoudiniAttributeRequestSet::CookRoundTripsSaved;
+
+FHoudiniAttributeRequestSet::FHoudiniAttributeRequestSet()
+	: GeoId(-1)
+	, PartId(-1)
+	, bNamesResolved(false)
+	, bFetched(false)
+{
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+		AttributeCounts[OwnerIdx] = 0;
+}
+
+void
+FHoudiniAttributeRequestSet::Reset(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const FHoudiniPartInfo& InPartInfo)
+{
+	GeoId = InGeoId;
+	PartId = InPartId;
+
+	AttributeCounts[HAPI_ATTROWNER_VERTEX] = InPartInfo.VertexAttributeCounts;
+	AttributeCounts[HAPI_ATTROWNER_POINT] = InPartInfo.PointAttributeCounts;
+	AttributeCounts[HAPI_ATTROWNER_PRIM] = InPartInfo.PrimitiveAttributeCounts;
+	AttributeCounts[HAPI_ATTROWNER_DETAIL] = InPartInfo.DetailAttributeCounts;
+
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+		AttributeNames[OwnerIdx].Empty();
+
+	Requests.Empty();
+
+	bNamesResolved = false;
+	bFetched = false;
+}
+
+void
+FHoudiniAttributeRequestSet::AddFloatRequest(const char* InAttribName, const int32& InTupleSize, const HAPI_AttributeOwner& InOwner)
+{
+	AddRequest(InAttribName, true, InTupleSize, InOwner);
+}
+
+void
+FHoudiniAttributeRequestSet::AddIntegerRequest(const char* InAttribName, const int32& InTupleSize, const HAPI_AttributeOwner& InOwner)
+{
+	AddRequest(InAttribName, false, InTupleSize, InOwner);
+}
+
+void
+FHoudiniAttributeRequestSet::AddRequest(const char* InAttribName, const bool& bIsFloat, const int32& InTupleSize, const HAPI_AttributeOwner& InOwner)
+{
+	if (FindRequest(InAttribName))
+		return;
+
+	FAttributeRequest& NewRequest = Requests.AddDefaulted_GetRef();
+	NewRequest.Name = UTF8_TO_TCHAR(InAttribName);
+	NewRequest.bIsFloat = bIsFloat;
+	NewRequest.TupleSize = InTupleSize;
+	NewRequest.Owner = InOwner;
+	FHoudiniApi::AttributeInfo_Init(&NewRequest.AttributeInfo);
+
+	// New requests will have to be fetched
+	bFetched = false;
+}
+
+FHoudiniAttributeRequestSet::FAttributeRequest*
+FHoudiniAttributeRequestSet::FindRequest(const char* InAttribName)
+{
+	const FString AttribName = UTF8_TO_TCHAR(InAttribName);
+	return Requests.FindByPredicate([&AttribName](const FAttributeRequest& Request) { return Request.Name.Equals(AttribName, ESearchCase::CaseSensitive); });
+}
+
+const FHoudiniAttributeRequestSet::FAttributeRequest*
+FHoudiniAttributeRequestSet::FindRequest(const char* InAttribName) const
+{
+	const FString AttribName = UTF8_TO_TCHAR(InAttribName);
+	return Requests.FindByPredicate([&AttribName](const FAttributeRequest& Request) { return Request.Name.Equals(AttribName, ESearchCase::CaseSensitive); });
+}
+
+bool
+FHoudiniAttributeRequestSet::ResolveAttributeNames()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniAttributeRequestSet::ResolveAttributeNames"));
+
+	if (bNamesResolved)
+		return true;
+
+	// Get the name handles for all owners, then resolve them all at once
+	TArray<HAPI_StringHandle> AllNameSH;
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+	{
+		const int32 Count = AttributeCounts[OwnerIdx];
+		if (Count <= 0)
+			continue;
+
+		const int32 Offset = AllNameSH.Num();
+		AllNameSH.SetNum(Offset + Count);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeNames(
+			FHoudiniEngine::Get().GetSession(),
+			GeoId, PartId, (HAPI_AttributeOwner)OwnerIdx,
+			AllNameSH.GetData() + Offset, Count), false);
+	}
+
+	TArray<FString> AllNames;
+	if (AllNameSH.Num() > 0)
+	{
+		if (!FHoudiniEngineString::SHArrayToFStringArray(AllNameSH, AllNames))
+			return false;
+	}
+
+	int32 NameIdx = 0;
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+	{
+		const int32 Count = FMath::Max(AttributeCounts[OwnerIdx], 0);
+		for (int32 Idx = 0; Idx < Count && AllNames.IsValidIndex(NameIdx); Idx++, NameIdx++)
+			AttributeNames[OwnerIdx].Add(AllNames[NameIdx]);
+	}
+
+	bNamesResolved = true;
+	return true;
+}
+
+bool
+FHoudiniAttributeRequestSet::HasAttribute(const char* InAttribName, const HAPI_AttributeOwner& InOwner) const
+{
+	if (!bNamesResolved)
+		return false;
+
+	const FString AttribName = UTF8_TO_TCHAR(InAttribName);
+	if (InOwner != HAPI_ATTROWNER_INVALID)
+		return AttributeNames[InOwner].Contains(AttribName);
+
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+	{
+		if (AttributeNames[OwnerIdx].Contains(AttribName))
+			return true;
+	}
+
+	return false;
+}
+
+bool
+FHoudiniAttributeRequestSet::Fetch()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniAttributeRequestSet::Fetch"));
+
+	if (bFetched)
+		return true;
+
+	if (!ResolveAttributeNames())
+		return false;
+
+	for (FAttributeRequest& CurrentRequest : Requests)
+		FetchRequest(CurrentRequest);
+
+	bFetched = true;
+	return true;
+}
+
+bool
+FHoudiniAttributeRequestSet::FetchRequest(FAttributeRequest& InRequest)
+{
+	FHoudiniApi::AttributeInfo_Init(&InRequest.AttributeInfo);
+	InRequest.AttributeInfo.exists = false;
+	InRequest.bSuccess = false;
+	InRequest.FloatData.Empty();
+	InRequest.IntData.Empty();
+
+	// Find the attribute's owner, using the same priority as HapiGetAttributeDataAsFloat
+	// Without the name lists, this would have cost one GetAttributeInfo call per owner checked
+	HAPI_AttributeOwner FoundOwner = HAPI_ATTROWNER_INVALID;
+	int32 ProbeCalls = 0;
+	if (InRequest.Owner != HAPI_ATTROWNER_INVALID)
+	{
+		ProbeCalls = 1;
+		if (AttributeNames[InRequest.Owner].Contains(InRequest.Name))
+			FoundOwner = InRequest.Owner;
+	}
+	else
+	{
+		for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+		{
+			ProbeCalls++;
+			if (AttributeNames[OwnerIdx].Contains(InRequest.Name))
+			{
+				FoundOwner = (HAPI_AttributeOwner)OwnerIdx;
+				break;
+			}
+		}
+	}
+
+	// The attribute doesn't exist, no need to call HAPI at all
+	if (FoundOwner == HAPI_ATTROWNER_INVALID)
+	{
+		CookRoundTripsSaved.Add(ProbeCalls);
+		return false;
+	}
+
+	// We still need the attribute info for the found owner
+	CookRoundTripsSaved.Add(ProbeCalls - 1);
+
+	const std::string AttribName = TCHAR_TO_UTF8(*InRequest.Name);
+	HAPI_AttributeInfo AttributeInfo;
+	if (!FHoudiniEngineUtils::HapiGetAttributeInfo(GeoId, PartId, AttribName.c_str(), FoundOwner, AttributeInfo))
+		return false;
+
+	if (!AttributeInfo.exists)
+		return false;
+
+	const HAPI_StorageType ExpectedStorage = InRequest.bIsFloat ? HAPI_STORAGETYPE_FLOAT : HAPI_STORAGETYPE_INT;
+	if (AttributeInfo.storage != ExpectedStorage)
+	{
+		// Let the utils handle the conversion from other storage types
+		if (InRequest.bIsFloat)
+		{
+			InRequest.bSuccess = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+				GeoId, PartId, AttribName.c_str(),
+				InRequest.AttributeInfo, InRequest.FloatData,
+				InRequest.TupleSize, FoundOwner);
+		}
+		else
+		{
+			InRequest.bSuccess = FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+				GeoId, PartId, AttribName.c_str(),
+				InRequest.AttributeInfo, InRequest.IntData,
+				InRequest.TupleSize, FoundOwner);
+		}
+
+		return InRequest.bSuccess;
+	}
+
+	if (InRequest.TupleSize > 0)
+		AttributeInfo.tupleSize = InRequest.TupleSize;
+
+	// Store the retrieved attribute information.
+	InRequest.AttributeInfo = AttributeInfo;
+
+	const int32 Count = AttributeInfo.count;
+	if (InRequest.bIsFloat)
+	{
+		InRequest.FloatData.SetNum(Count * AttributeInfo.tupleSize);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(),
+			GeoId, PartId, AttribName.c_str(),
+			&AttributeInfo, -1, InRequest.FloatData.GetData(),
+			0, Count), false);
+	}
+	else
+	{
+		InRequest.IntData.SetNum(Count * AttributeInfo.tupleSize);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeIntData(
+			FHoudiniEngine::Get().GetSession(),
+			GeoId, PartId, AttribName.c_str(),
+			&AttributeInfo, -1, InRequest.IntData.GetData(),
+			0, Count), false);
+	}
+
+	InRequest.bSuccess = true;
+	return true;
+}
+
+bool
+FHoudiniAttributeRequestSet::HasFetched(const char* InAttribName) const
+{
+	return bFetched && FindRequest(InAttribName) != nullptr;
+}
+
+bool
+FHoudiniAttributeRequestSet::MoveFloatData(const char* InAttribName, HAPI_AttributeInfo& OutAttributeInfo, TArray<float>& OutData)
+{
+	FAttributeRequest* FoundRequest = bFetched ? FindRequest(InAttribName) : nullptr;
+	if (!FoundRequest || !FoundRequest->bIsFloat)
+		return false;
+
+	OutAttributeInfo = FoundRequest->AttributeInfo;
+	OutData = MoveTemp(FoundRequest->FloatData);
+	return FoundRequest->bSuccess;
+}
+
+bool
+FHoudiniAttributeRequestSet::MoveIntegerData(const char* InAttribName, HAPI_AttributeInfo& OutAttributeInfo, TArray<int32>& OutData)
+{
+	FAttributeRequest* FoundRequest = bFetched ? FindRequest(InAttribName) : nullptr;
+	if (!FoundRequest || FoundRequest->bIsFloat)
+		return false;
+
+	OutAttributeInfo = FoundRequest->AttributeInfo;
+	OutData = MoveTemp(FoundRequest->IntData);
+	return FoundRequest->bSuccess;
+}
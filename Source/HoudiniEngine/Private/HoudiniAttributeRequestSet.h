@@ -0,0 +1,128 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "HoudiniAttributeInfoCache.h"
+
+#include "HAPI/HAPI_Common.h"
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeCounter.h"
+
+struct FHoudiniPartInfo;
+
+// Fetches a set of attributes for a single part in one pass.
+// Instead of probing every attribute owner with GetAttributeInfo for each attribute,
+// the part's attribute names are listed once per owner, all requests are resolved
+// against those lists, and only the attributes that actually exist are fetched.
+struct HOUDINIENGINE_API FHoudiniAttributeRequestSet
+{
+	public:
+
+		FHoudiniAttributeRequestSet();
+
+		// Clears all requests and targets a new part.
+		void Reset(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, const FHoudiniPartInfo& InPartInfo);
+
+		// Adds a float attribute to fetch. Tuple size and owner behave like in HapiGetAttributeDataAsFloat.
+		void AddFloatRequest(
+			const char* InAttribName,
+			const int32& InTupleSize = 0,
+			const HAPI_AttributeOwner& InOwner = HAPI_ATTROWNER_INVALID);
+
+		// Adds an integer attribute to fetch. Tuple size and owner behave like in HapiGetAttributeDataAsInteger.
+		void AddIntegerRequest(
+			const char* InAttribName,
+			const int32& InTupleSize = 0,
+			const HAPI_AttributeOwner& InOwner = HAPI_ATTROWNER_INVALID);
+
+		// Lists the names of all the attributes on the part.
+		// Called by Fetch() if needed, can be called earlier to use HasAttribute() before adding requests.
+		bool ResolveAttributeNames();
+
+		// Resolves the attribute infos of all requests and fetches their data.
+		bool Fetch();
+
+		// Indicates if the part has an attribute with that name (any owner if InOwner is invalid).
+		// Only valid after ResolveAttributeNames().
+		bool HasAttribute(const char* InAttribName, const HAPI_AttributeOwner& InOwner = HAPI_ATTROWNER_INVALID) const;
+
+		// Indicates if the given attribute was requested and fetched.
+		bool HasFetched(const char* InAttribName) const;
+
+		// Moves the fetched data of a request to the output arrays.
+		// Returns the same value HapiGetAttributeDataAsFloat/Integer would have returned for that attribute.
+		bool MoveFloatData(const char* InAttribName, HAPI_AttributeInfo& OutAttributeInfo, TArray<float>& OutData);
+		bool MoveIntegerData(const char* InAttribName, HAPI_AttributeInfo& OutAttributeInfo, TArray<int32>& OutData);
+
+		// Number of GetAttributeInfo calls the fetched requests avoided since the last reset of the cook stats.
+		static int32 GetCookRoundTripsSaved() { return CookRoundTripsSaved.GetValue(); };
+		static void ResetCookStats() { CookRoundTripsSaved.Reset(); };
+
+	protected:
+
+		struct FAttributeRequest
+		{
+			FString Name;
+			bool bIsFloat = true;
+			int32 TupleSize = 0;
+			HAPI_AttributeOwner Owner = HAPI_ATTROWNER_INVALID;
+
+			HAPI_AttributeInfo AttributeInfo;
+			bool bSuccess = false;
+
+			TArray<float> FloatData;
+			TArray<int32> IntData;
+		};
+
+		void AddRequest(const char* InAttribName, const bool& bIsFloat, const int32& InTupleSize, const HAPI_AttributeOwner& InOwner);
+
+		FAttributeRequest* FindRequest(const char* InAttribName);
+		const FAttributeRequest* FindRequest(const char* InAttribName) const;
+
+		bool FetchRequest(FAttributeRequest& InRequest);
+
+	protected:
+
+		HAPI_NodeId GeoId;
+		HAPI_PartId PartId;
+
+		// Number of attributes per owner, from the part info
+		int32 AttributeCounts[HAPI_ATTROWNER_MAX];
+
+		// Names of the part's attributes, per owner (case-sensitive, like Houdini attribute names)
+		TSet<FString, FHoudiniAttributeNameKeyFuncs> AttributeNames[HAPI_ATTROWNER_MAX];
+
+		TArray<FAttributeRequest> Requests;
+
+		bool bNamesResolved;
+		bool bFetched;
+
+		// Number of HAPI calls saved by all request sets during the current cook
+		static FThreadSafeCounter CookRoundTripsSaved;
+};
@@ -30,12 +30,17 @@
 #include "HoudiniApi.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineRuntimeUtils.h"
+#include "HoudiniAttributeInfoCache.h"
+#include "HoudiniInputGeometryCache.h"
+#include "HoudiniObjectResolutionCache.h"
+#include "HoudiniEngineString.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEngineScheduler.h"
 #include "HoudiniEngineManager.h"
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniEngineRuntime.h"
 #include "HAPI/HAPI_Version.h"
 
 #include "Modules/ModuleManager.h"
@@ -46,6 +51,7 @@
 #include "HAL/PlatformFilemanager.h"
 #include "Async/Async.h"
 #include "Logging/LogMacros.h"
+#include "HAL/IConsoleManager.h"
 
 #if WITH_EDITOR
 	#include "Widgets/Notifications/SNotificationList.h"
@@ -54,6 +60,71 @@
 
 #define LOCTEXT_NAMESPACE "HoudiniEngine"
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineSessionPoolSize(
+	TEXT("HoudiniEngine.SessionPoolSize"),
+	1,
+	TEXT("Number of Houdini Engine sessions that independent Houdini Asset Components can be dispatched to.\n")
+	TEXT("Additional sessions are started on demand, using the main session's type (socket or named pipe).\n")
+	TEXT("HDAs connected via asset inputs are kept in the same session.\n")
+	TEXT("1: Disabled, all the HDAs are cooked sequentially in the main session (default)\n")
+);
+
+// Maximum number of sessions in the pool
+static const int32 HoudiniMaxSessionPoolSize = 64;
+
+// Modify our PATH so that HARC will find HARS.exe
+static void
+HoudiniUpdatePathForServer(const FString& InLibHAPILocation)
+{
+	const TCHAR* PathDelimiter = FPlatformMisc::GetPathVarDelimiter();
+
+	FString OrigPathVar = FPlatformMisc::GetEnvironmentVariable(TEXT("PATH"));
+
+	FString ModifiedPath =
+#if PLATFORM_MAC
+		// On Mac our binaries are split between two folders
+		InLibHAPILocation + TEXT("/../Resources/bin") + PathDelimiter +
+#endif
+		InLibHAPILocation + PathDelimiter + OrigPathVar;
+
+	FPlatformMisc::SetEnvironmentVar(TEXT("PATH"), *ModifiedPath);
+}
+
+// Node ids and string handles of a session are meaningless once it is lost or restarted
+static void
+HoudiniClearSessionCaches(const int32& InSessionIndex)
+{
+	FHoudiniAttributeInfoCache::Clear(InSessionIndex);
+	FHoudiniEngineString::ClearStringCache(InSessionIndex);
+
+	// The geometry cache is only accessed on the game thread, sessions can be lost by a scheduler thread
+	if (IsInGameThread())
+	{
+		FHoudiniInputGeometryCache::Clear(InSessionIndex);
+	}
+	else
+	{
+		const int32 SessionIndex = InSessionIndex;
+		AsyncTask(ENamedThreads::GameThread, [SessionIndex]() { FHoudiniInputGeometryCache::Clear(SessionIndex); });
+	}
+}
+
+// Logs how long the tasks waited in a stopped scheduler's queue, and how many were left unprocessed
+static void
+HoudiniLogSchedulerStats(FHoudiniEngineScheduler* InScheduler, const int32& InSessionIndex)
+{
+	if (!InScheduler)
+		return;
+
+	double AverageWaitTime = 0.0;
+	double MaxWaitTime = 0.0;
+	InScheduler->GetTaskWaitTimes(AverageWaitTime, MaxWaitTime);
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Houdini Engine scheduler for session %d stopped: task wait time %.3fs average, %.3fs max, %d task(s) left in queue."),
+		InSessionIndex, AverageWaitTime, MaxWaitTime, InScheduler->GetQueueDepth());
+}
+
 IMPLEMENT_MODULE(FHoudiniEngine, HoudiniEngine)
 DEFINE_LOG_CATEGORY( LogHoudiniEngine );
 
@@ -85,6 +156,16 @@ FHoudiniEngine::FHoudiniEngine()
 	Session.type = HAPI_SESSION_MAX;
 	Session.id = -1;
 
+	PooledSessions.SetNum(HoudiniMaxSessionPoolSize - 1);
+	for (FHoudiniPooledSession& CurrentPooledSession : PooledSessions)
+	{
+		CurrentPooledSession.Session.type = HAPI_SESSION_MAX;
+		CurrentPooledSession.Session.id = -1;
+	}
+
+	MainSessionType = EHoudiniRuntimeSettingsSessionType::HRSST_None;
+	MainSessionPort = 0;
+
 	SetSessionStatus(EHoudiniSessionStatus::Invalid);
 
 #if WITH_EDITOR
@@ -278,6 +359,12 @@ FHoudiniEngine::ShutdownModule()
 		HoudiniDefaultReferenceMeshMaterial->RemoveFromRoot();
 		HoudiniDefaultReferenceMeshMaterial = nullptr;
 	}
+
+	// Release the resolved objects cache
+	FHoudiniObjectResolutionCache::Shutdown();
+
+	// Forget the shared static mesh input nodes
+	FHoudiniInputGeometryCache::Clear();
 	/*
 	// We no longer need Houdini digital asset used for loading bgeo files.
 	if (HoudiniBgeoAsset.IsValid())
@@ -309,6 +396,7 @@ FHoudiniEngine::ShutdownModule()
 
 	if ( HoudiniEngineScheduler )
 	{
+		HoudiniLogSchedulerStats(HoudiniEngineScheduler, 0);
 		delete HoudiniEngineScheduler;
 		HoudiniEngineScheduler = nullptr;
 	}
@@ -323,6 +411,9 @@ FHoudiniEngine::ShutdownModule()
 		HoudiniEngineManager = nullptr;
 	}
 
+	// Close the additional sessions and their schedulers
+	StopPooledSessions();
+
 	// Perform HAPI finalization.
 	if ( FHoudiniApi::IsHAPIInitialized() )
 	{
@@ -339,8 +430,22 @@ FHoudiniEngine::ShutdownModule()
 void
 FHoudiniEngine::AddTask(const FHoudiniEngineTask & InTask)
 {
-	if ( HoudiniEngineScheduler )
-		HoudiniEngineScheduler->AddTask(InTask);
+	// Tasks are run in the session current to the caller,
+	// by that session's scheduler so that tasks for different sessions run concurrently
+	FHoudiniEngineTask Task = InTask;
+	if (Task.SessionIndex < 0)
+		Task.SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+
+	FHoudiniEngineScheduler* Scheduler = HoudiniEngineScheduler;
+	if (Task.SessionIndex > 0 
+		&& PooledSessions.IsValidIndex(Task.SessionIndex - 1)
+		&& PooledSessions[Task.SessionIndex - 1].Scheduler)
+	{
+		Scheduler = PooledSessions[Task.SessionIndex - 1].Scheduler;
+	}
+
+	if (Scheduler)
+		Scheduler->AddTask(Task);
 
 	FScopeLock ScopeLock(&CriticalSection);
 	FHoudiniEngineTaskInfo TaskInfo;
@@ -431,9 +536,193 @@ FHoudiniEngine::GetHoudiniExecutable()
 const HAPI_Session *
 FHoudiniEngine::GetSession() const
 {
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	if (SessionIndex > 0)
+		return GetPooledSession(SessionIndex);
+
 	return Session.type == HAPI_SESSION_MAX ? nullptr : &Session;
 }
 
+const HAPI_Session *
+FHoudiniEngine::GetPooledSession(const int32& InSessionIndex) const
+{
+	if (InSessionIndex <= 0)
+		return Session.type == HAPI_SESSION_MAX ? nullptr : &Session;
+
+	if (!PooledSessions.IsValidIndex(InSessionIndex - 1))
+		return nullptr;
+
+	const HAPI_Session& PooledSession = PooledSessions[InSessionIndex - 1].Session;
+	return PooledSession.type == HAPI_SESSION_MAX ? nullptr : &PooledSession;
+}
+
+void
+FHoudiniEngine::GetStartedSessionIndices(TArray<int32>& OutSessionIndices) const
+{
+	OutSessionIndices.Empty();
+	if (Session.type == HAPI_SESSION_MAX)
+		return;
+
+	OutSessionIndices.Add(0);
+
+	// Pooled sessions stay alive if the pool size has been reduced since they were started
+	for (int32 PooledIdx = 0; PooledIdx < PooledSessions.Num(); PooledIdx++)
+	{
+		if (PooledSessions[PooledIdx].Session.type != HAPI_SESSION_MAX)
+			OutSessionIndices.Add(PooledIdx + 1);
+	}
+}
+
+int32
+FHoudiniEngine::GetSessionPoolSize() const
+{
+	// The pool requires the scheduler threads and a valid main session
+	if (!FPlatformProcess::SupportsMultithreading() || Session.type == HAPI_SESSION_MAX)
+		return 1;
+
+	// In-process sessions cannot be duplicated, 
+	// and Session Sync users expect all the HDAs to be in their Houdini session
+	if (bEnableSessionSync)
+		return 1;
+
+	if (MainSessionType != EHoudiniRuntimeSettingsSessionType::HRSST_Socket
+		&& MainSessionType != EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe)
+		return 1;
+
+	return FMath::Clamp(CVarHoudiniEngineSessionPoolSize.GetValueOnAnyThread(), 1, HoudiniMaxSessionPoolSize);
+}
+
+bool
+FHoudiniEngine::StartPooledSessionIfNeeded(const int32& InSessionIndex)
+{
+	if (InSessionIndex <= 0)
+		return GetPooledSession(0) != nullptr;
+
+	if (InSessionIndex >= GetSessionPoolSize())
+		return false;
+
+	FHoudiniPooledSession& PooledSession = PooledSessions[InSessionIndex - 1];
+	if (PooledSession.Session.type != HAPI_SESSION_MAX)
+		return true;
+
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+	HAPI_ThriftServerOptions ServerOptions;
+	FMemory::Memzero< HAPI_ThriftServerOptions >(ServerOptions);
+	ServerOptions.autoClose = true;
+	ServerOptions.timeoutMs = HoudiniRuntimeSettings->AutomaticServerTimeout;
+
+	HAPI_Session NewSession;
+	NewSession.type = HAPI_SESSION_MAX;
+	NewSession.id = -1;
+
+	// Each pooled session uses its own HARS, on the next ports / a suffixed pipe name
+	HoudiniUpdatePathForServer(LibHAPILocation);
+	HAPI_Result Result = HAPI_RESULT_FAILURE;
+	if (MainSessionType == EHoudiniRuntimeSettingsSessionType::HRSST_Socket)
+	{
+		const int32 ServerPort = MainSessionPort + InSessionIndex;
+		FHoudiniApi::StartThriftSocketServer(&ServerOptions, ServerPort, nullptr);
+		Result = FHoudiniApi::CreateThriftSocketSession(&NewSession, "localhost", ServerPort);
+	}
+	else
+	{
+		const FString ServerPipeName = FString::Printf(TEXT("%s_%d"), *MainSessionPipeName, InSessionIndex);
+		FHoudiniApi::StartThriftNamedPipeServer(&ServerOptions, TCHAR_TO_UTF8(*ServerPipeName), nullptr);
+		Result = FHoudiniApi::CreateThriftNamedPipeSession(&NewSession, TCHAR_TO_UTF8(*ServerPipeName));
+	}
+
+	if (Result != HAPI_RESULT_SUCCESS)
+	{
+		HOUDINI_LOG_ERROR(
+			TEXT("Failed to start the pooled Houdini Engine session %d - %s"),
+			InSessionIndex, *FHoudiniEngineUtils::GetConnectionError());
+		return false;
+	}
+
+	// Initialize HAPI in the new session with the same options as the main one
+	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
+	Result = FHoudiniApi::Initialize(
+		&NewSession,
+		&CookOptions,
+		true,
+		HoudiniRuntimeSettings->CookingThreadStackSize,
+		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->HoudiniEnvironmentFiles),
+		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->OtlSearchPath),
+		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->DsoSearchPath),
+		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->ImageDsoSearchPath),
+		TCHAR_TO_UTF8(*HoudiniRuntimeSettings->AudioDsoSearchPath));
+
+	if (Result != HAPI_RESULT_SUCCESS && Result != HAPI_RESULT_ALREADY_INITIALIZED)
+	{
+		HOUDINI_LOG_ERROR(
+			TEXT("Failed to initialize the pooled Houdini Engine session %d - %s"),
+			InSessionIndex, *FHoudiniEngineUtils::GetErrorDescription(Result));
+
+		FHoudiniApi::CloseSession(&NewSession);
+		return false;
+	}
+
+	FHoudiniApi::SetServerEnvString(&NewSession, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME);
+
+	PooledSession.Session = NewSession;
+	HoudiniClearSessionCaches(InSessionIndex);
+
+	// Each session gets its own scheduler so its tasks don't wait for the other sessions'
+	if (!PooledSession.Scheduler)
+	{
+		PooledSession.Scheduler = new FHoudiniEngineScheduler();
+		PooledSession.SchedulerThread = FRunnableThread::Create(
+			PooledSession.Scheduler, *FString::Printf(TEXT("HoudiniSchedulerThread%d"), InSessionIndex), 0, TPri_Normal);
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("Started the pooled Houdini Engine session %d."), InSessionIndex);
+
+	return true;
+}
+
+void
+FHoudiniEngine::StopPooledSessions()
+{
+	for (int32 PooledIdx = 0; PooledIdx < PooledSessions.Num(); PooledIdx++)
+	{
+		FHoudiniPooledSession& CurrentPooledSession = PooledSessions[PooledIdx];
+
+		if (CurrentPooledSession.Scheduler)
+			CurrentPooledSession.Scheduler->Stop();
+
+		if (CurrentPooledSession.SchedulerThread)
+		{
+			CurrentPooledSession.SchedulerThread->WaitForCompletion();
+
+			delete CurrentPooledSession.SchedulerThread;
+			CurrentPooledSession.SchedulerThread = nullptr;
+		}
+
+		if (CurrentPooledSession.Scheduler)
+		{
+			HoudiniLogSchedulerStats(CurrentPooledSession.Scheduler, PooledIdx + 1);
+			delete CurrentPooledSession.Scheduler;
+			CurrentPooledSession.Scheduler = nullptr;
+		}
+
+		if (CurrentPooledSession.Session.type == HAPI_SESSION_MAX)
+			continue;
+
+		HoudiniClearSessionCaches(PooledIdx + 1);
+
+		if (FHoudiniApi::IsHAPIInitialized()
+			&& HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(&CurrentPooledSession.Session))
+		{
+			FHoudiniApi::Cleanup(&CurrentPooledSession.Session);
+			FHoudiniApi::CloseSession(&CurrentPooledSession.Session);
+		}
+
+		CurrentPooledSession.Session.type = HAPI_SESSION_MAX;
+		CurrentPooledSession.Session.id = -1;
+	}
+}
+
 const EHoudiniSessionStatus&
 FHoudiniEngine::GetSessionStatus() const
 {
@@ -458,6 +747,11 @@ FHoudiniEngine::SetSessionStatus(const EHoudiniSessionStatus& InSessionStatus)
 		return;
 	}
 
+	// The main session's cached data is meaningless once its status changes,
+	// the pooled sessions' caches are cleared when they are lost or stopped
+	if (InSessionStatus != SessionStatus)
+		HoudiniClearSessionCaches(0);
+
 	switch (InSessionStatus)
 	{
 		case EHoudiniSessionStatus::NotStarted:
@@ -546,19 +840,7 @@ FHoudiniEngine::StartSession(HAPI_Session*& SessionPtr,
 
 	auto UpdatePathForServer = [&]
 	{
-		// Modify our PATH so that HARC will find HARS.exe
-		const TCHAR* PathDelimiter = FPlatformMisc::GetPathVarDelimiter();
-
-		FString OrigPathVar = FPlatformMisc::GetEnvironmentVariable(TEXT("PATH"));
-
-		FString ModifiedPath =
-#if PLATFORM_MAC
-			// On Mac our binaries are split between two folders
-			LibHAPILocation + TEXT("/../Resources/bin") + PathDelimiter +
-#endif
-			LibHAPILocation + PathDelimiter + OrigPathVar;
-
-		FPlatformMisc::SetEnvironmentVar(TEXT("PATH"), *ModifiedPath);
+		HoudiniUpdatePathForServer(LibHAPILocation);
 	};
 
 
@@ -659,6 +941,14 @@ FHoudiniEngine::StartSession(HAPI_Session*& SessionPtr,
 	HOUDINI_CHECK_ERROR(FHoudiniApi::GetSessionEnvInt(
 		SessionPtr, HAPI_SESSIONENVINT_LICENSE, (int32 *)&LicenseType));
 
+	// Keep track of the main session's server so that the session pool can start similar ones
+	if (SessionPtr == &Session)
+	{
+		MainSessionType = SessionType;
+		MainSessionPipeName = ServerPipeName;
+		MainSessionPort = ServerPort;
+	}
+
 	return true;
 }
 
@@ -849,6 +1139,23 @@ FHoudiniEngine::InitializeHAPISession()
 void
 FHoudiniEngine::OnSessionLost()
 {
+	// If we lost a pooled session, only invalidate that session,
+	// its HDAs will be moved to another session by the manager
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	if (SessionIndex > 0)
+	{
+		if (PooledSessions.IsValidIndex(SessionIndex - 1))
+		{
+			PooledSessions[SessionIndex - 1].Session.type = HAPI_SESSION_MAX;
+			PooledSessions[SessionIndex - 1].Session.id = -1;
+		}
+
+		HoudiniClearSessionCaches(SessionIndex);
+
+		HOUDINI_LOG_ERROR(TEXT("Pooled Houdini Engine Session %d lost! This could be caused by a crash in HARS."), SessionIndex);
+		return;
+	}
+
 	// Mark the session as invalid
 	Session.id = -1;
 	Session.type = HAPI_SESSION_MAX;
@@ -878,6 +1185,10 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 	if (!FHoudiniApi::IsHAPIInitialized())
 		return false;
 
+	// The PDG event pump thread polls the session, stop it before closing the session
+	if (HoudiniEngineManager)
+		HoudiniEngineManager->StopPDGEventPump();
+
 	if (HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid(SessionPtr))
 	{
 		// SessionPtr is valid, clean up and close the session
@@ -885,6 +1196,9 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 		FHoudiniApi::CloseSession(SessionPtr);
 	}
 
+	// The pooled sessions are tied to the main one
+	StopPooledSessions();
+
 	Session.id = -1;
 	Session.type = HAPI_SESSION_MAX;
 	SetSessionStatus(EHoudiniSessionStatus::Stopped);
@@ -1339,5 +1653,16 @@ bool FHoudiniEngine::IsSyncWithHoudiniCookEnabled() const
 	return HoudiniRuntimeSettings ? HoudiniRuntimeSettings->bSyncWithHoudiniCook : false;
 }
 
+FHoudiniScopedSession::FHoudiniScopedSession(const int32& InSessionIndex)
+	: PreviousSessionIndex(FHoudiniEngineRuntime::GetCurrentSessionIndex())
+{
+	FHoudiniEngineRuntime::SetCurrentSessionIndex(InSessionIndex);
+}
+
+FHoudiniScopedSession::~FHoudiniScopedSession()
+{
+	FHoudiniEngineRuntime::SetCurrentSessionIndex(PreviousSessionIndex);
+}
+
 #undef LOCTEXT_NAMESPACE
 
@@ -58,6 +58,28 @@ enum class EHoudiniSessionStatus : int8
 	NoLicense,		// Failed to acquire a license
 };
 
+// Additional Houdini Engine session of the session pool, with the scheduler running its tasks
+struct FHoudiniPooledSession
+{
+	HAPI_Session Session;
+
+	FHoudiniEngineScheduler* Scheduler = nullptr;
+	FRunnableThread* SchedulerThread = nullptr;
+};
+
+// Routes the HAPI calls made on the calling thread to a pooled session for the lifetime of the scope
+struct HOUDINIENGINE_API FHoudiniScopedSession
+{
+	public:
+
+		FHoudiniScopedSession(const int32& InSessionIndex);
+		~FHoudiniScopedSession();
+
+	private:
+
+		int32 PreviousSessionIndex;
+};
+
 // Not using the IHoudiniEngine interface for now
 class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 {
@@ -79,7 +101,7 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Return the houdini executable to use
 		static const FString GetHoudiniExecutable();
 
-		// Session accessor
+		// Session accessor, returns the pooled session used by the calling thread
 		virtual const HAPI_Session* GetSession() const;
 
 		virtual const EHoudiniSessionStatus& GetSessionStatus() const;
@@ -128,6 +150,20 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Initialize HAPI
 		bool InitializeHAPISession();
 
+		//
+		// Session pool
+		//
+		// Number of sessions HACs can be dispatched to, 1 if the pool is disabled
+		int32 GetSessionPoolSize() const;
+		// Returns the session at the given pool index (0 is the main session), null if it hasn't been started
+		const HAPI_Session* GetPooledSession(const int32& InSessionIndex) const;
+		// Returns the pool indices of all the sessions that have been started, the main session first
+		void GetStartedSessionIndices(TArray<int32>& OutSessionIndices) const;
+		// Starts the pooled session at the given index (HARS, HAPI and its scheduler) if needed
+		bool StartPooledSessionIfNeeded(const int32& InSessionIndex);
+		// Stops all the pooled sessions, the main session is left untouched
+		void StopPooledSessions();
+
 		// Indicate to the plugin that the session is now invalid (HAPI has likely crashed...)
 		void OnSessionLost();
 
@@ -258,6 +294,15 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// The Houdini Engine session. 
 		HAPI_Session Session;
 
+		// Additional sessions of the pool, session index N is PooledSessions[N - 1].
+		// Allocated once so that threads can safely access them while others are started.
+		TArray<FHoudiniPooledSession> PooledSessions;
+
+		// Type and server of the main session, used to start the pooled sessions
+		EHoudiniRuntimeSettingsSessionType MainSessionType;
+		FString MainSessionPipeName;
+		int32 MainSessionPort;
+
 		// The Houdini Engine session's status
 		EHoudiniSessionStatus SessionStatus;
 
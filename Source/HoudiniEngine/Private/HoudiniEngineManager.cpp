@@ -31,8 +31,15 @@
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniAsset.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniAttributeInfoCache.h"
+#include "HoudiniActorBoundsIndex.h"
+#include "HoudiniInputGeometryCache.h"
+#include "HoudiniAttributeRequestSet.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniEngineTask.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniInput.h"
+#include "HoudiniInputObject.h"
 #include "HoudiniParameterTranslator.h"
 #include "HoudiniPDGManager.h"
 #include "HoudiniInputTranslator.h"
@@ -47,6 +54,7 @@
 
 #if WITH_EDITOR
 	#include "Editor.h"
+	#include "Engine/Selection.h"
 	#include "EditorViewportClient.h"
 	#include "Kismet/KismetMathLibrary.h"
 
@@ -64,6 +72,44 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineTickTimeLimit(
 	TEXT("1.0: Default\n")
 );
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineIdleComponentsPerTick(
+	TEXT("HoudiniEngine.IdleComponentsPerTick"),
+	1,
+	TEXT("Number of idle Houdini Asset Components that are checked for updates on each tick of the Houdini Engine Manager.\n")
+	TEXT("Selected and active components are always processed.\n")
+	TEXT("1: Default\n")
+);
+
+// Returns the HDAs plugged in the HAC's asset and world inputs
+static void
+GetUpstreamHoudiniAssets(UHoudiniAssetComponent* HAC, TArray<UHoudiniAssetComponent*>& OutUpstreamHACs)
+{
+	for (int32 InputIdx = 0; InputIdx < HAC->GetNumInputs(); InputIdx++)
+	{
+		UHoudiniInput* CurrentInput = HAC->GetInputAt(InputIdx);
+		if (!IsValid(CurrentInput))
+			continue;
+
+		EHoudiniInputType CurrentInputType = CurrentInput->GetInputType();
+		if (CurrentInputType != EHoudiniInputType::Asset && CurrentInputType != EHoudiniInputType::World)
+			continue;
+
+		TArray<UHoudiniInputObject*>* ObjectArray = CurrentInput->GetHoudiniInputObjectArray(CurrentInputType);
+		if (!ObjectArray)
+			continue;
+
+		for (auto& CurrentInputObject : (*ObjectArray))
+		{
+			UHoudiniAssetComponent* InputHAC = IsValid(CurrentInputObject)
+				? Cast<UHoudiniAssetComponent>(CurrentInputObject->GetObject())
+				: nullptr;
+
+			if (IsValid(InputHAC) && InputHAC != HAC)
+				OutUpstreamHACs.AddUnique(InputHAC);
+		}
+	}
+}
+
 FHoudiniEngineManager::FHoudiniEngineManager()
 	: CurrentIndex(0)
 	, ComponentCount(0)
@@ -147,8 +193,9 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 
 	// Build a set of components that need to be processed
 	// 1 - selected HACs
-	// 2 - "Active" HACs
-	// 3 - The "next" inactive HAC
+	// 2 - "Active" HACs, that have flagged themselves as needing processing
+	// 3 - A round-robin slice of the idle HACs
+	// This avoids going through every registered component on each tick.
 	TArray<UHoudiniAssetComponent*> ComponentsToProcess;
 	if (FHoudiniEngineRuntime::IsInitialized())
 	{
@@ -161,27 +208,79 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		if (CurrentIndex >= ComponentCount)
 			CurrentIndex = 0;
 
-		for (uint32 nIdx = 0; nIdx < ComponentCount; nIdx++)
+		TArray<UHoudiniAssetComponent*> CandidateComponents;
+
+#if WITH_EDITOR
+		// 1. Add selected HACs
+		if (GEditor)
+		{
+			for (FSelectionIterator It(GEditor->GetSelectedActorIterator()); It; ++It)
+			{
+				AActor* SelectedActor = Cast<AActor>(*It);
+				if (!IsValid(SelectedActor))
+					continue;
+
+				TArray<UHoudiniAssetComponent*> SelectedHACs;
+				SelectedActor->GetComponents<UHoudiniAssetComponent>(SelectedHACs);
+				for (UHoudiniAssetComponent* SelectedHAC : SelectedHACs)
+				{
+					if (FHoudiniEngineRuntime::Get().IsComponentRegistered(SelectedHAC))
+						CandidateComponents.Add(SelectedHAC);
+				}
+			}
+		}
+#endif
+
+		// 2. Add "Active" HACs
+		FHoudiniEngineRuntime::Get().GetActiveHoudiniComponents(CandidateComponents);
+
+		// 3. Add the "Current" idle HACs
+		const uint32 IdleCount = ComponentCount > 0
+			? (uint32)FMath::Clamp(CVarHoudiniEngineIdleComponentsPerTick.GetValueOnAnyThread(), 0, (int32)ComponentCount)
+			: 0;
+		for (uint32 nIdx = 0; nIdx < IdleCount; nIdx++)
+		{
+			UHoudiniAssetComponent* IdleComponent = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt((CurrentIndex + nIdx) % ComponentCount);
+			if (!IdleComponent)
+				continue;
+
+			// Set the LastTickTime on the "current" HAC to 0 to ensure it's treated first
+			IdleComponent->LastTickTime = 0.0;
+			CandidateComponents.Add(IdleComponent);
+		}
+
+		// Increment the current index for the next tick
+		CurrentIndex += IdleCount;
+
+		TSet<UHoudiniAssetComponent*> AddedComponents;
+		for (UHoudiniAssetComponent* CurrentComponent : CandidateComponents)
 		{
-			UHoudiniAssetComponent * CurrentComponent = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(nIdx);
 			if (!CurrentComponent || !CurrentComponent->IsValidLowLevelFast())
 			{
 				// Invalid component, do not process
 				continue;
 			}
-			else if (!IsValid(CurrentComponent) || CurrentComponent->GetAssetState() == EHoudiniAssetState::Deleting)
+
+			bool bAlreadyAdded = false;
+			AddedComponents.Add(CurrentComponent, &bAlreadyAdded);
+			if (bAlreadyAdded)
+				continue;
+
+			if (!IsValid(CurrentComponent) || CurrentComponent->GetAssetState() == EHoudiniAssetState::Deleting)
 			{
 				// Component being deleted, do not process
+				FHoudiniEngineRuntime::Get().RemoveActiveHoudiniComponent(CurrentComponent);
 				continue;
 			}
 			
 			{
 				UWorld* World = CurrentComponent->GetWorld();
-				if (World && World->IsPlayingReplay() || World->IsPlayInEditor())
+				if (World && (World->IsPlayingReplay() || World->IsPlayInEditor()))
 				{
 					if (!CurrentComponent->IsPlayInEditorRefinementAllowed())
 					{
 						// This component's world is current in PIE and this HDA is NOT allowed to cook / refine in PIE.
+						// Keep it active so it is picked up again after PIE.
 						continue;
 					}
 				}
@@ -192,7 +291,11 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 				// Let the component figure out whether it's fully loaded or not.
 				CurrentComponent->HoudiniEngineTick();
 				if (!CurrentComponent->IsFullyLoaded())
-					continue; // We need to wait some more.
+				{
+					// We need to wait some more.
+					FHoudiniEngineRuntime::Get().MarkHoudiniComponentAsActive(CurrentComponent);
+					continue;
+				}
 			}
 
 			if (!CurrentComponent->IsValidComponent())
@@ -202,36 +305,8 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 				continue;
 			}
 
-			AActor* Owner = CurrentComponent->GetOwner();
-			if (Owner && Owner->IsSelectedInEditor())
-			{
-				// 1. Add selected HACs
-				// If the component's owner is selected, add it to the set
-				ComponentsToProcess.Add(CurrentComponent);
-			}
-			else if (CurrentComponent->GetAssetState() != EHoudiniAssetState::NeedInstantiation
-				&& CurrentComponent->GetAssetState() != EHoudiniAssetState::None)
-			{
-				// 2. Add "Active" HACs, the only two non-active states are:
-				// NeedInstantiation (loaded, not instantiated in H yet, not modified)
-				// None (no processing currently)
-				ComponentsToProcess.Add(CurrentComponent);
-			}
-			else if(nIdx == CurrentIndex)
-			{
-				// 3. Add the "Current" HAC
-				ComponentsToProcess.Add(CurrentComponent);
-			}
-
-			// Set the LastTickTime on the "current" HAC to 0 to ensure it's treated first
-			if (nIdx == CurrentIndex)
-			{
-				CurrentComponent->LastTickTime = 0.0;
-			}
+			ComponentsToProcess.Add(CurrentComponent);
 		}
-
-		// Increment the current index for the next tick
-		CurrentIndex++;
 	}
 
 	// Sort the components by last tick time
@@ -308,7 +383,11 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 			AutoStartFirstSessionIfNeeded(CurrentComponent);
 
 			EHoudiniAssetState PrevState = CurrentComponent->GetAssetState();
-			ProcessComponent(CurrentComponent);
+			{
+				// Process the component in the session its nodes live in
+				FHoudiniScopedSession ScopedSession(CurrentComponent->GetSessionIndex());
+				ProcessComponent(CurrentComponent);
+			}
 			EHoudiniAssetState NewState = CurrentComponent->GetAssetState();
 
 			// In order to process components faster / with less ticks,
@@ -351,6 +430,14 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 			// Update the tick time for this component
 			CurrentComponent->LastTickTime = dNow;
 		}
+
+		// The component is idle again, only the round-robin slice needs to look at it now.
+		// The two non-active states are:
+		// NeedInstantiation (loaded, not instantiated in H yet, not modified)
+		// None (no processing currently)
+		EHoudiniAssetState CurrentState = CurrentComponent->GetAssetState();
+		if (CurrentState == EHoudiniAssetState::NeedInstantiation || CurrentState == EHoudiniAssetState::None)
+			FHoudiniEngineRuntime::Get().RemoveActiveHoudiniComponent(CurrentComponent);
 	}
 
 	// Handle Asset delete
@@ -360,13 +447,15 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 		for (int32 DeleteIdx = PendingDeleteCount - 1; DeleteIdx >= 0; DeleteIdx--)
 		{
 			HAPI_NodeId NodeIdToDelete = (HAPI_NodeId)FHoudiniEngineRuntime::Get().GetNodeIdsPendingDeleteAt(DeleteIdx);
+			const int32 DeleteSessionIndex = FHoudiniEngineRuntime::Get().GetNodeIdsPendingDeleteSessionIndexAt(DeleteIdx);
+			FHoudiniScopedSession ScopedSession(DeleteSessionIndex);
 			FGuid HapiDeletionGUID;
-			bool bShouldDeleteParent = FHoudiniEngineRuntime::Get().IsParentNodePendingDelete(NodeIdToDelete);
+			bool bShouldDeleteParent = FHoudiniEngineRuntime::Get().IsParentNodePendingDelete(NodeIdToDelete, DeleteSessionIndex);
 			if (StartTaskAssetDelete(NodeIdToDelete, HapiDeletionGUID, bShouldDeleteParent))
 			{
 				FHoudiniEngineRuntime::Get().RemoveNodeIdPendingDeleteAt(DeleteIdx);
 				if (bShouldDeleteParent)
-					FHoudiniEngineRuntime::Get().RemoveParentNodePendingDelete(NodeIdToDelete);
+					FHoudiniEngineRuntime::Get().RemoveParentNodePendingDelete(NodeIdToDelete, DeleteSessionIndex);
 			}
 		}
 	}
@@ -535,13 +624,19 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			if (HAC->NeedsToWaitForInputHoudiniAssets())
 				break;
 
+			// Pick the session the HDA will be instantiated in
+			UpdateComponentSession(HAC, false);
+			FHoudiniScopedSession PinnedSession(HAC->GetSessionIndex());
+
 			// Make sure we empty the nodes to cook array to avoid cook errors caused by stale nodes 
 			HAC->ClearOutputNodes();
 
 			FGuid TaskGuid;
 			FString HapiAssetName;
 			UHoudiniAsset* HoudiniAsset = HAC->GetHoudiniAsset();
-			if (StartTaskAssetInstantiation(HoudiniAsset, HAC->GetDisplayName(), TaskGuid, HapiAssetName))
+			// HDAs the user is interacting with are scheduled before background cooks
+			const EHoudiniEngineTaskPriority Priority = HAC->IsOwnerSelected() ? EHoudiniEngineTaskPriority::High : EHoudiniEngineTaskPriority::Normal;
+			if (StartTaskAssetInstantiation(HoudiniAsset, HAC->GetDisplayName(), Priority, TaskGuid, HapiAssetName))
 			{
 				// Update the HAC's state
 				HAC->SetAssetState(EHoudiniAssetState::Instantiating);
@@ -584,6 +679,12 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			if (HAC->NeedsToWaitForInputHoudiniAssets())
 				break;
 
+			// HDAs connected via asset inputs need to be in the same session,
+			// if we or our inputs had to move, wait for the instantiation in the new session.
+			if (!UpdateComponentSession(HAC, true))
+				break;
+			FHoudiniScopedSession PinnedSession(HAC->GetSessionIndex());
+
 			HAC->OnPrePreCook();
 			// Update all the HAPI nodes, parameters, inputs etc...
 			PreCook(HAC);
@@ -598,6 +699,9 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 				FHoudiniEngineUtils::GatherAllAssetOutputs(HAC->GetAssetId(), HAC->bUseOutputNodes, HAC->bOutputTemplateGeos, OutputNodes);
 				HAC->SetOutputNodeIds(OutputNodes);
 				
+				// HDAs the user is interacting with are scheduled before background cooks
+				const EHoudiniEngineTaskPriority Priority = HAC->IsOwnerSelected() ? EHoudiniEngineTaskPriority::High : EHoudiniEngineTaskPriority::Normal;
+
 				FGuid TaskGUID = HAC->GetHapiGUID();
 				if ( StartTaskAssetCooking(
 					HAC->GetAssetId(),
@@ -605,6 +709,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 					HAC->GetDisplayName(),
 					HAC->bUseOutputNodes,
 					HAC->bOutputTemplateGeos,
+					Priority,
 					TaskGUID) )
 				{
 					// Updates the HAC's state
@@ -677,6 +782,9 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 			HAC->OnPostOutputProcessing();
 			FHoudiniEngineUtils::UpdateBlueprintEditor(HAC);
+
+			// The outputs might have changed the actor's bounds
+			FHoudiniActorBoundsIndex::MarkActorDirty(HAC->GetOwner());
 			break;
 		}
 
@@ -746,8 +854,155 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 
 
+int32
+FHoudiniEngineManager::SelectComponentSession(UHoudiniAssetComponent* HAC)
+{
+	const int32 PoolSize = FHoudiniEngine::Get().GetSessionPoolSize();
+	if (PoolSize <= 1)
+		return 0;
+
+	// PDG asset links rely on the main session's graph contexts
+	if (IsValid(HAC->GetPDGAssetLink()))
+		return 0;
+
+	auto IsSessionAlive = [PoolSize](const int32& InSessionIndex)
+	{
+		return InSessionIndex >= 0 
+			&& InSessionIndex < PoolSize
+			&& FHoudiniEngine::Get().GetPooledSession(InSessionIndex) != nullptr;
+	};
+
+	// Follow the HDAs plugged in our inputs first, then the ones using us as an input
+	TArray<UHoudiniAssetComponent*> ConnectedHACs;
+	GetUpstreamHoudiniAssets(HAC, ConnectedHACs);
+	for (UHoudiniAssetComponent* DownstreamHAC : HAC->GetDownstreamHoudiniAssets())
+	{
+		if (IsValid(DownstreamHAC) && DownstreamHAC->GetAssetId() >= 0)
+			ConnectedHACs.AddUnique(DownstreamHAC);
+	}
+
+	for (UHoudiniAssetComponent* ConnectedHAC : ConnectedHACs)
+	{
+		if (IsSessionAlive(ConnectedHAC->GetSessionIndex()))
+			return ConnectedHAC->GetSessionIndex();
+	}
+
+	// Stay in our current session if possible
+	if (IsSessionAlive(HAC->GetSessionIndex()))
+		return HAC->GetSessionIndex();
+
+	// Dispatch to the session with the fewest HDAs being instantiated/cooked/processed,
+	// sessions that haven't been started yet have no load and are started on demand.
+	TArray<int32> SessionLoads;
+	SessionLoads.SetNumZeroed(PoolSize);
+	const int32 NumComponents = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
+	for (int32 CompIdx = 0; CompIdx < NumComponents; CompIdx++)
+	{
+		UHoudiniAssetComponent* CurrentHAC = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(CompIdx);
+		if (!IsValid(CurrentHAC) || CurrentHAC == HAC || !SessionLoads.IsValidIndex(CurrentHAC->GetSessionIndex()))
+			continue;
+
+		const EHoudiniAssetState CurrentState = CurrentHAC->GetAssetState();
+		if (CurrentState == EHoudiniAssetState::None
+			|| CurrentState == EHoudiniAssetState::NeedInstantiation
+			|| CurrentState == EHoudiniAssetState::ProcessTemplate)
+			continue;
+
+		SessionLoads[CurrentHAC->GetSessionIndex()]++;
+	}
+
+	int32 SelectedIndex = 0;
+	for (int32 SessionIdx = 1; SessionIdx < PoolSize; SessionIdx++)
+	{
+		if (SessionLoads[SessionIdx] < SessionLoads[SelectedIndex])
+			SelectedIndex = SessionIdx;
+	}
+
+	if (!FHoudiniEngine::Get().StartPooledSessionIfNeeded(SelectedIndex))
+	{
+		HOUDINI_LOG_WARNING(TEXT("Could not start the pooled session %d, using the main session instead."), SelectedIndex);
+		return 0;
+	}
+
+	return SelectedIndex;
+}
+
+bool
+FHoudiniEngineManager::UpdateComponentSession(UHoudiniAssetComponent* HAC, const bool& bInIsInstantiated)
+{
+	const int32 SessionIndex = SelectComponentSession(HAC);
+	if (HAC->GetSessionIndex() != SessionIndex)
+	{
+		const bool bMustReinstantiate = bInIsInstantiated && HAC->GetSessionIndex() >= 0;
+		MoveComponentToSession(HAC, SessionIndex, bInIsInstantiated);
+		if (bMustReinstantiate)
+		{
+			HAC->SetAssetState(EHoudiniAssetState::PreInstantiation);
+			return false;
+		}
+	}
+
+	// Bring the HDAs plugged in our inputs to our session
+	bool bMovedInputs = false;
+	TArray<UHoudiniAssetComponent*> UpstreamHACs;
+	GetUpstreamHoudiniAssets(HAC, UpstreamHACs);
+	for (UHoudiniAssetComponent* UpstreamHAC : UpstreamHACs)
+	{
+		if (UpstreamHAC->GetSessionIndex() < 0 || UpstreamHAC->GetSessionIndex() == SessionIndex)
+			continue;
+
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Moving %s to session %d, as it is used as an input by %s."),
+			*UpstreamHAC->GetDisplayName(), SessionIndex, *HAC->GetDisplayName());
+
+		MoveComponentToSession(UpstreamHAC, SessionIndex, true);
+		UpstreamHAC->SetAssetState(EHoudiniAssetState::PreInstantiation);
+		bMovedInputs = true;
+	}
+
+	return !bMovedInputs;
+}
+
+void
+FHoudiniEngineManager::MoveComponentToSession(UHoudiniAssetComponent* HAC, const int32& InSessionIndex, const bool& bInDeleteAssetNode)
+{
+	const int32 PreviousSessionIndex = HAC->GetSessionIndex();
+	if (PreviousSessionIndex == InSessionIndex)
+		return;
+
+	HAC->SetSessionIndex(InSessionIndex);
+	if (PreviousSessionIndex < 0)
+		return;
+
+	{
+		// The HDA's nodes can't be used from the new session, delete them in the previous one
+		FHoudiniScopedSession ScopedSession(PreviousSessionIndex);
+		if (bInDeleteAssetNode && HAC->GetAssetId() >= 0)
+		{
+			FGuid HapiDeletionGUID;
+			StartTaskAssetDelete(HAC->GetAssetId(), HapiDeletionGUID, true);
+		}
+
+		// Input nodes are marked as pending delete in the previous session
+		for (int32 InputIdx = 0; InputIdx < HAC->GetNumInputs(); InputIdx++)
+		{
+			UHoudiniInput* CurrentInput = HAC->GetInputAt(InputIdx);
+			if (IsValid(CurrentInput))
+				CurrentInput->InvalidateData();
+		}
+	}
+
+	// Everything needs to be uploaded again to the new session
+	HAC->MarkAsNeedCook();
+}
+
 bool 
-FHoudiniEngineManager::StartTaskAssetInstantiation(UHoudiniAsset* HoudiniAsset, const FString& DisplayName, FGuid& OutTaskGUID, FString& OutHAPIAssetName)
+FHoudiniEngineManager::StartTaskAssetInstantiation(
+	UHoudiniAsset* HoudiniAsset,
+	const FString& DisplayName,
+	const EHoudiniEngineTaskPriority& InPriority,
+	FGuid& OutTaskGUID,
+	FString& OutHAPIAssetName)
 {
 	// Make sure we have a valid session before attempting anything
 	if (!FHoudiniEngine::Get().GetSession())
@@ -806,6 +1061,7 @@ FHoudiniEngineManager::StartTaskAssetInstantiation(UHoudiniAsset* HoudiniAsset,
 	//Task.bLoadedComponent = bLocalLoadedComponent;
 	Task.AssetLibraryId = AssetLibraryId;
 	Task.AssetHapiName = PickedAssetName;
+	Task.Priority = InPriority;
 
 	FHoudiniEngineString(PickedAssetName).ToFString(OutHAPIAssetName);
 
@@ -996,6 +1252,7 @@ FHoudiniEngineManager::StartTaskAssetCooking(
 	const FString& DisplayName,
 	bool bUseOutputNodes,
 	bool bOutputTemplateGeos,
+	const EHoudiniEngineTaskPriority& InPriority,
 	FGuid& OutTaskGUID)
 {
 	// Make sure we have a valid session before attempting anything
@@ -1013,6 +1270,10 @@ FHoudiniEngineManager::StartTaskAssetCooking(
 	// Generate a GUID for our new task.
 	OutTaskGUID = FGuid::NewGuid();
 
+	// The attribute infos cached for this asset's outputs will be stale after the cook,
+	// the session's cached strings are cleared by the scheduler once the cook is done
+	FHoudiniAttributeInfoCache::InvalidateNode(AssetId);
+
 	// Add a new cook task
 	FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetCooking, OutTaskGUID);
 	Task.ActorName = DisplayName;
@@ -1023,6 +1284,7 @@ FHoudiniEngineManager::StartTaskAssetCooking(
 
 	Task.bUseOutputNodes = bUseOutputNodes;
 	Task.bOutputTemplateGeos = bOutputTemplateGeos;
+	Task.Priority = InPriority;
 
 	FHoudiniEngine::Get().AddTask(Task);
 
@@ -1203,7 +1465,13 @@ FHoudiniEngineManager::PostCook(UHoudiniAssetComponent* HAC, const bool& bSucces
 
 		bool bHasHoudiniStaticMeshOutput = false;
 		bool ForceUpdate = HAC->HasRebuildBeenRequested() || HAC->HasRecookBeenRequested();
+		FHoudiniAttributeRequestSet::ResetCookStats();
 		FHoudiniOutputTranslator::UpdateOutputs(HAC, ForceUpdate, bHasHoudiniStaticMeshOutput);
+		if (FHoudiniAttributeRequestSet::GetCookRoundTripsSaved() > 0)
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("    %s: batched attribute fetches saved %d HAPI calls."),
+				*DisplayName, FHoudiniAttributeRequestSet::GetCookRoundTripsSaved());
+		}
 		HAC->SetNoProxyMeshNextCookRequested(false);
 
 		// Handles have to be updated after parameters
@@ -1376,6 +1644,13 @@ FHoudiniEngineManager::StartTaskAssetDelete(const HAPI_NodeId& InNodeId, FGuid&
 	// Generate GUID for our new task.
 	OutTaskGUID = FGuid::NewGuid();
 
+	// Node ids might be reused after the deletion
+	FHoudiniAttributeInfoCache::InvalidateNode(InNodeId);
+	// Release the shared static mesh node this input node (or the OBJ being deleted with it) was referencing, if any
+	FHoudiniInputGeometryCache::ReleaseNode(InNodeId);
+	if (OBJNodeToDelete != InNodeId)
+		FHoudiniInputGeometryCache::ReleaseNode(OBJNodeToDelete);
+
 	// Create asset deletion task object and submit it for processing.
 	FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetDeletion, OutTaskGUID);
 	Task.AssetId = OBJNodeToDelete;
@@ -42,6 +42,7 @@ struct FHoudiniEngineTaskInfo;
 struct FGuid;
 
 enum class EHoudiniAssetState : uint8;
+enum class EHoudiniEngineTaskPriority : uint8;
 
 class FHoudiniEngineManager
 {
@@ -82,6 +83,9 @@ public:
 	}
 
 	EHoudiniBGEOCommandletStatus GetPDGCommandletStatus() { return PDGManager.UpdateAndGetBGEOCommandletStatus(); }
+
+	// Stops the PDG event pump thread so it doesn't poll a session being closed
+	void StopPDGEventPump() { PDGManager.StopPDGEventPump(); }
 	
 	
 protected:
@@ -97,6 +101,7 @@ protected:
 	bool StartTaskAssetInstantiation(
 		UHoudiniAsset* HoudiniAsset,
 		const FString& DisplayName,
+		const EHoudiniEngineTaskPriority& InPriority,
 		FGuid& OutTaskGUID,
 		FString& OutHAPIAssetName);
 
@@ -114,6 +119,7 @@ protected:
 		const FString& DisplayName,
 		bool bUseOutputNodes,
 		bool bOutputTemplateGeos,
+		const EHoudiniEngineTaskPriority& InPriority,
 		FGuid& OutTaskGUID);
 
 	// Updates progress of the cooking task
@@ -169,6 +175,17 @@ protected:
 	// Automatically try to start the First HE session if needed
 	void AutoStartFirstSessionIfNeeded(UHoudiniAssetComponent* InCurrentHAC);
 
+	// Selects the pooled session the HAC should live in:
+	// the session of the HDAs it is connected to via asset inputs, its current one, or the least busy one
+	int32 SelectComponentSession(UHoudiniAssetComponent* HAC);
+
+	// Pins the HAC to its selected session, and brings the HDAs plugged in its asset inputs in that session.
+	// Returns false if the HAC or its inputs have been moved and need to be instantiated again.
+	bool UpdateComponentSession(UHoudiniAssetComponent* HAC, const bool& bInIsInstantiated);
+
+	// Moves the HAC to another session, its nodes are deleted in its previous session
+	void MoveComponentToSession(UHoudiniAssetComponent* HAC, const int32& InSessionIndex, const bool& bInDeleteAssetNode);
+
 private:
 
 	// Ticker handle, used for processing HAC.
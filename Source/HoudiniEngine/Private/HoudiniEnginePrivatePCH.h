@@ -112,6 +112,9 @@
 
 #define HAPI_UNREAL_SCALE_SMALL_VALUE						KINDA_SMALL_NUMBER * 2.0f
 
+// Number of instance transforms fetched from HAPI at a time
+#define HAPI_UNREAL_INSTANCE_TRANSFORMS_CHUNK_SIZE			65536
+
 #define HAPI_UNREAL_DEFAULT_MATERIAL_NAME                   TEXT( "default_material" )
 
 // Attributes
@@ -175,6 +178,8 @@
 
 #define HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME					"unreal_input_mesh_name"
 #define HAPI_UNREAL_ATTRIB_INPUT_SOURCE_FILE				"unreal_input_source_file"
+#define HAPI_UNREAL_ATTRIB_INPUT_COMPONENT_TRANSFORM		"unreal_input_component_transform"
+#define HAPI_UNREAL_ATTRIB_INPUT_COMPONENT_INDEX			"unreal_input_component_index"
 
 #define HAPI_UNREAL_ATTRIB_INSTANCE							"instance"
 #define HAPI_UNREAL_ATTRIB_INSTANCE_OVERRIDE				"unreal_instance"
@@ -189,6 +194,7 @@
 #define HAPI_UNREAL_ATTRIB_INSTANCE_NUM_CUSTOM_FLOATS		"unreal_num_custom_floats"
 #define HAPI_UNREAL_ATTRIB_INSTANCE_CUSTOM_DATA_PREFIX		"unreal_per_instance_custom_data"
 #define HAPI_UNREAL_ATTRIB_FORCE_INSTANCER					"unreal_force_instancer"
+#define HAPI_UNREAL_ATTRIB_INSTANCE_ID						"id"
 
 
 #define HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAME				 HAPI_ATTRIB_NAME
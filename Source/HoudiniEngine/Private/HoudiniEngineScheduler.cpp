@@ -31,40 +31,33 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngine.h"
 
-const uint32
-FHoudiniEngineScheduler::InitialTaskSize = 256u;
+#include "HAL/Event.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+TRACE_DECLARE_INT_COUNTER(HoudiniSchedulerQueueDepth, TEXT("HoudiniEngine/Scheduler/QueueDepth"));
+TRACE_DECLARE_FLOAT_COUNTER(HoudiniSchedulerTaskWaitTime, TEXT("HoudiniEngine/Scheduler/TaskWaitTime"));
 
 const float
 FHoudiniEngineScheduler::UpdateFrequency = 0.1f;
 
 FHoudiniEngineScheduler::FHoudiniEngineScheduler()
-	: Tasks(nullptr)
-	, PositionWrite(0u)
-	, PositionRead(0u)
+	: TaskAddedEvent(nullptr)
+	, ProcessedTaskCount(0)
+	, TotalTaskWaitTime(0.0)
+	, MaxTaskWaitTime(0.0)
 	, bStopping(false)
 {
-	//  Make sure size is power of two.
-	TaskCount = FPlatformMath::RoundUpToPowerOfTwo(FHoudiniEngineScheduler::InitialTaskSize);
-
-	if (TaskCount)
-	{
-		// Allocate buffer to store all tasks.
-		Tasks = static_cast<FHoudiniEngineTask *>(FMemory::Malloc(TaskCount * sizeof(FHoudiniEngineTask)));
-
-		if (Tasks)
-		{
-			// Zero memory.
-			FMemory::Memset(Tasks, 0x0, TaskCount * sizeof(FHoudiniEngineTask));
-		}
-	}
+	// Auto-reset, a trigger happening while we're busy wakes up the next wait
+	TaskAddedEvent = FPlatformProcess::GetSynchEventFromPool(false);
 }
 
 FHoudiniEngineScheduler::~FHoudiniEngineScheduler()
 {
-	if (TaskCount)
+	if (TaskAddedEvent)
 	{
-		FMemory::Free(Tasks);
-		Tasks = nullptr;
+		FPlatformProcess::ReturnSynchEventToPool(TaskAddedEvent);
+		TaskAddedEvent = nullptr;
 	}
 }
 
@@ -373,6 +366,9 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 		}
 	}	
 
+	// The cook invalidated the string handles cached for this session, drop them before the outputs are read
+	FHoudiniEngineString::ClearStringCache(Task.SessionIndex);
+
 	switch (GlobalTaskResult)
 	{
 		case EHoudiniEngineTaskState::Success:
@@ -461,32 +457,51 @@ FHoudiniEngineScheduler::AddResponseMessageTaskInfo(
 	FHoudiniEngine::Get().AddTaskInfo(Task.HapiGUID, TaskInfo);
 }
 
+bool
+FHoudiniEngineScheduler::DequeueTask(FHoudiniEngineTask & OutTask)
+{
+	if (!HighPriorityTasks.Dequeue(OutTask) && !NormalPriorityTasks.Dequeue(OutTask))
+		return false;
+
+	const int32 QueueDepth = QueuedTaskCount.Decrement();
+	TRACE_COUNTER_SET(HoudiniSchedulerQueueDepth, QueueDepth);
+
+	// Keep track of the time the task spent in the queue
+	const double WaitTime = FPlatformTime::Seconds() - OutTask.QueuedTime;
+	TRACE_COUNTER_SET(HoudiniSchedulerTaskWaitTime, WaitTime);
+	{
+		FScopeLock ScopeLock(&StatsCriticalSection);
+		ProcessedTaskCount++;
+		TotalTaskWaitTime += WaitTime;
+		MaxTaskWaitTime = FMath::Max(MaxTaskWaitTime, WaitTime);
+	}
+
+	return true;
+}
+
+void
+FHoudiniEngineScheduler::GetTaskWaitTimes(double& OutAverageWaitTime, double& OutMaxWaitTime)
+{
+	FScopeLock ScopeLock(&StatsCriticalSection);
+	OutAverageWaitTime = ProcessedTaskCount > 0 ? TotalTaskWaitTime / ProcessedTaskCount : 0.0;
+	OutMaxWaitTime = MaxTaskWaitTime;
+}
+
 void
 FHoudiniEngineScheduler::ProcessQueuedTasks()
 {
 	while (!bStopping)
 	{
-		while (true)
+		FHoudiniEngineTask Task;
+		while (!bStopping && DequeueTask(Task))
 		{
-			FHoudiniEngineTask Task;
-
-			{
-				FScopeLock ScopeLock(&CriticalSection);
-
-				// We have no tasks left.
-				if (PositionWrite == PositionRead)
-					break;
-
-				// Retrieve task.
-				Task = Tasks[PositionRead];
-				PositionRead++;
-
-				// Wrap around if required.
-				PositionRead &= (TaskCount - 1);
-			}
+			TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineScheduler::ProcessTask);
 
 			bool bTaskProcessed = true;
 
+			// Run the task's HAPI calls in the session it was issued for
+			FHoudiniScopedSession ScopedSession(Task.SessionIndex);
+
 			switch (Task.TaskType)
 			{
 				case EHoudiniEngineTaskType::AssetInstantiation:
@@ -521,13 +536,14 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 			}
 
 			if (!bTaskProcessed)
-				break;
+				HOUDINI_LOG_WARNING(TEXT("Houdini Engine Scheduler: ignoring task with an unknown type."));
 		}
 
 		if (FPlatformProcess::SupportsMultithreading())
 		{
-			// We want to yield for a bit.
-			FPlatformProcess::SleepNoStats(UpdateFrequency);
+			// Sleep until a new task is added.
+			if (!bStopping && TaskAddedEvent)
+				TaskAddedEvent->Wait();
 		}
 		else
 		{
@@ -591,64 +607,27 @@ FHoudiniEngineScheduler::TaskProccessAsset(const FHoudiniEngineTask & Task)
 
 bool FHoudiniEngineScheduler::HasPendingTasks()
 {
-	FScopeLock ScopeLock(&CriticalSection);
-	return (PositionWrite != PositionRead);
+	return QueuedTaskCount.GetValue() > 0;
 }
 
 void
 FHoudiniEngineScheduler::AddTask(const FHoudiniEngineTask & Task)
 {
-	FScopeLock ScopeLock(&CriticalSection);
-
-	// Check if we need to grow our circular buffer.
-	if (PositionWrite + 1 == PositionRead)
-	{
-		// Calculate next size (next power of two).
-		uint32 NextTaskCount = FPlatformMath::RoundUpToPowerOfTwo(TaskCount + 1);
-
-		// Allocate new buffer.
-		FHoudiniEngineTask * Buffer = static_cast<FHoudiniEngineTask *>(
-			FMemory::Malloc(NextTaskCount * sizeof(FHoudiniEngineTask)));
-
-		if (!Buffer)
-			return;
-
-		// Zero memory.
-		FMemory::Memset(Buffer, 0x0, NextTaskCount * sizeof(FHoudiniEngineTask));
+	FHoudiniEngineTask QueuedTask = Task;
+	QueuedTask.QueuedTime = FPlatformTime::Seconds();
 
-		// Copy elements from old buffer to new one.
-		if (PositionRead < PositionWrite)
-		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (PositionWrite - PositionRead));
-
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = PositionWrite - PositionRead;
-		}
-		else
-		{
-			FMemory::Memcpy(Buffer, Tasks + PositionRead, sizeof(FHoudiniEngineTask) * (TaskCount - PositionRead));
-			FMemory::Memcpy(Buffer + TaskCount - PositionRead, Tasks, sizeof(FHoudiniEngineTask) * PositionWrite);
-
-			// Update index positions.
-			PositionRead = 0;
-			PositionWrite = TaskCount - PositionRead + PositionWrite;
-		}
-
-		// Deallocate old buffer.
-		FMemory::Free(Tasks);
-
-		// Bookkeeping.
-		Tasks = Buffer;
-		TaskCount = NextTaskCount;
-	}
+	// Count the task before it can be dequeued so the depth never goes negative
+	const int32 QueueDepth = QueuedTaskCount.Increment();
+	TRACE_COUNTER_SET(HoudiniSchedulerQueueDepth, QueueDepth);
 
-	// Store task.
-	Tasks[PositionWrite] = Task;
-	PositionWrite++;
+	if (QueuedTask.Priority == EHoudiniEngineTaskPriority::High)
+		HighPriorityTasks.Enqueue(MoveTemp(QueuedTask));
+	else
+		NormalPriorityTasks.Enqueue(MoveTemp(QueuedTask));
 
-	// Wrap around if required.
-	PositionWrite &= (TaskCount - 1);
+	// Wake up the scheduler thread so the task starts immediately
+	if (TaskAddedEvent)
+		TaskAddedEvent->Trigger();
 }
 
 uint32
@@ -662,6 +641,10 @@ void
 FHoudiniEngineScheduler::Stop()
 {
 	bStopping = true;
+
+	// Wake up the thread so it can exit
+	if (TaskAddedEvent)
+		TaskAddedEvent->Trigger();
 }
 
 void
@@ -30,8 +30,13 @@
 #include "HoudiniEngineTaskInfo.h"
 #include "HAL/Runnable.h"
 #include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Containers/Queue.h"
 #include "Misc/SingleThreadRunnable.h"
 
+class FEvent;
+
 class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
 {
 public:
@@ -47,11 +52,18 @@ public:
 	// FSingleThreadRunnable methods.
 	virtual void Tick() override;
 
-	// Adds a task.
+	// Adds a task, and wakes up the scheduler thread.
+	// Thread safe, can be called from multiple producers.
 	void AddTask(const FHoudiniEngineTask & Task);
 
 	bool HasPendingTasks();
 
+	// Number of tasks waiting to be processed.
+	int32 GetQueueDepth() const { return QueuedTaskCount.GetValue(); };
+
+	// Time spent by the processed tasks in the queue, in seconds.
+	void GetTaskWaitTimes(double& OutAverageWaitTime, double& OutMaxWaitTime);
+
 	// Adds instantiation response task info.
 	void AddResponseTaskInfo(
 		HAPI_Result Result, 
@@ -73,6 +85,9 @@ protected:
 	// Process queued tasks. 
 	void ProcessQueuedTasks();
 
+	// Pops the next task, high priority tasks first.
+	bool DequeueTask(FHoudiniEngineTask & OutTask);
+
 	// Task : instantiate an asset. 
 	void TaskInstantiateAsset(const FHoudiniEngineTask & Task);
 
@@ -93,27 +108,25 @@ protected:
 
 private:
 
-	// Initial number of tasks in our circular queue. 
-	static const uint32 InitialTaskSize;
-
-	// Frequency update (sleep time between each update)
+	// Frequency update (sleep time between each cook status poll)
 	static const float UpdateFrequency;
 
-	// Synchronization primitive. 
-	FCriticalSection CriticalSection;
-
-	// List of scheduled tasks. 
-	FHoudiniEngineTask* Tasks;
+	// Lock-free queues of scheduled tasks, one per priority.
+	TQueue<FHoudiniEngineTask, EQueueMode::Mpsc> HighPriorityTasks;
+	TQueue<FHoudiniEngineTask, EQueueMode::Mpsc> NormalPriorityTasks;
 
-	// Head of the circular queue. 
-	uint32 PositionWrite;
+	// Number of tasks currently in the queues.
+	FThreadSafeCounter QueuedTaskCount;
 
-	// Tail of the circular queue. 
-	uint32 PositionRead;
+	// Triggered when a task is added or when stopping.
+	FEvent* TaskAddedEvent;
 
-	// Size of the circular queue. 
-	uint32 TaskCount;
+	// Wait time statistics.
+	FCriticalSection StatsCriticalSection;
+	int64 ProcessedTaskCount;
+	double TotalTaskWaitTime;
+	double MaxTaskWaitTime;
 
 	// Stopping flag. 
-	bool bStopping;
+	FThreadSafeBool bStopping;
 };
@@ -29,9 +29,16 @@
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniEngineRuntime.h"
+
+#include "Misc/ScopeLock.h"
 
 #include <vector>
 
+TMap<int64, FString> FHoudiniEngineString::CachedStrings;
+FCriticalSection FHoudiniEngineString::CachedStringsLock;
+uint32 FHoudiniEngineString::CachedStringsGeneration = 0;
+
 FHoudiniEngineString::FHoudiniEngineString()
 	: StringId(-1)
 {}
@@ -89,6 +96,19 @@ FHoudiniEngineString::ToStdString(std::string& String) const
 		return false;
 	}		
 
+	FString CachedString;
+	if (FindCachedString(StringId, CachedString))
+	{
+		String = TCHAR_TO_UTF8(*CachedString);
+		return true;
+	}
+
+	uint32 Generation = 0;
+	{
+		FScopeLock ScopeLock(&CachedStringsLock);
+		Generation = CachedStringsGeneration;
+	}
+
 	int32 NameLength = 0;
 	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBufLength(
 		FHoudiniEngine::Get().GetSession(), StringId, &NameLength))
@@ -109,6 +129,13 @@ FHoudiniEngineString::ToStdString(std::string& String) const
 
 	String = std::string(NameBuffer.begin(), NameBuffer.end());
 
+	{
+		// Don't cache the string if the cache was cleared (ie. by a cook) while we were resolving it
+		FScopeLock ScopeLock(&CachedStringsLock);
+		if (Generation == CachedStringsGeneration)
+			CachedStrings.Add(GetCacheKey(StringId), UTF8_TO_TCHAR(String.c_str()));
+	}
+
 	return true;
 }
 
@@ -130,8 +157,10 @@ bool
 FHoudiniEngineString::ToFString(FString& String) const
 {
 	String = TEXT("");
-	std::string NamePlain = "";
+	if (StringId > 0 && FindCachedString(StringId, String))
+		return true;
 
+	std::string NamePlain = "";
 	if (ToStdString(NamePlain))
 	{
 		String = UTF8_TO_TCHAR(NamePlain.c_str());
@@ -196,15 +225,65 @@ FHoudiniEngineString::SHArrayToFStringArray(const TArray<int32>& InStringIdArray
 bool
 FHoudiniEngineString::SHArrayToFStringArray_Batch(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray)
 {
-	bool bReturn = true;
 	OutStringArray.SetNumZeroed(InStringIdArray.Num());
 
+	// Only the handles that aren't in the cache yet need to be sent to HAPI
+	TMap<int32, FString> ResolvedStrings;
+	if (!ResolveStringHandles(InStringIdArray, &ResolvedStrings))
+		return false;
+
+	// Fill the output array with the resolved strings, the cache may have been cleared since
+	for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
+	{
+		// Null/invalid handles are considered empty strings
+		if (InStringIdArray[IdxSH] <= 0)
+			continue;
+
+		const FString* FoundString = ResolvedStrings.Find(InStringIdArray[IdxSH]);
+		if (!FoundString)
+			return false;
+
+		// Already resolved earlier, copy the string instead of calling HAPI.
+		OutStringArray[IdxSH] = *FoundString;
+	}
+
+	return true;
+}
+
+bool
+FHoudiniEngineString::ResolveStringHandles(const TArray<int32>& InStringIdArray, TMap<int32, FString>* OutResolvedStrings)
+{
+	// Gather the unique handles that still need to be resolved
 	TArray<int32> UniqueSH;
-	for (const auto& CurrentSH : InStringIdArray)
+	uint32 Generation = 0;
 	{
-		UniqueSH.AddUnique(CurrentSH);
+		TSet<int32> SeenSH;
+		SeenSH.Reserve(InStringIdArray.Num());
+
+		FScopeLock ScopeLock(&CachedStringsLock);
+		Generation = CachedStringsGeneration;
+		for (const auto& CurrentSH : InStringIdArray)
+		{
+			if (CurrentSH <= 0)
+				continue;
+
+			bool bAlreadySeen = false;
+			SeenSH.Add(CurrentSH, &bAlreadySeen);
+			if (bAlreadySeen)
+				continue;
+
+			const FString* FoundString = CachedStrings.Find(GetCacheKey(CurrentSH));
+			if (!FoundString)
+				UniqueSH.Add(CurrentSH);
+			else if (OutResolvedStrings)
+				OutResolvedStrings->Add(CurrentSH, *FoundString);
+		}
 	}
 
+	// Everything has already been resolved
+	if (UniqueSH.Num() <= 0)
+		return true;
+
 	int32 BufferSize = 0;
 	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatchSize(
 		FHoudiniEngine::Get().GetSession(), UniqueSH.GetData(), UniqueSH.Num(), &BufferSize))
@@ -220,6 +299,7 @@ FHoudiniEngineString::SHArrayToFStringArray_Batch(const TArray<int32>& InStringI
 
 	// Parse the buffer to a string array
 	TArray<FString> ConvertedString;
+	ConvertedString.Reserve(UniqueSH.Num());
 	std::vector<char>::iterator CurrentBegin = Buffer.begin();	
 	for (std::vector<char>::iterator it = Buffer.begin(); it != Buffer.end(); it++)
 	{
@@ -236,24 +316,59 @@ FHoudiniEngineString::SHArrayToFStringArray_Batch(const TArray<int32>& InStringI
 	if (ConvertedString.Num() != UniqueSH.Num())
 		return false;
 
-	// Build a map to map string handles to indices
-	TMap<HAPI_StringHandle, int32> SHToIndexMap;
+	if (OutResolvedStrings)
+	{
+		for (int32 Idx = 0; Idx < UniqueSH.Num(); Idx++)
+			OutResolvedStrings->Add(UniqueSH[Idx], ConvertedString[Idx]);
+	}
+
+	// Add the new strings to the cache, unless it was cleared (ie. by a cook) while we were resolving them
+	FScopeLock ScopeLock(&CachedStringsLock);
+	if (Generation != CachedStringsGeneration)
+		return true;
+
 	for (int32 Idx = 0; Idx < UniqueSH.Num(); Idx++)
-		SHToIndexMap.Add(UniqueSH[Idx], Idx);
+		CachedStrings.Add(GetCacheKey(UniqueSH[Idx]), MoveTemp(ConvertedString[Idx]));
 
-	// Fill the output array using the map
-	for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
-	{
-		const int32* FoundIndex = SHToIndexMap.Find(InStringIdArray[IdxSH]);
-		if (!FoundIndex || !ConvertedString.IsValidIndex(*FoundIndex))
-			return false;
+	return true;
+}
 
-		// Already resolved earlier, copy the string instead of calling HAPI.
-		OutStringArray[IdxSH] = ConvertedString[*FoundIndex];
-	}
+bool
+FHoudiniEngineString::FindCachedString(const int32& InStringId, FString& OutString)
+{
+	FScopeLock ScopeLock(&CachedStringsLock);
+	const FString* FoundString = CachedStrings.Find(GetCacheKey(InStringId));
+	if (!FoundString)
+		return false;
 
+	OutString = *FoundString;
 	return true;
 }
+
+int64
+FHoudiniEngineString::GetCacheKey(const int32& InStringId)
+{
+	return ((int64)FHoudiniEngineRuntime::GetCurrentSessionIndex() << 32) | (uint32)InStringId;
+}
+
+void
+FHoudiniEngineString::ClearStringCache(const int32& InSessionIndex)
+{
+	FScopeLock ScopeLock(&CachedStringsLock);
+	CachedStringsGeneration++;
+	if (InSessionIndex < 0)
+	{
+		CachedStrings.Empty();
+		return;
+	}
+
+	for (auto Iter = CachedStrings.CreateIterator(); Iter; ++Iter)
+	{
+		if ((int32)(Iter.Key() >> 32) == InSessionIndex)
+			Iter.RemoveCurrent();
+	}
+}
+
 bool
 FHoudiniEngineString::SHArrayToFStringArray_Singles(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray)
 {
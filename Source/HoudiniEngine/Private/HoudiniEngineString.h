@@ -28,6 +28,7 @@
 
 #include <string>
 #include "HoudiniApi.h"
+#include "HAL/CriticalSection.h"
 
 class FText;
 class FString;
@@ -67,6 +68,14 @@ class HOUDINIENGINE_API FHoudiniEngineString
 		// Array converter, uses a map to reduce HAPI calls
 		static bool SHArrayToFStringArray_Singles(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray);
 
+		// Resolves all the handles that are not in the string cache yet with a single string batch.
+		// If OutResolvedStrings is given, it receives the strings of all the valid handles.
+		static bool ResolveStringHandles(const TArray<int32>& InStringIdArray, TMap<int32, FString>* OutResolvedStrings = nullptr);
+
+		// Empties the string cache of a session, must be called whenever its string handles might have been
+		// invalidated (session change, cooks, geo commits...). A negative session index clears all the sessions.
+		static void ClearStringCache(const int32& InSessionIndex = -1);
+
 		// Return id of this string.
 		int32 GetId() const;
 
@@ -75,6 +84,18 @@ class HOUDINIENGINE_API FHoudiniEngineString
 
 	protected:
 
+		// Looks for a handle in the string cache
+		static bool FindCachedString(const int32& InStringId, FString& OutString);
+
+		// String handles are only unique within a session, combine them with the current session index
+		static int64 GetCacheKey(const int32& InStringId);
+
 		// Id of the underlying Houdini Engine string.
 		int32 StringId;
+
+		// Cache of the strings already resolved, by session and handle
+		static TMap<int64, FString> CachedStrings;
+		static FCriticalSection CachedStringsLock;
+		// Incremented when the cache is cleared, so strings resolved before a clear aren't added back
+		static uint32 CachedStringsGeneration;
 };
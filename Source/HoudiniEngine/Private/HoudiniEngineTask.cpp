@@ -36,6 +36,9 @@ FHoudiniEngineTask::FHoudiniEngineTask()
 	, bOutputTemplateGeos(false)
 	, AssetLibraryId(-1)
 	, AssetHapiName(-1)
+	, SessionIndex(-1)
+	, Priority(EHoudiniEngineTaskPriority::Normal)
+	, QueuedTime(0.0)
 {
 	HapiGUID.Invalidate();
 	OtherNodeIds.Empty();
@@ -50,6 +53,9 @@ FHoudiniEngineTask::FHoudiniEngineTask(EHoudiniEngineTaskType InTaskType, FGuid
 	, bOutputTemplateGeos(false)
 	, AssetLibraryId(-1)
 	, AssetHapiName(-1)
+	, SessionIndex(-1)
+	, Priority(EHoudiniEngineTaskPriority::Normal)
+	, QueuedTime(0.0)
 {
 	OtherNodeIds.Empty();
 }
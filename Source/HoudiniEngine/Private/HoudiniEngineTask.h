@@ -68,6 +68,16 @@ enum class EHoudiniEngineTaskType : uint8
 	AssetProcess,
 };
 
+// Tasks with a higher priority are processed first by the scheduler.
+enum class EHoudiniEngineTaskPriority : uint8
+{
+	// Background cooks.
+	Normal,
+
+	// Tasks for HDAs the user is interacting with (selected).
+	High,
+};
+
 struct HOUDINIENGINE_API FHoudiniEngineTask
 {
 	// Constructors.
@@ -104,6 +114,15 @@ struct HOUDINIENGINE_API FHoudiniEngineTask
 	// HAPI name of the asset.
 	int32 AssetHapiName;
 
+	// Index of the pooled session the task runs in (-1 for the caller's current session).
+	int32 SessionIndex;
+
+	// Scheduling priority.
+	EHoudiniEngineTaskPriority Priority;
+
+	// Time at which the task was queued, used for the scheduler's wait time metrics.
+	double QueuedTime;
+
 	// Is set to true if component has been loaded.
 	//bool bLoadedComponent;
 };
@@ -44,6 +44,7 @@
 #include "HoudiniEngine.h"
 #include "HoudiniAsset.h"
 #include "HoudiniAssetActor.h"
+#include "HoudiniAttributeInfoCache.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniGenericAttribute.h"
@@ -3474,27 +3475,8 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 	int32 OriginalTupleSize = InTupleSize;
 
 	HAPI_AttributeInfo AttributeInfo;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
-	{
-		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
-		{
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
-
-			if (AttributeInfo.exists)
-				break;
-		}
-	}
-	else
-	{
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(), 
-			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
-	}
+	if (!FHoudiniEngineUtils::HapiGetAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+		return false;
 
 	if (!AttributeInfo.exists)
 		return false;
@@ -3609,27 +3591,8 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
 	int32 OriginalTupleSize = InTupleSize;
 
 	HAPI_AttributeInfo AttributeInfo;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
-	{
-		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
-		{
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
-
-			if (AttributeInfo.exists)
-				break;
-		}
-	}
-	else
-	{
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
-	}
+	if (!FHoudiniEngineUtils::HapiGetAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+		return false;
 
 	if (!AttributeInfo.exists)
 		return false;
@@ -3744,27 +3707,8 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
 	int32 OriginalTupleSize = InTupleSize;
 
 	HAPI_AttributeInfo AttributeInfo;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
-	{
-		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
-		{
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-				FHoudiniEngine::Get().GetSession(),
-				InGeoId, InPartId, InAttribName,
-				(HAPI_AttributeOwner)AttrIdx, &AttributeInfo), false);
-
-			if (AttributeInfo.exists)
-				break;
-		}
-	}
-	else
-	{
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			InGeoId, InPartId, InAttribName,
-			InOwner, &AttributeInfo), false);
-	}
+	if (!FHoudiniEngineUtils::HapiGetAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, AttributeInfo))
+		return false;
 
 	if (!AttributeInfo.exists)
 		return false;
@@ -3898,11 +3842,53 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsStringFromInfo(
 }
 
 
+bool
+FHoudiniEngineUtils::HapiGetAttributeInfo(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char * InAttribName,
+	const HAPI_AttributeOwner& InOwner,
+	HAPI_AttributeInfo& OutAttributeInfo)
+{
+	// Use the cook cache if possible
+	if (FHoudiniAttributeInfoCache::GetAttributeInfo(InGeoId, InPartId, InAttribName, InOwner, OutAttributeInfo))
+		return true;
+
+	FHoudiniApi::AttributeInfo_Init(&OutAttributeInfo);
+	if (InOwner == HAPI_ATTROWNER_INVALID)
+	{
+		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
+		{
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
+				FHoudiniEngine::Get().GetSession(),
+				InGeoId, InPartId, InAttribName,
+				(HAPI_AttributeOwner)AttrIdx, &OutAttributeInfo), false);
+
+			if (OutAttributeInfo.exists)
+				break;
+		}
+	}
+	else
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoId, InPartId, InAttribName,
+			InOwner, &OutAttributeInfo), false);
+	}
+
+	return true;
+}
+
 bool
 FHoudiniEngineUtils::HapiCheckAttributeExists(
 	const HAPI_NodeId& GeoId, const HAPI_PartId& PartId,
 	const char * AttribName, HAPI_AttributeOwner Owner)
 {
+	// Use the cook cache if possible
+	bool bExists = false;
+	if (FHoudiniAttributeInfoCache::HasAttribute(GeoId, PartId, AttribName, Owner, bExists))
+		return bExists;
+
 	if (Owner == HAPI_ATTROWNER_INVALID)
 	{
 		for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
@@ -5455,7 +5441,8 @@ FHoudiniEngineUtils::AddLevelPathAttribute(
 	const HAPI_NodeId& InNodeId,
 	const HAPI_PartId& InPartId,
 	ULevel* InLevel,
-	const int32& InCount)
+	const int32& InCount,
+	const HAPI_AttributeOwner& InAttributeOwner)
 {
 	if (InNodeId < 0 || InCount <= 0)
 		return false;
@@ -5480,7 +5467,7 @@ FHoudiniEngineUtils::AddLevelPathAttribute(
 	AttributeInfoLevelPath.count = InCount;
 	AttributeInfoLevelPath.tupleSize = 1;
 	AttributeInfoLevelPath.exists = true;
-	AttributeInfoLevelPath.owner = HAPI_ATTROWNER_PRIM;
+	AttributeInfoLevelPath.owner = InAttributeOwner;
 	AttributeInfoLevelPath.storage = HAPI_STORAGETYPE_STRING;
 	AttributeInfoLevelPath.originalOwner = HAPI_ATTROWNER_INVALID;
 
@@ -5525,7 +5512,8 @@ FHoudiniEngineUtils::AddActorPathAttribute(
 	const HAPI_NodeId& InNodeId,
 	const HAPI_PartId& InPartId,
 	AActor* InActor,
-	const int32& InCount)
+	const int32& InCount,
+	const HAPI_AttributeOwner& InAttributeOwner)
 {
 	if (InNodeId < 0 || InCount <= 0)
 		return false;
@@ -5545,7 +5533,7 @@ FHoudiniEngineUtils::AddActorPathAttribute(
 	AttributeInfoActorPath.count = InCount;
 	AttributeInfoActorPath.tupleSize = 1;
 	AttributeInfoActorPath.exists = true;
-	AttributeInfoActorPath.owner = HAPI_ATTROWNER_PRIM;
+	AttributeInfoActorPath.owner = InAttributeOwner;
 	AttributeInfoActorPath.storage = HAPI_STORAGETYPE_STRING;
 	AttributeInfoActorPath.originalOwner = HAPI_ATTROWNER_INVALID;
 
@@ -6072,6 +6060,9 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 	if (InNodeId < 0)
 		return false;
 
+	// Any attribute info cached for this node will be stale after the cook
+	FHoudiniAttributeInfoCache::InvalidateNode(InNodeId);
+
 	// No Cook Options were specified, use the default one
 	if (InCookOptions == nullptr)
 	{
@@ -6087,6 +6078,10 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 			FHoudiniEngine::Get().GetSession(), InNodeId, InCookOptions), false);
 	}
 
+	// The string handles cached for this session might not survive the cook
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	FHoudiniEngineString::ClearStringCache(SessionIndex);
+
 	// If we don't need to wait for completion, return now
 	if (!bWaitForCompletion)
 		return true;
@@ -6100,6 +6095,10 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 		HOUDINI_CHECK_ERROR_GET(&Result, FHoudiniApi::GetStatus(
 			FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status));
 
+		// Drop the strings that were cached while the cook was running
+		if (Status == HAPI_STATE_READY || Status == HAPI_STATE_READY_WITH_FATAL_ERRORS || Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
+			FHoudiniEngineString::ClearStringCache(SessionIndex);
+
 		if (Status == HAPI_STATE_READY)
 		{
 			// The cook has been successful.
@@ -6118,4 +6117,12 @@ FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions*
 	}
 }
 
+HAPI_Result
+FHoudiniEngineUtils::HapiCommitGeo(const HAPI_NodeId& InNodeId)
+{
+	const HAPI_Result Result = FHoudiniApi::CommitGeo(FHoudiniEngine::Get().GetSession(), InNodeId);
+	FHoudiniEngineString::ClearStringCache(FHoudiniEngineRuntime::GetCurrentSessionIndex());
+	return Result;
+}
+
 #undef LOCTEXT_NAMESPACE
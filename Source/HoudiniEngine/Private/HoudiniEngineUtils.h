@@ -70,6 +70,9 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		// if bWaitForCompletion is true, this call will be blocking until the cook is finished
 		static bool HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions* InCookOptions = nullptr, const bool& bWaitForCompletion = false);
 
+		// Commits the geo of an input node, committing cooks the node so the current session's cached strings are cleared
+		static HAPI_Result HapiCommitGeo(const HAPI_NodeId& InNodeId);
+
 		// Return a specified HAPI status string.
 		static const FString GetStatusString(HAPI_StatusType status_type, HAPI_StatusVerbosity verbosity);
 
@@ -207,6 +210,15 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			int32& FirstValidPrim,
 			const bool& isPackedPrim);
 
+		// HAPI : Get the attribute info for the given owner, or for the first owner that has the attribute.
+		// Uses the attribute info cache when the node has been cooked and validated.
+		static bool HapiGetAttributeInfo(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const char * InAttribName,
+			const HAPI_AttributeOwner& InOwner,
+			HAPI_AttributeInfo& OutAttributeInfo);
+
 		// HAPI : Get attribute data as float.
 		static bool HapiGetAttributeDataAsFloat(
 			const HAPI_NodeId& InGeoId,
@@ -529,19 +541,21 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			const int32& InStart = 0,
 			const int32& InCount = -1);
 
-		// Adds the "unreal_level_path" primitive attribute
+		// Adds the "unreal_level_path" attribute (primitive by default)
 		static bool AddLevelPathAttribute(
 			const HAPI_NodeId& InNodeId,
 			const HAPI_PartId& InPartId,
 			ULevel* InLevel,
-			const int32& InCount);
+			const int32& InCount,
+			const HAPI_AttributeOwner& InAttributeOwner = HAPI_ATTROWNER_PRIM);
 
-		// Adds the "unreal_actor_path" primitive attribute
+		// Adds the "unreal_actor_path" attribute (primitive by default)
 		static bool AddActorPathAttribute(
 			const HAPI_NodeId& InNodeId,
 			const HAPI_PartId& InPartId,
 			AActor* InActor,
-			const int32& InCount);
+			const int32& InCount,
+			const HAPI_AttributeOwner& InAttributeOwner = HAPI_ATTROWNER_PRIM);
 
 		// Helper function used to extract a const char* from a FString
 		// !! Allocates memory using malloc that will need to be freed afterwards!
@@ -370,6 +370,8 @@ void UHoudiniGeoImportCommandlet::HandleImportBGEOMessage(
 	{
 		HOUDINI_LOG_WARNING(TEXT("BGEO import failed."));
 		FHoudiniPDGImportBGEOResultMessage* Reply = new FHoudiniPDGImportBGEOResultMessage();
+		// Keep the request's ids so the manager knows which import failed
+		(*Reply) = InMessage;
 		Reply->ImportResult = EHoudiniPDGImportBGEOResult::HPIBR_Failed;
 		PDGEndpoint->Send(Reply, InContext->GetSender());
 	}
@@ -29,6 +29,7 @@
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineString.h"
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniPackageParams.h"
@@ -785,8 +786,9 @@ UHoudiniGeoImporter::OpenBGEOFile(const FString& InBGEOFile, HAPI_NodeId& OutNod
 	FHoudiniEngine::Get().CreateTaskSlateNotification(FText::FromString(Notification), true);
 
 	// Create a file SOP
+	// Don't cook it on creation, it is cooked once the geometry has been loaded
 	HOUDINI_CHECK_ERROR_RETURN( FHoudiniEngineUtils::CreateNode(
-		-1,	"SOP/file", "bgeo", true, &OutNodeId), false);
+		-1,	"SOP/file", "bgeo", false, &OutNodeId), false);
 
 	/*
 	// Set the file path parameter
@@ -836,8 +838,9 @@ UHoudiniGeoImporter::LoadBGEOFileInHAPI(HAPI_NodeId& NodeId)
 	FHoudiniEngine::Get().CreateTaskSlateNotification(FText::FromString(Notification), true);
 
 	// Create a file SOP
+	// Don't cook it on creation, it is cooked once the geometry has been loaded
 	HOUDINI_CHECK_ERROR_RETURN( FHoudiniEngineUtils::CreateNode(
-		-1,	"SOP/file", "bgeo", true, &NodeId), false);
+		-1,	"SOP/file", "bgeo", false, &NodeId), false);
 
 	/*
 	// Set the file path parameter
@@ -866,8 +869,12 @@ UHoudiniGeoImporter::CookFileNode(const HAPI_NodeId& InNodeId)
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
 		FHoudiniEngine::Get().GetSession(), InNodeId, &CookOptions), false);
 
-	// Wait for the cook to finish
+	// Wait for the cook to finish.
+	// Most bgeo files load in a few ms, so start polling fast and back off for the long cooks,
+	// instead of sleeping a fixed half second per file.
 	int32 status = HAPI_STATE_MAX_READY_STATE + 1;
+	float SleepTime = 0.001f;
+	double LastLogTime = FPlatformTime::Seconds();
 	while (status > HAPI_STATE_MAX_READY_STATE)
 	{
 		// Retrieve the status
@@ -875,18 +882,32 @@ UHoudiniGeoImporter::CookFileNode(const HAPI_NodeId& InNodeId)
 			FHoudiniEngine::Get().GetSession(),
 			HAPI_STATUS_COOK_STATE, &status), false);
 
-		FString StatusString = FHoudiniEngineUtils::GetStatusString(HAPI_STATUS_COOK_STATE, HAPI_STATUSVERBOSITY_ERRORS);
-		HOUDINI_LOG_MESSAGE(TEXT("Still Cooking, current status: %s."), *StatusString);
+		if (status <= HAPI_STATE_MAX_READY_STATE)
+		{
+			// The string handles cached for this session might not have survived the cook
+			FHoudiniEngineString::ClearStringCache(FHoudiniEngineRuntime::GetCurrentSessionIndex());
+			break;
+		}
+
+		// Only fetch the status string once in a while, it is an extra round trip to the session
+		const double CurrentTime = FPlatformTime::Seconds();
+		if (CurrentTime - LastLogTime >= 0.5)
+		{
+			FString StatusString = FHoudiniEngineUtils::GetStatusString(HAPI_STATUS_COOK_STATE, HAPI_STATUSVERBOSITY_ERRORS);
+			HOUDINI_LOG_MESSAGE(TEXT("Still Cooking, current status: %s."), *StatusString);
+			LastLogTime = CurrentTime;
+		}
 
 		// Go to bed..
-		if (status > HAPI_STATE_MAX_READY_STATE)
-			FPlatformProcess::Sleep(0.5f);
+		FPlatformProcess::Sleep(SleepTime);
+		SleepTime = FMath::Min(SleepTime * 2.0f, 0.1f);
 	}
 
 	if (status != HAPI_STATE_READY)
 	{
 		// There was some cook errors
-		HOUDINI_LOG_ERROR(TEXT("Finished Cooking with errors!"));
+		FString StatusString = FHoudiniEngineUtils::GetStatusString(HAPI_STATUS_COOK_STATE, HAPI_STATUSVERBOSITY_ERRORS);
+		HOUDINI_LOG_ERROR(TEXT("Finished Cooking with errors: %s"), *StatusString);
 		return false;
 	}
 
@@ -61,7 +61,9 @@ public:
 		static bool CloseBGEOFile(const HAPI_NodeId& InNodeId);
 		// END: Static API
 
-		// Import the BGEO file
+		// Import the BGEO file.
+		// The file is always loaded and cooked by a file SOP in a HAPI session: there is no native bgeo reader,
+		// the output translators read their geometry from HAPI nodes.
 		bool ImportBGEOFile(const FString& InBGEOFile, UObject* InParent, const FHoudiniPackageParams* InPackageParams=nullptr);
 
 		// 1. Start a HE session if needed
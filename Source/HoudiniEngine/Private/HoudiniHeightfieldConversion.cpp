@@ -0,0 +1,227 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniHeightfieldConversion.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineParallelHeightfieldConversion(
+	TEXT("HoudiniEngine.ParallelHeightfieldConversion"),
+	1,
+	TEXT("When enabled, landscape data is converted to/from heightfield data on worker threads.\n")
+	TEXT("0: Convert the data on the calling thread.\n")
+	TEXT("1: Convert the data in parallel (default).\n")
+);
+
+// Size of the square tiles used for the transposition.
+// A 64x64 tile of floats (16KB) and its source values stay in L1.
+static const int32 HoudiniHeightfieldTileSize = 64;
+
+// Per block state for conversions that don't need one
+struct FHoudiniHeightfieldNoState {};
+
+// Per block clipping state of the height conversion
+struct FHoudiniHeightfieldClipState
+{
+	bool bClippedMin = false;
+	bool bClippedMax = false;
+};
+
+// Transposes and converts InRows x InCols values:
+// OutData[Col * InRows + Row] = Convert(InData[Row * InCols + Col], BlockState)
+// Each block of TileSize columns is processed by a single task and writes to its own output rows.
+// The task's local state is stored in OutBlockStates once the block is done.
+template<typename StateType, typename InType, typename OutType, typename ConvertFunc>
+static void
+HoudiniTransposeConvert(
+	const InType* InData, const int32& InRows, const int32& InCols,
+	OutType* OutData, TArray<StateType>& OutBlockStates, const ConvertFunc& Convert)
+{
+	const int32 NumBlocks = FMath::DivideAndRoundUp(InCols, HoudiniHeightfieldTileSize);
+	OutBlockStates.SetNum(NumBlocks);
+
+	const bool bParallel = CVarHoudiniEngineParallelHeightfieldConversion.GetValueOnAnyThread() != 0;
+	ParallelFor(NumBlocks, [&](int32 BlockIdx)
+	{
+		StateType BlockState = StateType();
+		const int32 ColStart = BlockIdx * HoudiniHeightfieldTileSize;
+		const int32 ColEnd = FMath::Min(ColStart + HoudiniHeightfieldTileSize, InCols);
+		for (int32 RowStart = 0; RowStart < InRows; RowStart += HoudiniHeightfieldTileSize)
+		{
+			const int32 RowEnd = FMath::Min(RowStart + HoudiniHeightfieldTileSize, InRows);
+			for (int32 Col = ColStart; Col < ColEnd; Col++)
+			{
+				const InType* InCol = InData + Col;
+				OutType* OutRow = OutData + (int64)Col * InRows;
+				for (int32 Row = RowStart; Row < RowEnd; Row++)
+				{
+					OutRow[Row] = Convert(InCol[(int64)Row * InCols], BlockState);
+				}
+			}
+		}
+		OutBlockStates[BlockIdx] = BlockState;
+	}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+void
+FHoudiniHeightfieldConversion::ConvertLandscapeHeightsToHeightfield(
+	const uint16* InData,
+	const int32& XSize, const int32& YSize,
+	const double& Offset, const double& Scale, const double& Bias,
+	float* OutValues)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniHeightfieldConversion::ConvertLandscapeHeightsToHeightfield);
+
+	if (!InData || !OutValues || XSize <= 0 || YSize <= 0)
+		return;
+
+	// There are only 65536 possible inputs, so convert each of them once with the
+	// same double precision expression and use the table for the transposition.
+	TArray<float> Table;
+	Table.SetNumUninitialized(UINT16_MAX + 1);
+	for (int32 Digit = 0; Digit <= UINT16_MAX; Digit++)
+	{
+		double DoubleValue = ((double)Digit - Offset) * Scale + Bias;
+		Table[Digit] = (float)DoubleValue;
+	}
+
+	const float* TableData = Table.GetData();
+	TArray<FHoudiniHeightfieldNoState> BlockStates;
+	HoudiniTransposeConvert(InData, YSize, XSize, OutValues, BlockStates,
+		[TableData](const uint16& InValue, FHoudiniHeightfieldNoState&) { return TableData[InValue]; });
+}
+
+void
+FHoudiniHeightfieldConversion::ConvertLandscapeLayerToHeightfield(
+	const uint8* InData,
+	const int32& XSize, const int32& YSize,
+	const double& Offset, const double& Scale, const double& Bias,
+	float* OutValues)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniHeightfieldConversion::ConvertLandscapeLayerToHeightfield);
+
+	if (!InData || !OutValues || XSize <= 0 || YSize <= 0)
+		return;
+
+	float Table[UINT8_MAX + 1];
+	for (int32 Digit = 0; Digit <= UINT8_MAX; Digit++)
+	{
+		double DoubleValue = ((double)Digit - Offset) * Scale + Bias;
+		Table[Digit] = (float)DoubleValue;
+	}
+
+	const float* TableData = Table;
+	TArray<FHoudiniHeightfieldNoState> BlockStates;
+	HoudiniTransposeConvert(InData, YSize, XSize, OutValues, BlockStates,
+		[TableData](const uint8& InValue, FHoudiniHeightfieldNoState&) { return TableData[InValue]; });
+}
+
+void
+FHoudiniHeightfieldConversion::ConvertHeightfieldToLandscapeHeights(
+	const float* InValues,
+	const int32& HoudiniXSize, const int32& HoudiniYSize,
+	const float& FloatMin, const double& ZSpacing, const double& DigitCenterOffset,
+	const double& DigitZRange,
+	const bool& bIsAdditive, const uint16& LandscapeZeroValue,
+	uint16* OutData,
+	bool& bOutClippedMin, bool& bOutClippedMax)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniHeightfieldConversion::ConvertHeightfieldToLandscapeHeights);
+
+	bOutClippedMin = false;
+	bOutClippedMax = false;
+
+	if (!InValues || !OutData || HoudiniXSize <= 0 || HoudiniYSize <= 0)
+		return;
+
+	const int32 MaxDigit = FMath::RoundToInt(DigitZRange);
+	auto Convert = [&](const float& InValue, FHoudiniHeightfieldClipState& BlockState)
+	{
+		// Get the double values in [0 - ZRange]
+		double DoubleValue = (double)InValue;
+
+		// NOTE: Additive (edit) layers should not have their values offset, but they
+		// should be scaled using the same zspacing values as the base layer on the target landscape.
+		if (!bIsAdditive)
+		{
+			DoubleValue -= (double)FloatMin;
+		}
+
+		// Then convert it to [0 - DesiredRange] and center it 
+		DoubleValue = DoubleValue * ZSpacing + DigitCenterOffset;
+
+		if (bIsAdditive)
+		{
+			DoubleValue += LandscapeZeroValue;
+		}
+		BlockState.bClippedMin = BlockState.bClippedMin || (DoubleValue < 0);
+		BlockState.bClippedMax = BlockState.bClippedMax || (DoubleValue >= DigitZRange);
+
+		const int32 IntValue = FMath::RoundToInt(DoubleValue);
+		return (uint16)FMath::Clamp(IntValue, 0, MaxDigit);
+	};
+
+	// Houdini's values are read Y then X due to the swapped X/Y
+	TArray<FHoudiniHeightfieldClipState> BlockStates;
+	HoudiniTransposeConvert(InValues, HoudiniXSize, HoudiniYSize, OutData, BlockStates, Convert);
+
+	for (const FHoudiniHeightfieldClipState& BlockState : BlockStates)
+	{
+		bOutClippedMin = bOutClippedMin || BlockState.bClippedMin;
+		bOutClippedMax = bOutClippedMax || BlockState.bClippedMax;
+	}
+}
+
+void
+FHoudiniHeightfieldConversion::ConvertHeightfieldToLandscapeLayer(
+	const float* InValues,
+	const int32& HoudiniXSize, const int32& HoudiniYSize,
+	const float& LayerMin, const float& LayerMax,
+	const double& Scale,
+	uint8* OutData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniHeightfieldConversion::ConvertHeightfieldToLandscapeLayer);
+
+	if (!InValues || !OutData || HoudiniXSize <= 0 || HoudiniYSize <= 0)
+		return;
+
+	auto Convert = [&](const float& InValue, FHoudiniHeightfieldNoState&)
+	{
+		// Get the double values in [0 - ZRange]
+		double DoubleValue = (double)FMath::Clamp(InValue, LayerMin, LayerMax) - (double)LayerMin;
+
+		// Then convert it to [0 - 255]
+		DoubleValue *= Scale;
+
+		return (uint8)FMath::RoundToInt(DoubleValue);
+	};
+
+	TArray<FHoudiniHeightfieldNoState> BlockStates;
+	HoudiniTransposeConvert(InValues, HoudiniXSize, HoudiniYSize, OutData, BlockStates, Convert);
+}
@@ -0,0 +1,76 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Conversion kernels between Unreal's landscape data (uint16 heights / uint8 layers)
+// and Houdini's heightfield volumes (float).
+// Both layouts are transposed relative to each other, so the kernels work on square tiles
+// to keep reads and writes cache friendly, and process the tiles in parallel.
+// Results are bit-identical to the original per-point double precision conversion.
+struct HOUDINIENGINE_API FHoudiniHeightfieldConversion
+{
+	public:
+
+		// Converts XSize x YSize Unreal values to Houdini's (YSize x XSize) float layout:
+		// OutValues[nX + nY * YSize] = ((double)InData[nY + nX * XSize] - Offset) * Scale + Bias
+		static void ConvertLandscapeHeightsToHeightfield(
+			const uint16* InData,
+			const int32& XSize, const int32& YSize,
+			const double& Offset, const double& Scale, const double& Bias,
+			float* OutValues);
+
+		static void ConvertLandscapeLayerToHeightfield(
+			const uint8* InData,
+			const int32& XSize, const int32& YSize,
+			const double& Offset, const double& Scale, const double& Bias,
+			float* OutValues);
+
+		// Converts Houdini's float heights to Unreal's transposed uint16 layout:
+		// Digit = ((double)Value - FloatMin) * ZSpacing + DigitCenterOffset, rounded and clamped to [0, DigitZRange].
+		// Additive values are not offset by FloatMin, but by the landscape's zero value instead.
+		// bOutClippedMin/Max indicate if any digit was < 0 or >= DigitZRange before clamping.
+		static void ConvertHeightfieldToLandscapeHeights(
+			const float* InValues,
+			const int32& HoudiniXSize, const int32& HoudiniYSize,
+			const float& FloatMin, const double& ZSpacing, const double& DigitCenterOffset,
+			const double& DigitZRange,
+			const bool& bIsAdditive, const uint16& LandscapeZeroValue,
+			uint16* OutData,
+			bool& bOutClippedMin, bool& bOutClippedMax);
+
+		// Converts Houdini's float layer values to Unreal's transposed uint8 layout:
+		// Digit = ((double)Clamp(Value, LayerMin, LayerMax) - LayerMin) * Scale, rounded.
+		static void ConvertHeightfieldToLandscapeLayer(
+			const float* InValues,
+			const int32& HoudiniXSize, const int32& HoudiniYSize,
+			const float& LayerMin, const float& LayerMax,
+			const double& Scale,
+			uint8* OutData);
+};
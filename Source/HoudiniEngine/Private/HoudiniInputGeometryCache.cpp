@@ -0,0 +1,361 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniInputGeometryCache.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "UnrealMeshTranslator.h"
+
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshSocket.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Crc.h"
+#include "StaticMeshResources.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineShareStaticMeshInputs(
+	TEXT("HoudiniEngine.ShareStaticMeshInputs"),
+	1,
+	TEXT("Share the nodes created for static mesh inputs, so each unique mesh is only uploaded once per session.\n")
+	TEXT("0: Upload the mesh for every input object.\n")
+	TEXT("1: Upload each unique mesh once, and reference it with object merge nodes (default).\n")
+);
+
+TMap<TPair<int32, FString>, FHoudiniInputGeometryCache::FSharedNode> FHoudiniInputGeometryCache::SharedNodes;
+TMap<TPair<int32, HAPI_NodeId>, FString> FHoudiniInputGeometryCache::ConsumerKeys;
+TMap<TPair<int32, HAPI_NodeId>, HAPI_NodeId> FHoudiniInputGeometryCache::ConsumerObjectNodes;
+
+bool
+FHoudiniInputGeometryCache::IsEnabled()
+{
+	return CVarHoudiniEngineShareStaticMeshInputs.GetValueOnAnyThread() != 0;
+}
+
+bool
+FHoudiniInputGeometryCache::IsSharedNodeValid(const FSharedNode& InSharedNode)
+{
+	if (InSharedNode.NodeId < 0)
+		return false;
+
+	// Compare against the unique id we stored, a new node may have been given the same node id
+	bool bIsValid = false;
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::IsNodeValid(
+		FHoudiniEngine::Get().GetSession(), InSharedNode.NodeId, InSharedNode.UniqueHoudiniNodeId, &bIsValid))
+		return false;
+
+	return bIsValid;
+}
+
+bool
+FHoudiniInputGeometryCache::AcquireStaticMeshInputNode(
+	UStaticMesh* InStaticMesh,
+	HAPI_NodeId& InOutInputNodeId,
+	const FString& InInputNodeName,
+	const bool& bInExportAllLODs,
+	const bool& bInExportSockets,
+	const bool& bInExportColliders,
+	const HAPI_NodeId& InParentNodeId)
+{
+	check(IsInGameThread());
+
+	if (!IsValid(InStaticMesh))
+		return false;
+
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+	const uint32 ContentHash = GetStaticMeshContentHash(InStaticMesh, bInExportAllLODs, bInExportSockets, bInExportColliders);
+	const FString Key = FString::Printf(TEXT("%s_%08x"), *InStaticMesh->GetPathName(), ContentHash);
+	const TPair<int32, FString> SharedKey(SessionIndex, Key);
+
+	// Make sure the cached node still exists (ie, it was not deleted in the Houdini session)
+	FSharedNode* SharedNode = SharedNodes.Find(SharedKey);
+	if (SharedNode && !IsSharedNodeValid(*SharedNode))
+	{
+		for (const HAPI_NodeId& ConsumerId : SharedNode->Consumers)
+		{
+			ConsumerKeys.Remove(TPair<int32, HAPI_NodeId>(SessionIndex, ConsumerId));
+			HAPI_NodeId ConsumerObjectNodeId = -1;
+			if (ConsumerObjectNodes.RemoveAndCopyValue(TPair<int32, HAPI_NodeId>(SessionIndex, ConsumerId), ConsumerObjectNodeId))
+				ConsumerKeys.Remove(TPair<int32, HAPI_NodeId>(SessionIndex, ConsumerObjectNodeId));
+		}
+
+		SharedNodes.Remove(SharedKey);
+		SharedNode = nullptr;
+	}
+
+	if (!SharedNode)
+	{
+		// Upload the mesh in a new shared node
+		HAPI_NodeId SharedNodeId = -1;
+		if (!FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
+			InStaticMesh, SharedNodeId, TEXT("shared_") + InStaticMesh->GetName(), nullptr,
+			bInExportAllLODs, bInExportSockets, bInExportColliders))
+		{
+			return false;
+		}
+
+		HAPI_NodeInfo SharedNodeInfo;
+		FHoudiniApi::NodeInfo_Init(&SharedNodeInfo);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetNodeInfo(
+			FHoudiniEngine::Get().GetSession(), SharedNodeId, &SharedNodeInfo))
+		{
+			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(SharedNodeId, true, SessionIndex);
+			return false;
+		}
+
+		FSharedNode NewSharedNode;
+		NewSharedNode.NodeId = SharedNodeId;
+		NewSharedNode.UniqueHoudiniNodeId = SharedNodeInfo.uniqueHoudiniNodeId;
+		SharedNode = &SharedNodes.Add(SharedKey, NewSharedNode);
+	}
+
+	// On failure, delete what we created and drop the shared node if nothing references it
+	HAPI_NodeId NewNodeId = -1;
+	auto CleanUpOnFailure = [&]()
+	{
+		if (NewNodeId >= 0)
+		{
+			// Delete the object merge's own OBJ node, or just the object merge if it was created in the given one
+			const HAPI_NodeId NodeToDelete = InParentNodeId >= 0 ? NewNodeId : FHoudiniEngineUtils::HapiGetParentNodeId(NewNodeId);
+			FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), NodeToDelete >= 0 ? NodeToDelete : NewNodeId);
+		}
+
+		if (SharedNode->Consumers.Num() <= 0)
+		{
+			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(SharedNode->NodeId, true, SessionIndex);
+			SharedNodes.Remove(SharedKey);
+		}
+
+		return false;
+	};
+
+	FString SharedNodePath;
+	if (!FHoudiniEngineUtils::HapiGetAbsNodePath(SharedNode->NodeId, SharedNodePath))
+		return CleanUpOnFailure();
+
+	// Create the object merge node referencing the shared node, in its own OBJ node or in the given one
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::CreateNode(
+		InParentNodeId, InParentNodeId >= 0 ? TEXT("object_merge") : TEXT("SOP/object_merge"), InInputNodeName, false, &NewNodeId), CleanUpOnFailure());
+
+	HAPI_ParmId ParmId = -1;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmIdFromName(
+		FHoudiniEngine::Get().GetSession(), NewNodeId, "objpath1", &ParmId), CleanUpOnFailure());
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmStringValue(
+		FHoudiniEngine::Get().GetSession(), NewNodeId, TCHAR_TO_UTF8(*SharedNodePath), ParmId, 0), CleanUpOnFailure());
+
+	// Don't apply the shared node's transform, the input object sets its own on the parent OBJ
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetParmIntValue(
+		FHoudiniEngine::Get().GetSession(), NewNodeId, "xformtype", 0, 0), CleanUpOnFailure());
+
+	if (!FHoudiniEngineUtils::HapiCookNode(NewNodeId, nullptr, true))
+		return CleanUpOnFailure();
+
+	// Register the new consumer before releasing the previous node, as both may reference the same shared node
+	const HAPI_NodeId NewObjectNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(NewNodeId);
+	SharedNode->Consumers.Add(NewNodeId);
+	ConsumerKeys.Add(TPair<int32, HAPI_NodeId>(SessionIndex, NewNodeId), Key);
+	if (NewObjectNodeId >= 0)
+	{
+		ConsumerKeys.Add(TPair<int32, HAPI_NodeId>(SessionIndex, NewObjectNodeId), Key);
+		ConsumerObjectNodes.Add(TPair<int32, HAPI_NodeId>(SessionIndex, NewNodeId), NewObjectNodeId);
+	}
+
+	// We have now created a valid new input node, delete the previous one
+	const HAPI_NodeId PreviousInputNodeId = InOutInputNodeId;
+	if (PreviousInputNodeId >= 0)
+	{
+		// Get the parent OBJ node ID before deleting!
+		const HAPI_NodeId PreviousInputOBJNode = FHoudiniEngineUtils::HapiGetParentNodeId(PreviousInputNodeId);
+		ReleaseNode(PreviousInputNodeId);
+
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
+			FHoudiniEngine::Get().GetSession(), PreviousInputNodeId))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the previous input node for %s."), *InInputNodeName);
+		}
+
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
+			FHoudiniEngine::Get().GetSession(), PreviousInputOBJNode))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to cleanup the previous input OBJ node for %s."), *InInputNodeName);
+		}
+	}
+
+	InOutInputNodeId = NewNodeId;
+
+	return true;
+}
+
+void
+FHoudiniInputGeometryCache::ReleaseNode(const HAPI_NodeId& InNodeId)
+{
+	if (InNodeId < 0 || ConsumerKeys.Num() <= 0)
+		return;
+
+	const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+
+	FString Key;
+	if (!ConsumerKeys.RemoveAndCopyValue(TPair<int32, HAPI_NodeId>(SessionIndex, InNodeId), Key))
+		return;
+
+	const TPair<int32, FString> SharedKey(SessionIndex, Key);
+	FSharedNode* SharedNode = SharedNodes.Find(SharedKey);
+	if (!SharedNode)
+		return;
+
+	// The released node is either the object merge, or its parent OBJ
+	HAPI_NodeId ConsumerId = InNodeId;
+	if (!SharedNode->Consumers.Contains(ConsumerId))
+	{
+		for (const HAPI_NodeId& CurConsumerId : SharedNode->Consumers)
+		{
+			const HAPI_NodeId* ObjectNodeId = ConsumerObjectNodes.Find(TPair<int32, HAPI_NodeId>(SessionIndex, CurConsumerId));
+			if (ObjectNodeId && *ObjectNodeId == InNodeId)
+			{
+				ConsumerId = CurConsumerId;
+				break;
+			}
+		}
+	}
+
+	HAPI_NodeId ConsumerObjectNodeId = -1;
+	if (ConsumerObjectNodes.RemoveAndCopyValue(TPair<int32, HAPI_NodeId>(SessionIndex, ConsumerId), ConsumerObjectNodeId))
+		ConsumerKeys.Remove(TPair<int32, HAPI_NodeId>(SessionIndex, ConsumerObjectNodeId));
+	ConsumerKeys.Remove(TPair<int32, HAPI_NodeId>(SessionIndex, ConsumerId));
+
+	SharedNode->Consumers.Remove(ConsumerId);
+	if (SharedNode->Consumers.Num() > 0)
+		return;
+
+	// Last reference, delete the shared node and its OBJ
+	const HAPI_NodeId NodeToDelete = SharedNode->NodeId;
+	SharedNodes.Remove(SharedKey);
+	FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(NodeToDelete, true, SessionIndex);
+}
+
+void
+FHoudiniInputGeometryCache::Clear(const int32& InSessionIndex)
+{
+	if (InSessionIndex < 0)
+	{
+		SharedNodes.Empty();
+		ConsumerKeys.Empty();
+		ConsumerObjectNodes.Empty();
+		return;
+	}
+
+	for (auto Iter = SharedNodes.CreateIterator(); Iter; ++Iter)
+	{
+		if (Iter.Key().Key == InSessionIndex)
+			Iter.RemoveCurrent();
+	}
+
+	for (auto Iter = ConsumerKeys.CreateIterator(); Iter; ++Iter)
+	{
+		if (Iter.Key().Key == InSessionIndex)
+			Iter.RemoveCurrent();
+	}
+
+	for (auto Iter = ConsumerObjectNodes.CreateIterator(); Iter; ++Iter)
+	{
+		if (Iter.Key().Key == InSessionIndex)
+			Iter.RemoveCurrent();
+	}
+}
+
+uint32
+FHoudiniInputGeometryCache::GetStaticMeshContentHash(
+	UStaticMesh* InStaticMesh,
+	const bool& bInExportAllLODs,
+	const bool& bInExportSockets,
+	const bool& bInExportColliders)
+{
+	uint32 Hash = GetTypeHash(bInExportAllLODs);
+	Hash = HashCombine(Hash, GetTypeHash(bInExportSockets));
+	Hash = HashCombine(Hash, GetTypeHash(bInExportColliders));
+
+#if WITH_EDITORONLY_DATA
+	// Changes whenever the mesh is modified / rebuilt
+	Hash = HashCombine(Hash, GetTypeHash(InStaticMesh->GetLightingGuid()));
+#endif
+
+	// The exported vertex and index buffers
+	FStaticMeshRenderData* SMRenderData = InStaticMesh->GetRenderData();
+	const int32 NumLODs = SMRenderData ? (bInExportAllLODs ? SMRenderData->LODResources.Num() : FMath::Min(SMRenderData->LODResources.Num(), 1)) : 0;
+	if (SMRenderData)
+		Hash = HashCombine(Hash, GetTypeHash(SMRenderData->DerivedDataKey));
+
+	for (int32 LODIndex = 0; LODIndex < NumLODs; LODIndex++)
+	{
+		const FStaticMeshLODResources& LODResources = SMRenderData->LODResources[LODIndex];
+		const FPositionVertexBuffer& PositionBuffer = LODResources.VertexBuffers.PositionVertexBuffer;
+		const void* PositionData = PositionBuffer.GetNumVertices() > 0 ? PositionBuffer.GetVertexData() : nullptr;
+		if (PositionData)
+			Hash = FCrc::MemCrc32(PositionData, PositionBuffer.GetNumVertices() * PositionBuffer.GetStride(), Hash);
+
+		Hash = HashCombine(Hash, GetTypeHash(LODResources.GetNumVertices()));
+		Hash = HashCombine(Hash, GetTypeHash(LODResources.IndexBuffer.GetNumIndices()));
+		Hash = HashCombine(Hash, GetTypeHash(LODResources.Sections.Num()));
+		for (const FStaticMeshSection& Section : LODResources.Sections)
+			Hash = HashCombine(Hash, GetTypeHash(Section.MaterialIndex));
+	}
+
+	// Materials
+	for (const FStaticMaterial& StaticMaterial : InStaticMesh->GetStaticMaterials())
+	{
+		if (IsValid(StaticMaterial.MaterialInterface))
+			Hash = HashCombine(Hash, GetTypeHash(StaticMaterial.MaterialInterface->GetPathName()));
+	}
+
+	if (bInExportSockets)
+	{
+		for (const UStaticMeshSocket* Socket : InStaticMesh->Sockets)
+		{
+			if (!IsValid(Socket))
+				continue;
+
+			Hash = HashCombine(Hash, GetTypeHash(Socket->SocketName));
+			Hash = HashCombine(Hash, GetTypeHash(Socket->Tag));
+			Hash = HashCombine(Hash, GetTypeHash(Socket->RelativeLocation));
+			Hash = HashCombine(Hash, GetTypeHash(Socket->RelativeRotation.Vector()));
+			Hash = HashCombine(Hash, GetTypeHash(Socket->RelativeScale));
+		}
+	}
+
+	if (bInExportColliders && InStaticMesh->GetBodySetup())
+	{
+		const UBodySetup* BodySetup = InStaticMesh->GetBodySetup();
+		Hash = HashCombine(Hash, GetTypeHash(BodySetup->BodySetupGuid));
+		Hash = HashCombine(Hash, GetTypeHash(BodySetup->AggGeom.GetElementCount()));
+	}
+
+	return Hash;
+}
@@ -0,0 +1,99 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+
+#include "CoreMinimal.h"
+
+class UStaticMesh;
+
+// Session-level cache of the input nodes created for static meshes.
+// Each unique mesh (identity + content hash + export options) is uploaded once per session, in a shared node.
+// The input objects then get their own object merge node pointing to the shared node, so they keep ownership of
+// their nodes (transforms, deletion...) as if the mesh had been uploaded for them.
+// The shared nodes are reference-counted, and deleted when their last object merge node is deleted.
+struct HOUDINIENGINE_API FHoudiniInputGeometryCache
+{
+	public:
+
+		// Creates an object merge node referencing the shared node for that mesh, uploading the mesh if needed.
+		// InOutInputNodeId is updated to the object merge node, and its previous node is deleted.
+		// The object merge node is created in its own OBJ node, or in InParentNodeId if it is valid:
+		// the shared node is then released along with that OBJ node.
+		static bool AcquireStaticMeshInputNode(
+			UStaticMesh* InStaticMesh,
+			HAPI_NodeId& InOutInputNodeId,
+			const FString& InInputNodeName,
+			const bool& bInExportAllLODs,
+			const bool& bInExportSockets,
+			const bool& bInExportColliders,
+			const HAPI_NodeId& InParentNodeId = -1);
+
+		// Must be called when a node of the current session is deleted.
+		// If it is one of the object merge nodes (or its parent OBJ), its shared node is released.
+		static void ReleaseNode(const HAPI_NodeId& InNodeId);
+
+		// Forgets all the shared nodes of a session, without deleting them (ie. when the session is lost / stopped).
+		// A negative session index clears all the sessions.
+		static void Clear(const int32& InSessionIndex = -1);
+
+		// Indicates if the static mesh inputs should be shared
+		static bool IsEnabled();
+
+	protected:
+
+		// Returns the hash of the static mesh's content that is exported to Houdini
+		static uint32 GetStaticMeshContentHash(
+			UStaticMesh* InStaticMesh,
+			const bool& bInExportAllLODs,
+			const bool& bInExportSockets,
+			const bool& bInExportColliders);
+
+		struct FSharedNode
+		{
+			// The shared node
+			HAPI_NodeId NodeId = -1;
+			// Houdini's unique id for the shared node, node ids can be reused once a node is deleted
+			int32 UniqueHoudiniNodeId = -1;
+			// Object merge nodes referencing the shared node
+			TSet<HAPI_NodeId> Consumers;
+		};
+
+		// Indicates if the shared node still exists in the current session
+		static bool IsSharedNodeValid(const FSharedNode& InSharedNode);
+
+		// (Session index, mesh path + content hash) -> shared node
+		static TMap<TPair<int32, FString>, FSharedNode> SharedNodes;
+
+		// (Session index, object merge node or its parent OBJ) -> shared node key
+		static TMap<TPair<int32, HAPI_NodeId>, FString> ConsumerKeys;
+
+		// Object merge node -> its parent OBJ, used to release both keys at once
+		static TMap<TPair<int32, HAPI_NodeId>, HAPI_NodeId> ConsumerObjectNodes;
+};
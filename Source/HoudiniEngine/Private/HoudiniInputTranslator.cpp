@@ -44,6 +44,7 @@
 #include "UnrealBrushTranslator.h"
 #include "UnrealSplineTranslator.h"
 #include "UnrealMeshTranslator.h"
+#include "HoudiniInputGeometryCache.h"
 #include "UnrealInstanceTranslator.h"
 #include "UnrealLandscapeTranslator.h"
 #include "UnrealFoliageTypeTranslator.h"
@@ -71,9 +72,17 @@
 #include "HCsgUtils.h"
 #include "LandscapeInfo.h"
 #include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineInputPrefetchObjects(
+	TEXT("HoudiniEngine.InputPrefetchObjects"),
+	8,
+	TEXT("Number of input objects whose mesh data is extracted on worker threads ahead of their upload to Houdini.\n")
+	TEXT("0: Extract each object's data when uploading it.\n")
+);
+
 #if WITH_EDITOR
 // Allows checking of objects currently being dragged around
 struct FHoudiniMoveTracker
@@ -470,12 +479,14 @@ FHoudiniInputTranslator::DestroyInputNodes(UHoudiniInput* InputToDestroy, const
 
 			if (CurInputObject->InputNodeId >= 0)
 			{
+				FHoudiniInputGeometryCache::ReleaseNode(CurInputObject->InputNodeId);
 				FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), CurInputObject->InputNodeId);
 				CurInputObject->InputNodeId = -1;
 			}
 
 			if(CurInputObject->InputObjectNodeId >= 0)
 			{
+				FHoudiniInputGeometryCache::ReleaseNode(CurInputObject->InputObjectNodeId);
 				FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), CurInputObject->InputObjectNodeId);
 				CurInputObject->InputObjectNodeId = -1;
 
@@ -502,6 +513,19 @@ FHoudiniInputTranslator::DestroyInputNodes(UHoudiniInput* InputToDestroy, const
 		}
 	}
 
+	// Destroy the consolidated world input node and its OBJ
+	if (InputToDestroy->GetConsolidatedInputNodeId() >= 0)
+	{
+		HAPI_NodeId ConsolidatedOBJNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(InputToDestroy->GetConsolidatedInputNodeId());
+		if (FHoudiniEngineUtils::IsHoudiniNodeValid(ConsolidatedOBJNodeId))
+		{
+			FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), ConsolidatedOBJNodeId);
+			CreatedInputDataAssetIds.Remove(ConsolidatedOBJNodeId);
+		}
+
+		InputToDestroy->SetConsolidatedInputNodeId(-1, 0);
+	}
+
 	// Destroy all the input assets
 	for (HAPI_NodeId AssetNodeId : CreatedInputDataAssetIds)
 	{
@@ -1024,37 +1048,79 @@ FHoudiniInputTranslator::UploadInputData(UHoudiniInput* InInput, const FTransfor
 	if (!ensure(InputObjectsArray))
 		return false;
 
+	// Remember which session the input's nodes are created in so they can be deleted there later
+	InInput->SetSessionIndex(FHoudiniEngineRuntime::GetCurrentSessionIndex());
+
 	// Iterate on all the input objects and see if they need to be uploaded
 	bool bSuccess = true;
 	TArray<int32> CreatedNodeIds;
-	TArray<int32> ValidNodeIds;
-	TArray<UHoudiniInputObject*> ChangedInputObjects;
+	TArray<TArray<int32>> ValidNodeIds;
+	TArray<TArray<UHoudiniInputObject*>> ChangedInputObjects;
+	TArray<UHoudiniInputObject*> AllChangedInputObjects;
+	ValidNodeIds.SetNum(InputObjectsArray->Num());
+	ChangedInputObjects.SetNum(InputObjectsArray->Num());
 	for (int32 ObjIdx = 0; ObjIdx < InputObjectsArray->Num(); ObjIdx++)
 	{
 		UHoudiniInputObject* CurrentInputObject = (*InputObjectsArray)[ObjIdx];
 		if (!IsValid(CurrentInputObject))
 			continue;
 
-		ValidNodeIds.Reset();
-		ChangedInputObjects.Reset();
 		// The input object could have child objects: GetChangedObjectsAndValidNodes finds if the object itself or
 		// any its children has changed, and also returns the NodeIds of those objects that are still valid and
 		// unchanged
-		CurrentInputObject->GetChangedObjectsAndValidNodes(ChangedInputObjects, ValidNodeIds);
+		CurrentInputObject->GetChangedObjectsAndValidNodes(ChangedInputObjects[ObjIdx], ValidNodeIds[ObjIdx]);
+		AllChangedInputObjects.Append(ChangedInputObjects[ObjIdx]);
+	}
 
+	// The changed objects' mesh data is extracted on worker threads, a few objects ahead of the one being uploaded,
+	// so that the extraction overlaps with the session I/O
+	const int32 NumObjectsToPrefetch = CVarHoudiniEngineInputPrefetchObjects.GetValueOnGameThread();
+	int32 NumPrefetchedObjects = 0;
+	int32 NumUploadedObjects = 0;
+	for (int32 ObjIdx = 0; ObjIdx < InputObjectsArray->Num(); ObjIdx++)
+	{
 		// Keep track of the node ids for unchanged objects that already exist
-		if (ValidNodeIds.Num() > 0)
-			CreatedNodeIds.Append(ValidNodeIds);
+		if (ValidNodeIds[ObjIdx].Num() > 0)
+			CreatedNodeIds.Append(ValidNodeIds[ObjIdx]);
 
 		// Upload the changed input objects
-		for (UHoudiniInputObject* ChangedInputObject : ChangedInputObjects)
+		for (UHoudiniInputObject* ChangedInputObject : ChangedInputObjects[ObjIdx])
 		{
+			// Start extracting the next objects while this one is uploaded.
+			// The first object is extracted when uploading it, as there is nothing to overlap with yet.
+			while (NumObjectsToPrefetch > 0
+				&& NumPrefetchedObjects < AllChangedInputObjects.Num()
+				&& NumPrefetchedObjects <= NumUploadedObjects + NumObjectsToPrefetch)
+			{
+				if (NumPrefetchedObjects > NumUploadedObjects)
+					PrefetchHoudiniInputObjectData(InInput, AllChangedInputObjects[NumPrefetchedObjects]);
+				NumPrefetchedObjects++;
+			}
+
 			// Upload the current input object to Houdini
 			if (!UploadHoudiniInputObject(InInput, ChangedInputObject, InActorTransform, CreatedNodeIds))
 				bSuccess = false;
+
+			NumUploadedObjects++;
 		}
 	}
 
+	// Discard the data that was prefetched but not used
+	FUnrealMeshTranslator::FlushPrefetchedStaticMeshLODResources();
+
+	// The static mesh components of a consolidated world input are sent merged in a single node
+	if (InInput->IsWorldInputConsolidated())
+	{
+		if (!UploadConsolidatedWorldInput(InInput, CreatedNodeIds))
+			bSuccess = false;
+	}
+	else if (InInput->GetConsolidatedInputNodeId() >= 0)
+	{
+		// The input is no longer consolidated, its merged node isn't needed anymore
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InInput->GetConsolidatedInputNodeId(), true, InInput->GetSessionIndex());
+		InInput->SetConsolidatedInputNodeId(-1, 0);
+	}
+
 	// If we haven't created any input, invalidate our input node id
 	if (CreatedNodeIds.Num() == 0)
 	{
@@ -1216,6 +1282,14 @@ FHoudiniInputTranslator::UploadInputTransform(UHoudiniInput* InInput)
 		}
 	}
 
+	// Update the merged geometry of a consolidated world input if its components have moved
+	if (InInput->IsWorldInputConsolidated())
+	{
+		TArray<int32> ConsolidatedNodeIds;
+		if (!UploadConsolidatedWorldInput(InInput, ConsolidatedNodeIds, false))
+			bSuccess = false;
+	}
+
 	return bSuccess;
 }
 
@@ -1257,6 +1331,162 @@ FHoudiniInputTranslator::ConnectInputNode(UHoudiniInput* InInput)
 	return true;
 }
 
+void
+FHoudiniInputTranslator::PrefetchHoudiniInputObjectData(UHoudiniInput* InInput, UHoudiniInputObject* InInputObject)
+{
+	if (!IsValid(InInput) || !IsValid(InInputObject))
+		return;
+
+	// References don't send any mesh data
+	if (InInput->GetImportAsReference())
+		return;
+
+	switch (InInputObject->Type)
+	{
+		case EHoudiniInputObjectType::StaticMeshComponent:
+		{
+			// The components of a consolidated world input are extracted when merging them
+			if (InInput->IsWorldInputConsolidated())
+				break;
+
+			UHoudiniInputMeshComponent* InputSMC = Cast<UHoudiniInputMeshComponent>(InInputObject);
+			UStaticMeshComponent* SMC = InputSMC ? InputSMC->GetStaticMeshComponent() : nullptr;
+			if (IsValid(SMC))
+				FUnrealMeshTranslator::PrefetchStaticMeshLODResources(SMC->GetStaticMesh(), SMC, InInput->GetExportLODs());
+			break;
+		}
+
+		case EHoudiniInputObjectType::Actor:
+		{
+			// Prefetch the actor's static mesh components
+			UHoudiniInputActor* InputActor = Cast<UHoudiniInputActor>(InInputObject);
+			if (!InputActor)
+				break;
+
+			for (UHoudiniInputSceneComponent* CurComponent : InputActor->GetActorComponents())
+				PrefetchHoudiniInputObjectData(InInput, CurComponent);
+			break;
+		}
+
+		default:
+			// Static meshes are uploaded once in a shared node, other types have no expensive extraction
+			break;
+	}
+}
+
+bool
+FHoudiniInputTranslator::UploadConsolidatedWorldInput(
+	UHoudiniInput* InInput, TArray<int32>& OutCreatedNodeIds, const bool& bInAllowCreate)
+{
+	if (!IsValid(InInput))
+		return false;
+
+	TArray<UHoudiniInputObject*>* InputObjectsArray = InInput->GetHoudiniInputObjectArray(EHoudiniInputType::World);
+	if (!InputObjectsArray)
+		return false;
+
+	// Gather the static mesh component objects of the input and of its actors
+	TArray<UHoudiniInputMeshComponent*> ConsolidatedObjects;
+	for (UHoudiniInputObject* CurObject : *InputObjectsArray)
+	{
+		if (!IsValid(CurObject))
+			continue;
+
+		if (CurObject->Type == EHoudiniInputObjectType::StaticMeshComponent)
+		{
+			ConsolidatedObjects.Add(Cast<UHoudiniInputMeshComponent>(CurObject));
+			continue;
+		}
+
+		UHoudiniInputActor* InputActor = Cast<UHoudiniInputActor>(CurObject);
+		if (!InputActor)
+			continue;
+
+		for (UHoudiniInputSceneComponent* CurComponent : InputActor->GetActorComponents())
+		{
+			if (IsValid(CurComponent) && CurComponent->Type == EHoudiniInputObjectType::StaticMeshComponent)
+				ConsolidatedObjects.Add(Cast<UHoudiniInputMeshComponent>(CurComponent));
+		}
+	}
+
+	// Build the signature of the components, meshes and transforms to send
+	TArray<UStaticMeshComponent*> Components;
+	uint32 Signature = 0;
+	bool bAnyObjectChanged = false;
+	for (UHoudiniInputMeshComponent* CurObject : ConsolidatedObjects)
+	{
+		if (!IsValid(CurObject))
+			continue;
+
+		// The nodes created for this component before the input was consolidated aren't used anymore
+		if (CurObject->InputNodeId >= 0 || CurObject->InputObjectNodeId >= 0)
+			CurObject->InvalidateData();
+
+		bAnyObjectChanged |= CurObject->HasChanged();
+
+		UStaticMeshComponent* SMC = CurObject->GetStaticMeshComponent();
+		if (!IsValid(SMC) || !IsValid(SMC->GetStaticMesh()))
+			continue;
+
+		const UStaticMesh* StaticMesh = SMC->GetStaticMesh();
+		const FMatrix ComponentMatrix = SMC->GetComponentTransform().ToMatrixWithScale();
+		Signature = FCrc::MemCrc32(&SMC, sizeof(SMC), Signature);
+		Signature = FCrc::MemCrc32(&StaticMesh, sizeof(StaticMesh), Signature);
+		Signature = FCrc::MemCrc32(ComponentMatrix.M, sizeof(ComponentMatrix.M), Signature);
+
+		Components.Add(SMC);
+	}
+
+	HAPI_NodeId ConsolidatedNodeId = InInput->GetConsolidatedInputNodeId();
+	if (Components.Num() <= 0)
+	{
+		// Nothing left to send, delete the merged node
+		if (bInAllowCreate && ConsolidatedNodeId >= 0)
+		{
+			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(ConsolidatedNodeId, true, InInput->GetSessionIndex());
+			InInput->SetConsolidatedInputNodeId(-1, 0);
+		}
+
+		return true;
+	}
+
+	const bool bIsNodeValid = ConsolidatedNodeId >= 0 && FHoudiniEngineUtils::IsHoudiniNodeValid(ConsolidatedNodeId);
+	if (!bIsNodeValid && !bInAllowCreate)
+		return true;
+
+	// Only rebuild the merged geometry if something has changed since the last upload
+	if (!bIsNodeValid || bAnyObjectChanged || Signature != InInput->GetConsolidatedInputSignature())
+	{
+		FString NodeName = InInput->GetNodeBaseName() + TEXT("_Consolidated");
+		const bool bSuccess = FUnrealMeshTranslator::HapiCreateInputNodeForStaticMeshComponents(
+			Components, ConsolidatedNodeId, NodeName);
+
+		// Keep track of the node even if the upload failed, a null signature will force its rebuild
+		InInput->SetConsolidatedInputNodeId(ConsolidatedNodeId, bSuccess ? Signature : 0);
+		if (!bSuccess)
+			return false;
+	}
+
+	// The components' transforms are baked in the geometry, the OBJ node stays at the origin
+	HAPI_NodeId ConsolidatedOBJNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(ConsolidatedNodeId);
+	if (ConsolidatedOBJNodeId < 0)
+		return false;
+
+	OutCreatedNodeIds.Add(ConsolidatedOBJNodeId);
+
+	// The merged geometry is up to date with all the components
+	for (UHoudiniInputMeshComponent* CurObject : ConsolidatedObjects)
+	{
+		if (!IsValid(CurObject))
+			continue;
+
+		CurObject->MarkChanged(false);
+		CurObject->MarkTransformChanged(false);
+	}
+
+	return true;
+}
+
 bool
 FHoudiniInputTranslator::UploadHoudiniInputObject(
 	UHoudiniInput* InInput, 
@@ -1268,6 +1498,7 @@ FHoudiniInputTranslator::UploadHoudiniInputObject(
 		return false;
 
 	FString ObjBaseName = InInput->GetNodeBaseName();
+	InInputObject->SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
 
 	bool bSuccess = true;
 	switch (InInputObject->Type)
@@ -1330,6 +1561,11 @@ FHoudiniInputTranslator::UploadHoudiniInputObject(
 
 		case EHoudiniInputObjectType::StaticMeshComponent:
 		{
+			// The components of a consolidated world input are sent together by UploadConsolidatedWorldInput,
+			// which will also clear their changed state
+			if (InInput->IsWorldInputConsolidated())
+				return true;
+
 			UHoudiniInputMeshComponent* InputSMC = Cast<UHoudiniInputMeshComponent>(InInputObject);
 			bSuccess = FHoudiniInputTranslator::HapiCreateInputNodeForStaticMeshComponent(
 				ObjBaseName,
@@ -1519,6 +1755,10 @@ FHoudiniInputTranslator::UploadHoudiniInputTransform(
 		case EHoudiniInputObjectType::StaticMeshComponent:
 		case EHoudiniInputObjectType::SplineComponent:
 		{
+			// The transforms of a consolidated world input's components are baked in its merged geometry
+			if (InInputObject->Type == EHoudiniInputObjectType::StaticMeshComponent && InInput->IsWorldInputConsolidated())
+				return true;
+
 			// Default behaviour for components derived from SceneComponent.
 
 			// Update using the component's transform
@@ -1808,8 +2048,7 @@ FHoudiniInputTranslator::HapiCreateInputNodeForObject(const FString& InObjNodeNa
 	}
 
 	// Commit the geo.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-		FHoudiniEngine::Get().GetSession(), InputNodeId), false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(InputNodeId), false);
 
 	return true;
 }
@@ -1928,8 +2167,17 @@ FHoudiniInputTranslator::HapiCreateInputNodeForStaticMesh(
 				if (!IsValid(SMObject))
 					continue;
 
-				bSuccess &= FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
-					CurSMC->GetStaticMesh(), SMObject->InputNodeId, SMName, nullptr, bExportLODs, bExportSockets, bExportColliders);
+				// Reference the session's shared node for that mesh if possible, upload it otherwise
+				if (FHoudiniInputGeometryCache::IsEnabled())
+				{
+					bSuccess &= FHoudiniInputGeometryCache::AcquireStaticMeshInputNode(
+						CurSMC->GetStaticMesh(), SMObject->InputNodeId, SMName, bExportLODs, bExportSockets, bExportColliders);
+				}
+				else
+				{
+					bSuccess &= FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
+						CurSMC->GetStaticMesh(), SMObject->InputNodeId, SMName, nullptr, bExportLODs, bExportSockets, bExportColliders);
+				}
 
 				InObject->SetImportAsReference(false);
 
@@ -1956,6 +2204,12 @@ FHoudiniInputTranslator::HapiCreateInputNodeForStaticMesh(
 			return true;
 		}
 		// This is a normal static mesh input, process it normally as a static mesh Input Object
+		else if (FHoudiniInputGeometryCache::IsEnabled())
+		{
+			// Reference the session's shared node for that mesh, only uploading it once
+			bSuccess = FHoudiniInputGeometryCache::AcquireStaticMeshInputNode(
+				SM, InObject->InputNodeId, SMName, bExportLODs, bExportSockets, bExportColliders);
+		}
 		else 
 		{
 			bSuccess = FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
@@ -2145,9 +2399,20 @@ FHoudiniInputTranslator::HapiCreateInputNodeForInstancedStaticMeshComponent(
 		ISMC, InObjNodeName, NewNodeId, bExportLODs, bExportSockets, bExportColliders, false))
 		return false;
 
+	// We have now created a valid new instancer, delete the previous one's OBJ,
+	// releasing the shared mesh node it may have been referencing
+	const HAPI_NodeId PreviousObjectNodeId = InObject->InputObjectNodeId;
+	const HAPI_NodeId NewObjectNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(NewNodeId);
+	if (PreviousObjectNodeId >= 0 && PreviousObjectNodeId != NewObjectNodeId)
+	{
+		FHoudiniInputGeometryCache::ReleaseNode(PreviousObjectNodeId);
+		if (FHoudiniEngineUtils::IsHoudiniNodeValid(PreviousObjectNodeId))
+			FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), PreviousObjectNodeId);
+	}
+
 	// Update this input object's node IDs
 	InObject->InputNodeId = NewNodeId;
-	InObject->InputObjectNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(NewNodeId);
+	InObject->InputObjectNodeId = NewObjectNodeId;
 
 	// Update the component's cached instances
 	InObject->Update(ISMC);
@@ -2394,6 +2659,8 @@ FHoudiniInputTranslator::HapiCreateInputNodeForActor(
 					if (IsValid(InputObject))
 					{
 						InObject->Update(InputObject);
+						// The extractions running on worker threads must not see the objects being collected
+						FUnrealMeshTranslator::FlushPrefetchedStaticMeshLODResources();
 						TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
 					}
 				}
@@ -2414,6 +2681,8 @@ FHoudiniInputTranslator::HapiCreateInputNodeForActor(
 				if (IsValid(InputObject))
 				{
 					InObject->Update(InputObject);
+					// The extractions running on worker threads must not see the objects being collected
+					FUnrealMeshTranslator::FlushPrefetchedStaticMeshLODResources();
 					TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
 				}
 			}
@@ -2485,12 +2754,20 @@ FHoudiniInputTranslator::HapiCreateInputNodeForLandscape(
 		int32 NumComponents = Landscape->LandscapeComponents.Num();
 		if ( !bExportSelectionOnly || ( SelectedComponents.Num() == NumComponents ) )
 		{
+			// If the landscape was only edited since the last upload, only send the modified regions to the existing heightfield
+			if (FUnrealLandscapeTranslator::UpdateHeightfieldDirtyRegions(Landscape, InObject))
+			{
+				InObject->Update(Landscape);
+				return true;
+			}
+
 			// Export the whole landscape and its layer as a single heightfield node
-			bSucess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(Landscape, InObject->InputNodeId, InObjNodeName);
+			bSucess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(Landscape, InObject->InputNodeId, InObjNodeName, InObject);
 		}
 		else
 		{
 			// Each selected landscape component will be exported as separate volumes in a single heightfield
+			InObject->ClearUploadedHeightfieldData();
 			bSucess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscapeComponentArray( Landscape, SelectedComponents, InObject->InputNodeId, InObjNodeName );
 		}
 	}
@@ -2502,6 +2779,7 @@ FHoudiniInputTranslator::HapiCreateInputNodeForLandscape(
 		bool bExportTileUVs = InInput->bLandscapeExportTileUVs;
 		bool bExportAsMesh = InInput->LandscapeExportType == EHoudiniLandscapeExportType::Mesh;
 
+		InObject->ClearUploadedHeightfieldData();
 		bSucess = FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
 			Landscape, InObject->InputNodeId, InObjNodeName,
 			bExportAsMesh, bExportTileUVs, bExportNormalizedUVs, bExportLighting, bExportMaterials);
@@ -2830,6 +3108,9 @@ FHoudiniInputTranslator::CreateInputNodeForReference(
 		// Get the parent OBJ node ID before deleting!
 		HAPI_NodeId PreviousInputOBJNode = FHoudiniEngineUtils::HapiGetParentNodeId(PreviousInputNodeId);
 
+		// The previous node might have been referencing a shared static mesh node
+		FHoudiniInputGeometryCache::ReleaseNode(PreviousInputNodeId);
+
 		if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
 			FHoudiniEngine::Get().GetSession(), PreviousInputNodeId))
 		{
@@ -2990,8 +3271,7 @@ FHoudiniInputTranslator::CreateInputNodeForReference(
 
 
 	// Commit the geo.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-		FHoudiniEngine::Get().GetSession(), NewNodeId), false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(NewNodeId), false);
 
 	InputNodeId = NewNodeId;
 	return true;
@@ -3177,8 +3457,7 @@ FHoudiniInputTranslator::HapiCreateInputNodeForDataTable(const FString& InNodeNa
 	}
 
 	// Commit the geo.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-		FHoudiniEngine::Get().GetSession(), InputNodeId), false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(InputNodeId), false);
 
 	// Commit the geo.
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
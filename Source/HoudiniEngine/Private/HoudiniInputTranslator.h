@@ -101,6 +101,14 @@ struct HOUDINIENGINE_API FHoudiniInputTranslator
 	// Upload all the input's transforms to Houdini
 	static bool UploadInputTransform(UHoudiniInput* InInput);
 
+	// Start extracting an input object's mesh data on worker threads, ahead of its upload
+	static void PrefetchHoudiniInputObjectData(UHoudiniInput* InInput, UHoudiniInputObject* InInputObject);
+
+	// Upload the static mesh components of a consolidated world input, merged in a single input node.
+	// The node is only rebuilt if the components, their meshes or their transforms have changed.
+	static bool UploadConsolidatedWorldInput(
+		UHoudiniInput* InInput, TArray<int32>& OutCreatedNodeIds, const bool& bInAllowCreate = true);
+
 	// Upload data for an input's InputObject
 	static bool UploadHoudiniInputObject(
 		UHoudiniInput* InInput, UHoudiniInputObject* InInputObject, const FTransform& InActorTransform, TArray<int32>& OutCreatedNodeIds);
@@ -31,6 +31,7 @@
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniInstancedActorComponent.h"
+#include "HoudiniObjectResolutionCache.h"
 #include "HoudiniMeshSplitInstancerComponent.h"
 #include "HoudiniStaticMeshComponent.h"
 #include "HoudiniStaticMesh.h"
@@ -44,6 +45,8 @@
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "InstancedFoliageActor.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/ParallelFor.h"
 
 #if WITH_EDITOR
 	//#include "ScopedTransaction.h"
@@ -53,6 +56,22 @@
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineParallelInstanceTransforms(
+	TEXT("HoudiniEngine.ParallelInstanceTransforms"),
+	1,
+	TEXT("Convert the instance transforms and apply the variations' transform offsets in parallel.\n")
+	TEXT("0: Single threaded\n")
+	TEXT("1: Parallel (default).\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineInstanceDeltaUpdates(
+	TEXT("HoudiniEngine.InstanceDeltaUpdates"),
+	1,
+	TEXT("When reusing an instanced static mesh component, only update the instances that have changed.\n")
+	TEXT("0: Clear and add all the instances again\n")
+	TEXT("1: Update, add or remove only the changed instances (default).\n")
+);
+
 // Fastrand is a faster alternative to std::rand()
 // and doesn't oscillate when looking for 2 values like Unreal's.
 inline int fastrand(int& nSeed)
@@ -97,6 +116,10 @@ FHoudiniInstanceTranslator::PopulateInstancedOutputPartData(
 	// Check for per instance custom data
 	GetPerInstanceCustomData(InHGPO.GeoId, InHGPO.PartId, OutInstancedOutputPartData);
 
+	// Get the stable instance ids, used to only update the instances that changed
+	if (!GetInstanceIds(InHGPO.GeoId, InHGPO.PartId, OutInstancedOutputPartData.InstanceIds))
+		OutInstancedOutputPartData.InstanceIds.Empty();
+
 	//Get the level path attribute on the instancer
 	if (!FHoudiniEngineUtils::GetLevelPathAttribute(InHGPO.GeoId, InHGPO.PartId, OutInstancedOutputPartData.AllLevelPaths))
 	{
@@ -268,6 +291,8 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 		TArray<int32> VariationOriginalObjectIndices;
 		// Array indicate the variation number for each variation
 		TArray<int32> VariationIndices;
+		// Array containing the index of each variation transform in its original object's transforms
+		TArray<TArray<int32>> VariationInstanceIndices;
 		// Update our variations using the instanced outputs
 		UpdateInstanceVariationObjects(
 			OutputIdentifier,
@@ -278,7 +303,8 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 			VariationInstancedObjects,
 			VariationInstancedTransforms, 
 			VariationOriginalObjectIndices,
-			VariationIndices);
+			VariationIndices,
+			InstancedOutputPartData.InstanceIds.Num() > 0 ? &VariationInstanceIndices : nullptr);
 
 		// Preload objects so we can benefit from async compilation as much as possible
 		for (int32 InstanceObjectIdx = 0; InstanceObjectIdx < VariationInstancedObjects.Num(); InstanceObjectIdx++)
@@ -341,6 +367,23 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 			if (!GetVariationMaterials(FoundInstancedOutput, InstanceObjectIdx, InstancedOutputPartData.OriginalInstancedIndices[VariationOriginalIndex], InstancerMaterials, VariationMaterials))
 				VariationMaterials.Empty();
 
+			// Get the stable ids of this variation's instances, if we have any.
+			// Matching instances by id reorders the component's instances, so we can't use them with per-instance custom data.
+			TArray<int32> VariationInstanceIds;
+			if (VariationInstanceIndices.IsValidIndex(InstanceObjectIdx) && InstancedOutputPartData.PerInstanceCustomData.Num() <= 0)
+			{
+				GetVariationInstanceIds(
+					VariationInstanceIndices[InstanceObjectIdx],
+					InstancedOutputPartData.OriginalInstancedIndices[VariationOriginalIndex],
+					InstancedOutputPartData.InstanceIds,
+					VariationInstanceIds);
+			}
+
+			// Ids of the previous component's instances
+			TArray<int32> ComponentInstanceIds;
+			if (FoundOutputObject && !bIsProxyMesh)
+				ComponentInstanceIds = FoundOutputObject->InstanceIds;
+
 			USceneComponent* NewInstancerComponent = nullptr;
 			if (!CreateOrUpdateInstanceComponent(
 				InstancedObject,
@@ -356,7 +399,9 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 				InstancedOutputPartData.OriginalInstancedIndices[VariationOriginalIndex],
 				InstanceObjectIdx,
 				InstancedOutputPartData.bForceHISM,
-				InstancedOutputPartData.bForceInstancer))
+				InstancedOutputPartData.bForceInstancer,
+				VariationInstanceIds.Num() == InstancedObjectTransforms.Num() ? &VariationInstanceIds : nullptr,
+				&ComponentInstanceIds))
 			{
 				// TODO??
 				continue;
@@ -388,6 +433,7 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 			{
 				NewOutputObject.OutputComponent = NewInstancerComponent;
 				NewOutputObject.OutputObject = InstancedObject;
+				NewOutputObject.InstanceIds = ComponentInstanceIds;
 			}
 
 			// If this is not a new output object we have to clear the CachedAttributes and CachedTokens before
@@ -884,7 +930,8 @@ FHoudiniInstanceTranslator::UpdateInstanceVariationObjects(
 	TArray<TSoftObjectPtr<UObject>>& OutVariationsInstancedObjects,
 	TArray<TArray<FTransform>>& OutVariationsInstancedTransforms,
 	TArray<int32>& OutVariationOriginalObjectIdx,
-	TArray<int32>& OutVariationIndices)
+	TArray<int32>& OutVariationIndices,
+	TArray<TArray<int32>>* OutVariationsInstanceIndices)
 {
 	FHoudiniOutputObjectIdentifier Identifier = InOutputIdentifier;
 	for (int32 InstObjIdx = 0; InstObjIdx < InOriginalObjects.Num(); InstObjIdx++)
@@ -939,6 +986,14 @@ FHoudiniInstanceTranslator::UpdateInstanceVariationObjects(
 			OutVariationOriginalObjectIdx.Add(InstObjIdx);
 			OutVariationIndices.Add(0);
 
+			if (OutVariationsInstanceIndices)
+			{
+				TArray<int32>& InstanceIndices = OutVariationsInstanceIndices->AddDefaulted_GetRef();
+				InstanceIndices.SetNumUninitialized(InOriginalTransforms[InstObjIdx].Num());
+				for (int32 Idx = 0; Idx < InstanceIndices.Num(); Idx++)
+					InstanceIndices[Idx] = Idx;
+			}
+
 			InstancedOutputs.Add(Identifier, CurInstancedOutput);
 		}
 		else
@@ -993,6 +1048,11 @@ FHoudiniInstanceTranslator::UpdateInstanceVariationObjects(
 			if (CurInstancedOutput.TransformVariationIndices.Num() != CurInstancedOutput.OriginalTransforms.Num())
 				UpdateVariationAssignements(CurInstancedOutput);
 
+			// Get the transforms assigned to each variation
+			TArray<TArray<FTransform>> ProcessedTransforms;
+			TArray<TArray<int32>> ProcessedIndices;
+			ProcessInstanceTransforms(CurInstancedOutput, ProcessedTransforms, OutVariationsInstanceIndices ? &ProcessedIndices : nullptr);
+
 			// Assign variations and their transforms
 			for (int32 VarIdx = 0; VarIdx < CurInstancedOutput.VariationObjects.Num(); VarIdx++)
 			{
@@ -1000,15 +1060,15 @@ FHoudiniInstanceTranslator::UpdateInstanceVariationObjects(
 				if (!IsValid(CurrentVariationObject))
 					continue;
 
-				// Get the transforms assigned to that variation
-				TArray<FTransform> ProcessedTransforms;
-				ProcessInstanceTransforms(CurInstancedOutput, VarIdx, ProcessedTransforms);
-				if (ProcessedTransforms.Num() > 0)
+				if (ProcessedTransforms[VarIdx].Num() > 0)
 				{
 					OutVariationsInstancedObjects.Add(CurrentVariationObject);
-					OutVariationsInstancedTransforms.Add(ProcessedTransforms);
+					OutVariationsInstancedTransforms.Add(MoveTemp(ProcessedTransforms[VarIdx]));
 					OutVariationOriginalObjectIdx.Add(InstObjIdx);
 					OutVariationIndices.Add(VarIdx);
+
+					if (OutVariationsInstanceIndices)
+						OutVariationsInstanceIndices->Add(MoveTemp(ProcessedIndices[VarIdx]));
 				}
 			}
 
@@ -1038,58 +1098,112 @@ FHoudiniInstanceTranslator::UpdateVariationAssignements(FHoudiniInstancedOutput&
 
 void
 FHoudiniInstanceTranslator::ProcessInstanceTransforms(
-	FHoudiniInstancedOutput& InstancedOutput, const int32& VariationIdx, TArray<FTransform>& OutProcessedTransforms)
+	FHoudiniInstancedOutput& InstancedOutput,
+	TArray<TArray<FTransform>>& OutProcessedTransforms,
+	TArray<TArray<int32>>* OutProcessedIndices)
 {
-	if (!InstancedOutput.VariationObjects.IsValidIndex(VariationIdx))
-		return;
+	const int32 VariationCount = InstancedOutput.VariationObjects.Num();
+	OutProcessedTransforms.Empty(VariationCount);
+	OutProcessedTransforms.SetNum(VariationCount);
+	if (OutProcessedIndices)
+	{
+		OutProcessedIndices->Empty(VariationCount);
+		OutProcessedIndices->SetNum(VariationCount);
+	}
 
-	if (!InstancedOutput.VariationTransformOffsets.IsValidIndex(VariationIdx))
+	if (VariationCount <= 0)
 		return;
 
-	bool bHasVariations = InstancedOutput.VariationObjects.Num() > 1;
-	bool bHasTransformOffset = InstancedOutput.VariationTransformOffsets.IsValidIndex(VariationIdx)
-		? !InstancedOutput.VariationTransformOffsets[VariationIdx].Equals(FTransform::Identity)
-		: false;
-
-	if (!bHasVariations && !bHasTransformOffset)
+	if (VariationCount == 1)
 	{
-		// We dont have variations or transform offset, so we can reuse the original transforms as is
-		OutProcessedTransforms = InstancedOutput.OriginalTransforms;
-		return;
+		// No variations, we can reuse the original transforms as is
+		OutProcessedTransforms[0] = InstancedOutput.OriginalTransforms;
+		if (OutProcessedIndices)
+		{
+			TArray<int32>& ProcessedIndices = (*OutProcessedIndices)[0];
+			ProcessedIndices.SetNumUninitialized(InstancedOutput.OriginalTransforms.Num());
+			for (int32 Idx = 0; Idx < ProcessedIndices.Num(); Idx++)
+				ProcessedIndices[Idx] = Idx;
+		}
 	}
-
-	if (bHasVariations)
+	else
 	{
-		// We simply need to extract the transforms for this variation		
-		for (int32 TransformIndex = 0; TransformIndex < InstancedOutput.TransformVariationIndices.Num(); TransformIndex++)
+		// Partition the transforms by variation in a single pass:
+		// count the instances of each variation first, so each bucket is allocated only once,
+		// then scatter the transforms in their bucket, preserving their original order.
+		const int32 TransformCount = FMath::Min(
+			InstancedOutput.OriginalTransforms.Num(), InstancedOutput.TransformVariationIndices.Num());
+
+		TArray<int32> VariationCounts;
+		VariationCounts.SetNumZeroed(VariationCount);
+		for (int32 Idx = 0; Idx < TransformCount; Idx++)
 		{
-			if (InstancedOutput.TransformVariationIndices[TransformIndex] != VariationIdx)
+			const int32 VariationIdx = InstancedOutput.TransformVariationIndices[Idx];
+			if (VariationCounts.IsValidIndex(VariationIdx))
+				VariationCounts[VariationIdx]++;
+		}
+
+		for (int32 VariationIdx = 0; VariationIdx < VariationCount; VariationIdx++)
+		{
+			OutProcessedTransforms[VariationIdx].SetNumUninitialized(VariationCounts[VariationIdx]);
+			if (OutProcessedIndices)
+				(*OutProcessedIndices)[VariationIdx].SetNumUninitialized(VariationCounts[VariationIdx]);
+
+			// Reuse the counts as the write position in each bucket
+			VariationCounts[VariationIdx] = 0;
+		}
+
+		for (int32 Idx = 0; Idx < TransformCount; Idx++)
+		{
+			const int32 VariationIdx = InstancedOutput.TransformVariationIndices[Idx];
+			if (!VariationCounts.IsValidIndex(VariationIdx))
 				continue;
 
-			OutProcessedTransforms.Add(InstancedOutput.OriginalTransforms[TransformIndex]);
+			const int32 BucketIdx = VariationCounts[VariationIdx]++;
+			OutProcessedTransforms[VariationIdx][BucketIdx] = InstancedOutput.OriginalTransforms[Idx];
+			if (OutProcessedIndices)
+				(*OutProcessedIndices)[VariationIdx][BucketIdx] = Idx;
 		}
 	}
-	else
+
+	// Apply the transform offsets
+	for (int32 VariationIdx = 0; VariationIdx < VariationCount; VariationIdx++)
 	{
-		// No variations, we can reuse the original transforms
-		OutProcessedTransforms = InstancedOutput.OriginalTransforms;
+		if (!InstancedOutput.VariationTransformOffsets.IsValidIndex(VariationIdx))
+			continue;
+
+		const FTransform& TransformOffset = InstancedOutput.VariationTransformOffsets[VariationIdx];
+		if (TransformOffset.Equals(FTransform::Identity))
+			continue;
+
+		ApplyTransformOffset(TransformOffset, OutProcessedTransforms[VariationIdx]);
 	}
+}
 
-	if (bHasTransformOffset)
-	{
-		// Get the transform offset for this variation
-		FVector PositionOffset = InstancedOutput.VariationTransformOffsets[VariationIdx].GetLocation();
-		FQuat RotationOffset = InstancedOutput.VariationTransformOffsets[VariationIdx].GetRotation();
-		FVector ScaleOffset = InstancedOutput.VariationTransformOffsets[VariationIdx].GetScale3D();
+void
+FHoudiniInstanceTranslator::ApplyTransformOffset(const FTransform& InTransformOffset, TArray<FTransform>& InOutTransforms)
+{
+	// Get the transform offset for this variation
+	const FVector PositionOffset = InTransformOffset.GetLocation();
+	const FQuat RotationOffset = InTransformOffset.GetRotation();
+	const FVector ScaleOffset = InTransformOffset.GetScale3D();
 
-		FTransform CurrentTransform = FTransform::Identity;
-		for (int32 TransformIndex = 0; TransformIndex < OutProcessedTransforms.Num(); TransformIndex++)
+	// Process the transforms in chunks, to amortize the task overhead on small instancers
+	const int32 ChunkSize = 4096;
+	const int32 NumChunks = FMath::DivideAndRoundUp(InOutTransforms.Num(), ChunkSize);
+	const bool bParallel = CVarHoudiniEngineParallelInstanceTransforms.GetValueOnAnyThread() != 0;
+
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
+	{
+		const int32 Start = ChunkIdx * ChunkSize;
+		const int32 End = FMath::Min(Start + ChunkSize, InOutTransforms.Num());
+		for (int32 TransformIndex = Start; TransformIndex < End; TransformIndex++)
 		{
-			CurrentTransform = OutProcessedTransforms[TransformIndex];
+			FTransform& CurrentTransform = InOutTransforms[TransformIndex];
 
 			// Compute new rotation and scale.
-			FVector Position = CurrentTransform.GetLocation() + PositionOffset;
-			FQuat TransformRotation = CurrentTransform.GetRotation() * RotationOffset;
+			const FVector Position = CurrentTransform.GetLocation() + PositionOffset;
+			const FQuat TransformRotation = CurrentTransform.GetRotation() * RotationOffset;
 			FVector TransformScale3D = CurrentTransform.GetScale3D() * ScaleOffset;
 
 			// Make sure inverse matrix exists - seems to be a bug in Unreal when submitting instances.
@@ -1104,14 +1218,11 @@ FHoudiniInstanceTranslator::ProcessInstanceTransforms(
 			if (FMath::Abs(TransformScale3D.Z) < HAPI_UNREAL_SCALE_SMALL_VALUE)
 				TransformScale3D.Z = (TransformScale3D.Z > 0) ? HAPI_UNREAL_SCALE_SMALL_VALUE : -HAPI_UNREAL_SCALE_SMALL_VALUE;
 
-			CurrentTransform.SetLocation(Position);
-			CurrentTransform.SetRotation(TransformRotation);
-			CurrentTransform.SetScale3D(TransformScale3D);
-
-			if (CurrentTransform.IsValid())
-				OutProcessedTransforms[TransformIndex] = CurrentTransform;
+			const FTransform OffsetTransform(TransformRotation, Position, TransformScale3D);
+			if (OffsetTransform.IsValid())
+				CurrentTransform = OffsetTransform;
 		}
-	}
+	}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
 }
 
 bool
@@ -1400,20 +1511,10 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 			return false;
 		}
 
-		// Attempt to load specified asset.
+		// Attempt to load specified asset (or find the class we can instantiate).
+		// TODO: ensure we'll be able to create an actor from this class! 
 		const FString & AssetName = DetailInstanceValues[0];
-		UObject * AttributeObject = StaticLoadObject(UObject::StaticClass(), nullptr, *AssetName, nullptr, LOAD_None, nullptr);
-
-		if (!AttributeObject)
-		{
-			// See if the ref is a class that we can instantiate
-			UClass * FoundClass = FindObject<UClass>(ANY_PACKAGE, *AssetName);
-			if (FoundClass != nullptr)
-			{
-				// TODO: ensure we'll be able to create an actor from this class! 
-				AttributeObject = FoundClass;
-			}
-		}
+		UObject * AttributeObject = FHoudiniObjectResolutionCache::ResolveObject(AssetName);
 
 		if (!AttributeObject && bDefaultObjectEnabled)
 		{
@@ -1433,9 +1534,6 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 		// (with either the actual referenced object or the default placeholder object)
 		if (AttributeObject)
 		{
-			OutInstancedObjects.Add(AttributeObject);
-			OutInstancedTransforms.Add(InstancerUnrealTransforms);
-
 			TArray<int32> Indices;
 			Indices.SetNum(InstancerUnrealTransforms.Num());
 			for (int32 Index = 0; Index < Indices.Num(); ++Index)
@@ -1443,6 +1541,9 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 				Indices[Index] = Index;
 			}
 
+			// The transforms are only used by this object, so we can move them instead of copying
+			OutInstancedObjects.Add(AttributeObject);
+			OutInstancedTransforms.Add(MoveTemp(InstancerUnrealTransforms));
 			OutInstancedIndices.Add(Indices);
 
 			if(bHasSplitAttribute)
@@ -1472,33 +1573,11 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 		}
 
 		// If instance attribute exists on points, we need to get all the unique values.
-		// This will give us all the unique object we want to instance
+		// This will give us all the unique object we want to instance.
+		// Objects that failed to load are still added (as null) so we can skip them.
+		// TODO: ensure we'll be able to create an actor from the found classes!
 		TMap<FString, UObject *> ObjectsToInstance;
-		for (const auto& Iter : PointInstanceValues)
-		{
-			if (!ObjectsToInstance.Contains(Iter))
-			{
-				// To avoid trying to load an object that fails multiple times,
-				// still add it to the array if null so we can still skip further attempts
-				UObject* AttributeObject = StaticFindObjectSafe(UObject::StaticClass(), nullptr, *Iter);
-				if (IsValid(AttributeObject))
-					AttributeObject = StaticLoadObject(
-						UObject::StaticClass(), nullptr, *Iter, nullptr, LOAD_None, nullptr);
-
-				if (!AttributeObject)
-				{
-					// See if the ref is a class that we can instantiate
-					UClass * FoundClass = FindObject<UClass>(ANY_PACKAGE, *Iter);
-					if (FoundClass != nullptr)
-					{
-						// TODO: ensure we'll be able to create an actor from this class!
-						AttributeObject = FoundClass;
-					}
-				}
-
-				ObjectsToInstance.Add(Iter, AttributeObject);
-			}
-		}
+		FHoudiniObjectResolutionCache::ResolveObjects(PointInstanceValues, ObjectsToInstance);
 
 		// Iterates through all the unique objects and get their corresponding transforms
 		bool Success = false;
@@ -1831,7 +1910,9 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstanceComponent(
 	const TArray<int32>& OriginalInstancerObjectIndices,
 	const int32& InstancerObjectIdx,
 	const bool& bForceHISM,
-	const bool& bForceInstancer)
+	const bool& bForceInstancer,
+	const TArray<int32>* InInstanceIds,
+	TArray<int32>* InOutComponentInstanceIds)
 {
 	enum InstancerComponentType
 	{
@@ -1933,7 +2014,8 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstanceComponent(
 		{
 			// Create an Instanced Static Mesh Component
 			bSuccess = CreateOrUpdateInstancedStaticMeshComponent(
-				StaticMesh, InstancedObjectTransforms, AllPropertyAttributes, InstancerGeoPartObject, ParentComponent, NewComponent, InstancerMaterial, bForceHISM, FirstOriginalIndex);
+				StaticMesh, InstancedObjectTransforms, AllPropertyAttributes, InstancerGeoPartObject, ParentComponent, NewComponent, InstancerMaterial, bForceHISM, FirstOriginalIndex,
+				InInstanceIds, OldType == NewType ? InOutComponentInstanceIds : nullptr);
 		}
 		break;
 
@@ -2008,7 +2090,9 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 	USceneComponent*& CreatedInstancedComponent,
 	UMaterialInterface * InstancerMaterial, /*=nullptr*/
 	const bool & bForceHISM,
-	const int32& InstancerObjectIdx)
+	const int32& InstancerObjectIdx,
+	const TArray<int32>* InInstanceIds,
+	TArray<int32>* InOutComponentInstanceIds)
 {
 	if (!InstancedStaticMesh)
 		return false;
@@ -2065,8 +2149,21 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 	}
 
 	// Now add the instances themselves
-	InstancedStaticMeshComponent->ClearInstances();
-	InstancedStaticMeshComponent->AddInstances(InstancedObjectTransforms, false);
+	// When reusing a component, try to only update the instances that have changed
+	if (bCreatedNewComponent || !UpdateInstancedStaticMeshComponentInstances(
+		InstancedStaticMeshComponent, InstancedObjectTransforms, InInstanceIds, InOutComponentInstanceIds))
+	{
+		InstancedStaticMeshComponent->ClearInstances();
+		InstancedStaticMeshComponent->AddInstances(InstancedObjectTransforms, false);
+
+		if (InOutComponentInstanceIds)
+		{
+			if (InInstanceIds)
+				*InOutComponentInstanceIds = *InInstanceIds;
+			else
+				InOutComponentInstanceIds->Empty();
+		}
+	}
 
 	// Apply generic attributes if we have any
 	UpdateGenericPropertiesAttributes(InstancedStaticMeshComponent, AllPropertyAttributes, InstancerObjectIdx);
@@ -2078,6 +2175,142 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 	return true;
 }
 
+bool
+FHoudiniInstanceTranslator::UpdateInstancedStaticMeshComponentInstances(
+	UInstancedStaticMeshComponent* InstancedStaticMeshComponent,
+	const TArray<FTransform>& InstancedObjectTransforms,
+	const TArray<int32>* InInstanceIds,
+	TArray<int32>* InOutComponentInstanceIds)
+{
+	if (CVarHoudiniEngineInstanceDeltaUpdates.GetValueOnAnyThread() == 0)
+		return false;
+
+	if (!IsValid(InstancedStaticMeshComponent))
+		return false;
+
+	const int32 NumOldInstances = InstancedStaticMeshComponent->GetInstanceCount();
+	const int32 NumNewInstances = InstancedObjectTransforms.Num();
+	if (NumOldInstances <= 0 || NumNewInstances <= 0)
+		return false;
+
+	// Component instance index (slot) used by each new instance
+	// Slots are only added/removed at the end, so the remaining instances keep their index
+	TArray<int32> SlotInstanceIndices;
+	SlotInstanceIndices.Init(INDEX_NONE, NumNewInstances);
+
+	const bool bUseIds = InInstanceIds && InOutComponentInstanceIds
+		&& InInstanceIds->Num() == NumNewInstances
+		&& InOutComponentInstanceIds->Num() == NumOldInstances;
+
+	if (bUseIds)
+	{
+		// Instances with an id that was already present reuse the same slot
+		TMap<int32, int32> PreviousIdToSlot;
+		PreviousIdToSlot.Reserve(NumOldInstances);
+		for (int32 Slot = 0; Slot < NumOldInstances; Slot++)
+			PreviousIdToSlot.Add((*InOutComponentInstanceIds)[Slot], Slot);
+
+		TArray<int32> UnmatchedInstances;
+		for (int32 InstanceIdx = 0; InstanceIdx < NumNewInstances; InstanceIdx++)
+		{
+			const int32* FoundSlot = PreviousIdToSlot.Find((*InInstanceIds)[InstanceIdx]);
+			if (FoundSlot && *FoundSlot < NumNewInstances && SlotInstanceIndices[*FoundSlot] == INDEX_NONE)
+				SlotInstanceIndices[*FoundSlot] = InstanceIdx;
+			else
+				UnmatchedInstances.Add(InstanceIdx);
+		}
+
+		// New or moved instances fill the remaining slots
+		int32 UnmatchedIdx = 0;
+		for (int32 Slot = 0; Slot < NumNewInstances; Slot++)
+		{
+			if (SlotInstanceIndices[Slot] == INDEX_NONE)
+				SlotInstanceIndices[Slot] = UnmatchedInstances[UnmatchedIdx++];
+		}
+	}
+	else
+	{
+		for (int32 Slot = 0; Slot < NumNewInstances; Slot++)
+			SlotInstanceIndices[Slot] = Slot;
+	}
+
+	// Find the existing instances whose transform has changed
+	const int32 NumKeptInstances = FMath::Min(NumOldInstances, NumNewInstances);
+	TArray<int32> ChangedSlots;
+	for (int32 Slot = 0; Slot < NumKeptInstances; Slot++)
+	{
+		FTransform CurrentTransform;
+		InstancedStaticMeshComponent->GetInstanceTransform(Slot, CurrentTransform, false);
+		if (!CurrentTransform.Equals(InstancedObjectTransforms[SlotInstanceIndices[Slot]]))
+			ChangedSlots.Add(Slot);
+	}
+
+	// If most of the instances have changed, rebuilding all of them is cheaper
+	const int32 NumChanges = ChangedSlots.Num() + FMath::Abs(NumNewInstances - NumOldInstances);
+	if (NumChanges > NumNewInstances / 2)
+		return false;
+
+	// Update the changed instances, in batches of contiguous slots
+	TArray<FTransform> BatchTransforms;
+	for (int32 ChangedIdx = 0; ChangedIdx < ChangedSlots.Num();)
+	{
+		const int32 StartSlot = ChangedSlots[ChangedIdx];
+		BatchTransforms.Reset();
+		while (ChangedIdx < ChangedSlots.Num() && ChangedSlots[ChangedIdx] == StartSlot + BatchTransforms.Num())
+		{
+			BatchTransforms.Add(InstancedObjectTransforms[SlotInstanceIndices[ChangedSlots[ChangedIdx]]]);
+			ChangedIdx++;
+		}
+
+		InstancedStaticMeshComponent->BatchUpdateInstancesTransforms(StartSlot, BatchTransforms, false, false, false);
+	}
+
+	if (NumOldInstances > NumNewInstances)
+	{
+		// Remove the extra instances, starting from the last one
+		TArray<int32> RemovedSlots;
+		RemovedSlots.Reserve(NumOldInstances - NumNewInstances);
+		for (int32 Slot = NumOldInstances - 1; Slot >= NumNewInstances; Slot--)
+			RemovedSlots.Add(Slot);
+
+		InstancedStaticMeshComponent->RemoveInstances(RemovedSlots);
+	}
+	else if (NumNewInstances > NumOldInstances)
+	{
+		// Add the new instances
+		TArray<FTransform> AddedTransforms;
+		AddedTransforms.Reserve(NumNewInstances - NumOldInstances);
+		for (int32 Slot = NumOldInstances; Slot < NumNewInstances; Slot++)
+			AddedTransforms.Add(InstancedObjectTransforms[SlotInstanceIndices[Slot]]);
+
+		InstancedStaticMeshComponent->AddInstances(AddedTransforms, false);
+	}
+
+	// Keep track of the ids in the component's new instance order
+	if (InOutComponentInstanceIds)
+	{
+		if (InInstanceIds && InInstanceIds->Num() == NumNewInstances)
+		{
+			InOutComponentInstanceIds->SetNumUninitialized(NumNewInstances);
+			for (int32 Slot = 0; Slot < NumNewInstances; Slot++)
+				(*InOutComponentInstanceIds)[Slot] = (*InInstanceIds)[SlotInstanceIndices[Slot]];
+		}
+		else
+		{
+			InOutComponentInstanceIds->Empty();
+		}
+	}
+
+	InstancedStaticMeshComponent->MarkRenderStateDirty();
+
+	// Rebuild the HISM's tree in the background instead of blocking on it
+	UHierarchicalInstancedStaticMeshComponent* HISMC = Cast<UHierarchicalInstancedStaticMeshComponent>(InstancedStaticMeshComponent);
+	if (HISMC)
+		HISMC->BuildTreeIfOutdated(true, false);
+
+	return true;
+}
+
 bool
 FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 	UObject* InstancedObject,
@@ -2564,13 +2797,17 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 	if (!FoliageInfo)
 		return false;
 
-	FTransform HoudiniAssetTransform = ParentComponent->GetComponentTransform();
-	FFoliageInstance FoliageInstance;
-	int32 CurrentInstanceCount = 0;
+	// Build the foliage instances in parallel, then add them all at once
+	const FTransform HoudiniAssetTransform = ParentComponent->GetComponentTransform();
+	TArray<FFoliageInstance> FoliageInstances;
+	FoliageInstances.SetNum(InstancedObjectTransforms.Num());
 
-	FoliageInfo->ReserveAdditionalInstances(InstancedFoliageActor, FoliageType, InstancedObjectTransforms.Num());
-	for (auto CurrentTransform : InstancedObjectTransforms)
+	const bool bParallel = CVarHoudiniEngineParallelInstanceTransforms.GetValueOnAnyThread() != 0;
+	ParallelFor(FoliageInstances.Num(), [&](int32 InstanceIdx)
 	{
+		const FTransform& CurrentTransform = InstancedObjectTransforms[InstanceIdx];
+		FFoliageInstance& FoliageInstance = FoliageInstances[InstanceIdx];
+
 		// Use our parent component for the base component of the instances,
 		// this will allow us to clean the instances by component
 		FoliageInstance.BaseComponent = ParentComponent;
@@ -2590,10 +2827,9 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 			FoliageInstance.Rotation = HoudiniAssetTransform.TransformRotation(CurrentTransform.GetRotation()).Rotator();
 			FoliageInstance.DrawScale3D = CurrentTransform.GetScale3D() * HoudiniAssetTransform.GetScale3D();
 		}
+	}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
 
-		FoliageInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance);
-		CurrentInstanceCount++;
-	}
+	AddFoliageInstances(InstancedFoliageActor, FoliageType, *FoliageInfo, FoliageInstances);
 
 	UHierarchicalInstancedStaticMeshComponent* FoliageHISMC = FoliageInfo->GetComponent();	
 	if (IsValid(FoliageHISMC))
@@ -2627,6 +2863,27 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 	return true;
 }
 
+void
+FHoudiniInstanceTranslator::AddFoliageInstances(
+	AInstancedFoliageActor* InInstancedFoliageActor,
+	const UFoliageType* InFoliageType,
+	FFoliageInfo& InFoliageInfo,
+	const TArray<FFoliageInstance>& InFoliageInstances)
+{
+	if (!IsValid(InInstancedFoliageActor) || !IsValid(InFoliageType) || InFoliageInstances.Num() <= 0)
+		return;
+
+	// Adding the instances in one batch lets the foliage info reserve its data and
+	// update its component once, instead of once per instance
+	TArray<const FFoliageInstance*> FoliageInstancePtrs;
+	FoliageInstancePtrs.Reserve(InFoliageInstances.Num());
+	for (const FFoliageInstance& FoliageInstance : InFoliageInstances)
+		FoliageInstancePtrs.Add(&FoliageInstance);
+
+	InFoliageInfo.ReserveAdditionalInstances(InInstancedFoliageActor, InFoliageType, FoliageInstancePtrs.Num());
+	InFoliageInfo.AddInstances(InInstancedFoliageActor, InFoliageType, FoliageInstancePtrs);
+}
+
 bool
 FHoudiniInstanceTranslator::HapiGetInstanceTransforms(
 	const FHoudiniGeoPartObject& InHGPO, TArray<FTransform>& OutInstancerUnrealTransforms)
@@ -2636,28 +2893,43 @@ FHoudiniInstanceTranslator::HapiGetInstanceTransforms(
 	if (PointCount <= 0)
 		return false;
 
+	// Stream the transforms in fixed size chunks, converting each chunk directly in the output array.
+	// This keeps the intermediate HAPI buffer bounded for instancers with millions of points.
+	const int32 ChunkSize = FMath::Min(PointCount, HAPI_UNREAL_INSTANCE_TRANSFORMS_CHUNK_SIZE);
 	TArray<HAPI_Transform> InstanceTransforms;
-	InstanceTransforms.SetNum(PointCount);
+	InstanceTransforms.SetNumUninitialized(ChunkSize);
 	for (int32 Idx = 0; Idx < InstanceTransforms.Num(); Idx++)
 		FHoudiniApi::Transform_Init(&(InstanceTransforms[Idx]));
 
-	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetInstanceTransformsOnPart(
-		FHoudiniEngine::Get().GetSession(),
-		InHGPO.GeoId, InHGPO.PartId, HAPI_SRT,
-		&InstanceTransforms[0], 0, PointCount))
+	OutInstancerUnrealTransforms.SetNumUninitialized(PointCount);
+
+	const bool bParallel = CVarHoudiniEngineParallelInstanceTransforms.GetValueOnAnyThread() != 0;
+	for (int32 ChunkStart = 0; ChunkStart < PointCount; ChunkStart += ChunkSize)
 	{
-		InstanceTransforms.SetNum(0);
+		const int32 CurrentChunkSize = FMath::Min(ChunkSize, PointCount - ChunkStart);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetInstanceTransformsOnPart(
+			FHoudiniEngine::Get().GetSession(),
+			InHGPO.GeoId, InHGPO.PartId, HAPI_SRT,
+			InstanceTransforms.GetData(), ChunkStart, CurrentChunkSize))
+		{
+			OutInstancerUnrealTransforms.Empty();
 
-		// TODO: Warning? error?
-		return false;
-	}
+			// TODO: Warning? error?
+			return false;
+		}
 
-	// Convert the transform to Unreal's coordinate system
-	OutInstancerUnrealTransforms.SetNumZeroed(InstanceTransforms.Num());
-	for (int32 InstanceIdx = 0; InstanceIdx < InstanceTransforms.Num(); InstanceIdx++)
-	{
-		const auto& InstanceTransform = InstanceTransforms[InstanceIdx];
-		FHoudiniEngineUtils::TranslateHapiTransform(InstanceTransform, OutInstancerUnrealTransforms[InstanceIdx]);
+		// Convert the transforms to Unreal's coordinate system
+		const int32 NumBatches = FMath::DivideAndRoundUp(CurrentChunkSize, 4096);
+		ParallelFor(NumBatches, [&](int32 BatchIdx)
+		{
+			const int32 Start = BatchIdx * 4096;
+			const int32 End = FMath::Min(Start + 4096, CurrentChunkSize);
+			for (int32 Idx = Start; Idx < End; Idx++)
+			{
+				FHoudiniEngineUtils::TranslateHapiTransform(
+					InstanceTransforms[Idx], OutInstancerUnrealTransforms[ChunkStart + Idx]);
+			}
+		}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
 	}
 
 	return true;
@@ -2804,36 +3076,25 @@ bool
 FHoudiniInstanceTranslator::GetInstancerMaterials(
 	const TArray<FString>& MaterialAttributes, TArray<UMaterialInterface*>& OutInstancerMaterials)
 {
-	// Use a map to avoid attempting to load the object for each instance
-	TMap<FString, UMaterialInterface*> MaterialMap;
+	// Resolve all the unique material paths at once to avoid attempting to load the object for each instance
+	TMap<FString, UObject*> MaterialMap;
+	FHoudiniObjectResolutionCache::ResolveObjects(MaterialAttributes, MaterialMap);
 
 	bool bHasValidMaterial = false;
 
 	// Non-instanced materials check material attributes one by one
+	OutInstancerMaterials.Reserve(OutInstancerMaterials.Num() + MaterialAttributes.Num());
 	for (auto& CurrentMatString : MaterialAttributes)
 	{
-		UMaterialInterface* CurrentMaterialInterface = nullptr;
-		UMaterialInterface** FoundMaterial = MaterialMap.Find(CurrentMatString);
-		if (!FoundMaterial)
-		{
-			// See if we can find a material interface that matches the attribute
-			CurrentMaterialInterface = Cast<UMaterialInterface>(
-				StaticLoadObject(UMaterialInterface::StaticClass(), nullptr, *CurrentMatString, nullptr, LOAD_NoWarn, nullptr));
+		// See if we found a material interface that matches the attribute
+		UObject** FoundObject = MaterialMap.Find(CurrentMatString);
+		UMaterialInterface* CurrentMaterialInterface = FoundObject ? Cast<UMaterialInterface>(*FoundObject) : nullptr;
 
-			// Check validity
-			if (!IsValid(CurrentMaterialInterface))
-				CurrentMaterialInterface = nullptr;
-			else
-				bHasValidMaterial = true;
-
-			// Add what we found to the material map to avoid unnecessary loads
-			MaterialMap.Add(CurrentMatString, CurrentMaterialInterface);
-		}
+		// Check validity
+		if (!IsValid(CurrentMaterialInterface))
+			CurrentMaterialInterface = nullptr;
 		else
-		{
-			// Reuse what we previously found
-			CurrentMaterialInterface = *FoundMaterial;
-		}
+			bHasValidMaterial = true;
 		
 		OutInstancerMaterials.Add(CurrentMaterialInterface);
 	}
@@ -3244,6 +3505,44 @@ FHoudiniInstanceTranslator::HasForceInstancerAttribute(const HAPI_NodeId& GeoId,
 	return IntData[0] != 0;
 }
 
+bool
+FHoudiniInstanceTranslator::GetInstanceIds(const HAPI_NodeId& GeoId, const HAPI_NodeId& PartId, TArray<int32>& OutInstanceIds)
+{
+	HAPI_AttributeInfo AttriInfo;
+	FHoudiniApi::AttributeInfo_Init(&AttriInfo);
+
+	OutInstanceIds.Empty();
+	if (!FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+		GeoId, PartId, HAPI_UNREAL_ATTRIB_INSTANCE_ID,
+		AttriInfo, OutInstanceIds, 1, HAPI_ATTROWNER_POINT))
+	{
+		return false;
+	}
+
+	return AttriInfo.exists && OutInstanceIds.Num() > 0;
+}
+
+void
+FHoudiniInstanceTranslator::GetVariationInstanceIds(
+	const TArray<int32>& InVariationInstanceIndices,
+	const TArray<int32>& InOriginalInstanceIndices,
+	const TArray<int32>& InInstanceIds,
+	TArray<int32>& OutVariationInstanceIds)
+{
+	OutVariationInstanceIds.Empty(InVariationInstanceIndices.Num());
+	for (const int32& InstanceIdx : InVariationInstanceIndices)
+	{
+		if (!InOriginalInstanceIndices.IsValidIndex(InstanceIdx)
+			|| !InInstanceIds.IsValidIndex(InOriginalInstanceIndices[InstanceIdx]))
+		{
+			OutVariationInstanceIds.Empty();
+			return;
+		}
+
+		OutVariationInstanceIds.Add(InInstanceIds[InOriginalInstanceIndices[InstanceIdx]]);
+	}
+}
+
 void
 FHoudiniInstancedOutputPartData::BuildFlatInstancedTransformsAndObjectPaths()
 {
@@ -40,7 +40,11 @@ class UStaticMesh;
 class UFoliageType;
 class UHoudiniStaticMesh;
 class UHoudiniInstancedActorComponent;
+class UInstancedStaticMeshComponent;
+class AInstancedFoliageActor;
 struct FHoudiniPackageParams;
+struct FFoliageInfo;
+struct FFoliageInstance;
 
 USTRUCT()
 struct HOUDINIENGINE_API FHoudiniInstancedOutputPerSplitAttributes
@@ -170,6 +174,10 @@ public:
 	// Specifies that the materials in MaterialAttributes are to be created as an instance
 	UPROPERTY()
 	bool bMaterialOverrideNeedsCreateInstance;
+
+	// Stable ids of the instancer's instances (HAPI_UNREAL_ATTRIB_INSTANCE_ID), empty if not present
+	UPROPERTY(Transient)
+	TArray<int32> InstanceIds;
 	
 	// Custom float array per original instanced object
 	// Size is NumCustomFloat * NumberOfInstances
@@ -261,7 +269,8 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			TArray<TSoftObjectPtr<UObject>>& OutVariationsInstancedObjects,
 			TArray<TArray<FTransform>>& OutVariationsInstancedTransforms,
 			TArray<int32>& OutVariationOriginalObjectIdx,
-			TArray<int32>& OutVariationIndices);
+			TArray<int32>& OutVariationIndices,
+			TArray<TArray<int32>>* OutVariationsInstanceIndices = nullptr);
 
 		// Recreates the components after an instanced outputs has been changed
 		static bool UpdateChangedInstancedOutput(
@@ -275,11 +284,17 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 		static void UpdateVariationAssignements(
 			FHoudiniInstancedOutput& InstancedOutput);
 
-		// Extracts the final transforms (with the transform offset applied) for a given variation
+		// Partitions the original transforms by variation in a single pass, and applies the variations' transform offsets.
+		// OutProcessedIndices, if provided, receives the index in the original transforms of each processed transform.
 		static void ProcessInstanceTransforms(
 			FHoudiniInstancedOutput& InstancedOutput,
-			const int32& VariationIdx,
-			TArray<FTransform>& OutProcessedTransforms);
+			TArray<TArray<FTransform>>& OutProcessedTransforms,
+			TArray<TArray<int32>>* OutProcessedIndices = nullptr);
+
+		// Applies a variation's transform offset to its instance transforms
+		static void ApplyTransformOffset(
+			const FTransform& InTransformOffset,
+			TArray<FTransform>& InOutTransforms);
 
 		// Creates a new component or updates the previous one if possible
 		static bool CreateOrUpdateInstanceComponent(
@@ -296,9 +311,13 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const TArray<int32>& OriginalInstancerObjectIndices, 
 			const int32& InstancerObjectIdx = 0,			
 			const bool& bForceHISM = false,
-			const bool& bForceInstancer = false);
+			const bool& bForceInstancer = false,
+			const TArray<int32>* InInstanceIds = nullptr,
+			TArray<int32>* InOutComponentInstanceIds = nullptr);
 
 		// Create or update an ISMC / HISMC
+		// InInstanceIds are the stable ids of InstancedObjectTransforms (if any), InOutComponentInstanceIds
+		// the ids of the reused component's instances, updated to the component's new instance order.
 		static bool CreateOrUpdateInstancedStaticMeshComponent(
 			UStaticMesh* InstancedStaticMesh,
 			const TArray<FTransform>& InstancedObjectTransforms,
@@ -308,7 +327,17 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			USceneComponent*& CreatedInstancedComponent,
 			UMaterialInterface * InstancerMaterial = nullptr,
 			const bool& bForceHISM = false,
-			const int32& InstancerObjectIdx = 0);
+			const int32& InstancerObjectIdx = 0,
+			const TArray<int32>* InInstanceIds = nullptr,
+			TArray<int32>* InOutComponentInstanceIds = nullptr);
+
+		// Only updates, adds or removes the instances of an existing ISMC / HISMC that differ from InstancedObjectTransforms.
+		// Returns false if the component's instances should be fully rebuilt instead.
+		static bool UpdateInstancedStaticMeshComponentInstances(
+			UInstancedStaticMeshComponent* InstancedStaticMeshComponent,
+			const TArray<FTransform>& InstancedObjectTransforms,
+			const TArray<int32>* InInstanceIds,
+			TArray<int32>* InOutComponentInstanceIds);
 
 		// Create or update an IAC
 		static bool CreateOrUpdateInstancedActorComponent(
@@ -363,6 +392,13 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			USceneComponent*& NewInstancedComponent,
 			UMaterialInterface * InstancerMaterial /*=nullptr*/);
 
+		// Adds all the foliage instances to the foliage info in a single batch
+		static void AddFoliageInstances(
+			AInstancedFoliageActor* InInstancedFoliageActor,
+			const UFoliageType* InFoliageType,
+			FFoliageInfo& InFoliageInfo,
+			const TArray<FFoliageInstance>& InFoliageInstances);
+
 		// Helper fumction to properly remove/destroy a component
 		static bool RemoveAndDestroyComponent(
 			UObject* InComponent,
@@ -452,6 +488,16 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 		// Return true if HAPI_UNREAL_ATTRIB_FORCE_INSTANCER is set to non-zero (this controls
 		// if an instancer is created even for single instances (static mesh vs instanced static mesh for example)
 		static bool HasForceInstancerAttribute(const HAPI_NodeId& GeoId, const HAPI_NodeId& PartId);
+
+		// Get the stable instance ids (HAPI_UNREAL_ATTRIB_INSTANCE_ID) of an instancer part, if any
+		static bool GetInstanceIds(const HAPI_NodeId& GeoId, const HAPI_NodeId& PartId, TArray<int32>& OutInstanceIds);
+
+		// Get the stable ids of the instances assigned to a variation of an instanced output
+		static void GetVariationInstanceIds(
+			const TArray<int32>& InVariationInstanceIndices,
+			const TArray<int32>& InOriginalInstanceIndices,
+			const TArray<int32>& InInstanceIds,
+			TArray<int32>& OutVariationInstanceIds);
 	
 		// Checks for PerInstanceCustomData on the instancer part
 		static bool GetPerInstanceCustomData(
@@ -30,6 +30,7 @@
 
 #include "HoudiniAssetComponent.h"
 #include "HoudiniGeoPartObject.h"
+#include "HoudiniHeightfieldConversion.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
@@ -2724,6 +2725,9 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 	if ((HoudiniXSize < 2) || (HoudiniYSize < 2))
 		return false;
 
+	if (HeightfieldFloatValues.Num() < SizeInPoints)
+		return false;
+
 	// Test for potential special cases...
 	// Just print a warning for now
 	if (HeightfieldVolumeInfo.MinX != 0)
@@ -2810,41 +2814,14 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 	// For correct orientation in unreal, the point matrix has to be transposed.
 	IntHeightData.SetNumUninitialized(SizeInPoints);
 	
-	int32 nUnreal = 0;
+	// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
 	bool bValueClippedMin = false;
 	bool bValueClippedMax = false;
-	
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
-	{
-		for (int32 nX = 0; nX < HoudiniXSize; nX++)
-		{
-			// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
-			int32 nHoudini = nY + nX * HoudiniYSize;
-
-			// Get the double values in [0 - ZRange]
-			double DoubleValue = (double)HeightfieldFloatValues[nHoudini];
-
-			// NOTE: Additive (edit) layers should not have their values offset, but they
-			// should be scaled using the same zspacing values as the base layer on the target landscape.
-			if (!bIsAdditive)
-			{
-				DoubleValue -= (double)FloatMin;
-			}
-
-			// Then convert it to [0 - DesiredRange] and center it 
-			DoubleValue = DoubleValue * ZSpacing + DigitCenterOffset;
-
-			if (bIsAdditive)
-			{
-				DoubleValue += LandscapeZeroValue;
-			}
-			bValueClippedMin = bValueClippedMin || (DoubleValue < 0);
-			bValueClippedMax = bValueClippedMax || (DoubleValue >= DigitZRange);
-			
-			const int32 IntValue = FMath::RoundToInt(DoubleValue);
-			IntHeightData[nUnreal++] = FMath::Clamp(IntValue, 0, FMath::RoundToInt(DigitZRange)); 
-		}
-	}
+	FHoudiniHeightfieldConversion::ConvertHeightfieldToLandscapeHeights(
+		HeightfieldFloatValues.GetData(), HoudiniXSize, HoudiniYSize,
+		FloatMin, ZSpacing, DigitCenterOffset, DigitZRange,
+		bIsAdditive, LandscapeZeroValue,
+		IntHeightData.GetData(), bValueClippedMin, bValueClippedMax);
 
 	if (bValueClippedMin)
 	{
@@ -4010,6 +3987,9 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
 	const int32& LandscapeXSize, const int32& LandscapeYSize,
 	TArray<uint8>& LayerData, const bool& NoResize)
 {
+	if (FloatLayerData.Num() < HoudiniXSize * HoudiniYSize)
+		return false;
+
 	// Convert the float data to uint8
 	LayerData.SetNumUninitialized(HoudiniXSize * HoudiniYSize);
 
@@ -4017,23 +3997,11 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
 	double LayerZRange = (LayerMax - LayerMin);
 	double LayerZSpacing = (LayerZRange != 0.0) ? (255.0 / (double)(LayerZRange)) : 0.0;
 
-	int32 nUnrealIndex = 0;
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
-	{
-		for (int32 nX = 0; nX < HoudiniXSize; nX++)
-		{
-			// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
-			int32 nHoudini = nY + nX * HoudiniYSize;
-
-			// Get the double values in [0 - ZRange]
-			double DoubleValue = (double)FMath::Clamp(FloatLayerData[nHoudini], LayerMin, LayerMax) - (double)LayerMin;
-
-			// Then convert it to [0 - 255]
-			DoubleValue *= LayerZSpacing;
-
-			LayerData[nUnrealIndex++] = FMath::RoundToInt(DoubleValue);
-		}
-	}
+	// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
+	FHoudiniHeightfieldConversion::ConvertHeightfieldToLandscapeLayer(
+		FloatLayerData.GetData(), HoudiniXSize, HoudiniYSize,
+		LayerMin, LayerMax, LayerZSpacing,
+		LayerData.GetData());
 
 	// Finally, resize the data to fit with the new landscape size if needed
 	if (NoResize)
@@ -60,7 +60,7 @@
 #include "AI/Navigation/NavCollisionBase.h"
 #include "ObjectTools.h"
 
-// #include "Async/ParallelFor.h"
+#include "Async/ParallelFor.h"
 
 #include "ProfilingDebugging/CpuProfilerTrace.h"
 
@@ -81,6 +81,14 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineMeshBuildTimer(
 	TEXT("When enabled, the plugin will output timings during the Mesh creation.\n")
 );
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineParallelMeshBuild(
+	TEXT("HoudiniEngine.ParallelMeshBuild"),
+	1,
+	TEXT("When enabled, the MeshDescriptions of a part's LODs and colliders are built concurrently on worker threads.\n")
+	TEXT("0: Build the splits serially on the game thread.\n")
+	TEXT("1: Build the splits in parallel (default).\n")
+);
+
 // 
 bool
 FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
@@ -905,6 +913,50 @@ FHoudiniMeshTranslator::ResetPartCache()
 	// LOD Screensize
 	PartLODScreensize.Empty();
 	FHoudiniApi::AttributeInfo_Init(&AttribInfoLODScreensize);
+
+	// Batched attributes
+	PartAttributeRequests.Reset(HGPO.GeoId, HGPO.PartId, HGPO.PartInfo);
+}
+
+void
+FHoudiniMeshTranslator::PrefetchPartAttributes()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::PrefetchPartAttributes"));
+
+	// List the part's attributes first, we need to know if uv1 exists to pick the uv set names
+	if (!PartAttributeRequests.ResolveAttributeNames())
+		return;
+
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	bool bReadNormals = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->RecomputeNormalsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always : true;
+	bool bReadTangents = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->RecomputeTangentsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always : true;
+
+	PartAttributeRequests.AddFloatRequest(HAPI_UNREAL_ATTRIB_POSITION);
+
+	if (bReadNormals)
+		PartAttributeRequests.AddFloatRequest(HAPI_UNREAL_ATTRIB_NORMAL);
+
+	if (bReadTangents)
+	{
+		PartAttributeRequests.AddFloatRequest(HAPI_UNREAL_ATTRIB_TANGENTU);
+		PartAttributeRequests.AddFloatRequest(HAPI_UNREAL_ATTRIB_TANGENTV);
+	}
+
+	PartAttributeRequests.AddFloatRequest(HAPI_UNREAL_ATTRIB_COLOR);
+	PartAttributeRequests.AddFloatRequest(HAPI_UNREAL_ATTRIB_ALPHA);
+
+	// Same naming logic as UpdatePartUVSetsIfNeeded()
+	bool bUV1Exists = PartAttributeRequests.HasAttribute("uv1");
+	for (int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx)
+	{
+		FString UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
+		if (TexCoordIdx > 0)
+			UVAttributeName += FString::Printf(TEXT("%d"), bUV1Exists ? TexCoordIdx : TexCoordIdx + 1);
+
+		PartAttributeRequests.AddFloatRequest(TCHAR_TO_UTF8(*UVAttributeName), 2);
+	}
+
+	PartAttributeRequests.Fetch();
 }
 
 bool
@@ -916,9 +968,13 @@ FHoudiniMeshTranslator::UpdatePartPositionIfNeeded()
 	if (PartPositions.Num() > 0)
 		return true;
 
-	if (!FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
-		HAPI_UNREAL_ATTRIB_POSITION, AttribInfoPositions, PartPositions))
+	bool Success = PartAttributeRequests.HasFetched(HAPI_UNREAL_ATTRIB_POSITION)
+		? PartAttributeRequests.MoveFloatData(HAPI_UNREAL_ATTRIB_POSITION, AttribInfoPositions, PartPositions)
+		: FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+			HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
+			HAPI_UNREAL_ATTRIB_POSITION, AttribInfoPositions, PartPositions);
+
+	if (!Success)
 	{
 		// Error retrieving positions.
 		HOUDINI_LOG_WARNING(
@@ -946,9 +1002,11 @@ FHoudiniMeshTranslator::UpdatePartNormalsIfNeeded()
 		return true;
 
 	// Retrieve normal data for this part
-	bool Success = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
-		HAPI_UNREAL_ATTRIB_NORMAL, AttribInfoNormals, PartNormals);
+	bool Success = PartAttributeRequests.HasFetched(HAPI_UNREAL_ATTRIB_NORMAL)
+		? PartAttributeRequests.MoveFloatData(HAPI_UNREAL_ATTRIB_NORMAL, AttribInfoNormals, PartNormals)
+		: FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+			HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
+			HAPI_UNREAL_ATTRIB_NORMAL, AttribInfoNormals, PartNormals);
 
 	// There is no normals to fetch
 	if (!AttribInfoNormals.exists)
@@ -975,9 +1033,11 @@ FHoudiniMeshTranslator::UpdatePartTangentsIfNeeded()
 	if (PartTangentU.Num() <= 0)
 	{
 		// Retrieve TangentU data for this part
-		bool Success = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-			HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
-			HAPI_UNREAL_ATTRIB_TANGENTU, AttribInfoTangentU, PartTangentU);
+		bool Success = PartAttributeRequests.HasFetched(HAPI_UNREAL_ATTRIB_TANGENTU)
+			? PartAttributeRequests.MoveFloatData(HAPI_UNREAL_ATTRIB_TANGENTU, AttribInfoTangentU, PartTangentU)
+			: FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+				HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
+				HAPI_UNREAL_ATTRIB_TANGENTU, AttribInfoTangentU, PartTangentU);
 		
 		if (!Success && AttribInfoTangentU.exists)
 		{
@@ -992,9 +1052,11 @@ FHoudiniMeshTranslator::UpdatePartTangentsIfNeeded()
 	if (PartTangentV.Num() <= 0)
 	{
 		// Retrieve TangentV data for this part
-		bool Success = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-			HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
-			HAPI_UNREAL_ATTRIB_TANGENTV, AttribInfoTangentV, PartTangentV);
+		bool Success = PartAttributeRequests.HasFetched(HAPI_UNREAL_ATTRIB_TANGENTV)
+			? PartAttributeRequests.MoveFloatData(HAPI_UNREAL_ATTRIB_TANGENTV, AttribInfoTangentV, PartTangentV)
+			: FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+				HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
+				HAPI_UNREAL_ATTRIB_TANGENTV, AttribInfoTangentV, PartTangentV);
 
 		if (!Success && AttribInfoTangentV.exists)
 		{
@@ -1018,9 +1080,11 @@ FHoudiniMeshTranslator::UpdatePartColorsIfNeeded()
 	if (PartColors.Num() > 0)
 		return true;
 
-	bool Success = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
-		HAPI_UNREAL_ATTRIB_COLOR, AttribInfoColors, PartColors);
+	bool Success = PartAttributeRequests.HasFetched(HAPI_UNREAL_ATTRIB_COLOR)
+		? PartAttributeRequests.MoveFloatData(HAPI_UNREAL_ATTRIB_COLOR, AttribInfoColors, PartColors)
+		: FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+			HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
+			HAPI_UNREAL_ATTRIB_COLOR, AttribInfoColors, PartColors);
 
 	if (!Success && AttribInfoColors.exists)
 	{
@@ -1043,9 +1107,11 @@ FHoudiniMeshTranslator::UpdatePartAlphasIfNeeded()
 	if (PartAlphas.Num() > 0)
 		return true;
 
-	bool Success = FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-		HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
-		HAPI_UNREAL_ATTRIB_ALPHA, AttribInfoAlpha, PartAlphas);
+	bool Success = PartAttributeRequests.HasFetched(HAPI_UNREAL_ATTRIB_ALPHA)
+		? PartAttributeRequests.MoveFloatData(HAPI_UNREAL_ATTRIB_ALPHA, AttribInfoAlpha, PartAlphas)
+		: FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+			HGPO.GeoInfo.NodeId, HGPO.PartInfo.PartId,
+			HAPI_UNREAL_ATTRIB_ALPHA, AttribInfoAlpha, PartAlphas);
 
 	if (!Success && AttribInfoAlpha.exists)
 	{
@@ -1097,7 +1163,9 @@ FHoudiniMeshTranslator::UpdatePartUVSetsIfNeeded(const bool& bRemoveUnused)
 
 	// The second UV set should be called uv2, but we will still check if need to look for a uv1 set.
 	// If uv1 exists, we'll look for uv, uv1, uv2 etc.. if not we'll look for uv, uv2, uv3 etc..
-	bool bUV1Exists = FHoudiniEngineUtils::HapiCheckAttributeExists(HGPO.GeoId, HGPO.PartId, "uv1");
+	bool bUV1Exists = PartAttributeRequests.HasFetched("uv")
+		? PartAttributeRequests.HasAttribute("uv1")
+		: FHoudiniEngineUtils::HapiCheckAttributeExists(HGPO.GeoId, HGPO.PartId, "uv1");
 
 	// Retrieve UVs.
 	for (int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx)
@@ -1107,9 +1175,18 @@ FHoudiniMeshTranslator::UpdatePartUVSetsIfNeeded(const bool& bRemoveUnused)
 			UVAttributeName += FString::Printf(TEXT("%d"), bUV1Exists ? TexCoordIdx : TexCoordIdx + 1);
 
 		FHoudiniApi::AttributeInfo_Init(&AttribInfoUVSets[TexCoordIdx]);
-		FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-			HGPO.GeoId, HGPO.PartId, TCHAR_TO_ANSI(*UVAttributeName),
-			AttribInfoUVSets[TexCoordIdx], PartUVSets[TexCoordIdx], 2);
+		if (PartAttributeRequests.HasFetched(TCHAR_TO_UTF8(*UVAttributeName)))
+		{
+			PartAttributeRequests.MoveFloatData(
+				TCHAR_TO_UTF8(*UVAttributeName),
+				AttribInfoUVSets[TexCoordIdx], PartUVSets[TexCoordIdx]);
+		}
+		else
+		{
+			FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+				HGPO.GeoId, HGPO.PartId, TCHAR_TO_ANSI(*UVAttributeName),
+				AttribInfoUVSets[TexCoordIdx], PartUVSets[TexCoordIdx], 2);
+		}
 	}
 
 	// Also look for 16.5 uvs (attributes with a Texture type) 
@@ -1455,6 +1532,9 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 	// Resets the containers used for the raw data extraction.
 	ResetPartCache();
 
+	// Fetch the part's main attributes in one pass
+	PrefetchPartAttributes();
+
 	// Prepare the object that will store UCX and simple colliders
 	AllAggregateCollisions.Empty();
 
@@ -2900,6 +2980,9 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 	// Resets the containers used for the raw data extraction.
 	ResetPartCache();
 
+	// Fetch the part's main attributes in one pass
+	PrefetchPartAttributes();
+
 	// Prepare the object that will store UCX and simple colliders
 	AllAggregateCollisions.Empty();
 
@@ -2952,13 +3035,22 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 	bool bAssignedCustomCollisionMesh = false;
 	ECollisionTraceFlag MainStaticMeshCTF = StaticMeshGenerationProperties.GeneratedCollisionTraceFlag;
 
+	// No need to read the tangents if we want unreal to recompute them after
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	bool bReadTangents = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->RecomputeTangentsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always : true;
+
+	// The splits are processed in three passes:
+	// - the colliders, static meshes, source models and materials are prepared in order on the game thread,
+	// - the MeshDescriptions are then built, concurrently if possible, as they only rely on the part's cached data,
+	// - the MeshDescriptions are finally committed and the static meshes updated, on the game thread.
+	TArray<FHoudiniMeshSplitBuildJob> SplitBuildJobs;
+	SplitBuildJobs.Reserve(AllSplitGroups.Num());
+
 	// Iterate through all detected split groups we care about and split geometry.
 	// The split are ordered in the following way:
 	// Invisible Simple/Convex Colliders > LODs > MainGeo > Visible Colliders > Invisible Colliders
 	for (int32 SplitId = 0; SplitId < AllSplitGroups.Num(); SplitId++)
 	{
-		double split_tick = FPlatformTime::Seconds();
-
 		// Get split group name
 		const FString& SplitGroupName = AllSplitGroups[SplitId];
 
@@ -3104,6 +3196,11 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		}
 		FoundOutputObject->bProxyIsCurrent = false;
 
+		// Add the Static mesh to the output maps now, so the following splits (LODs) can find and reuse it
+		FoundOutputObject->OutputObject = FoundStaticMesh;
+		FoundOutputObject->bIsImplicit = false;
+		OutputObjects.FindOrAdd(OutputObjectIdentifier, *FoundOutputObject);
+
 		// TODO: Needed?
 		// Free any RHI resources for existing mesh before we re-create in place.
 		FoundStaticMesh->PreEditChange(NULL);
@@ -3155,9 +3252,8 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 				LODIndex--;
 		}
 
-		// Grab the appropriate SourceModel
-		FStaticMeshSourceModel* SrcModel = (FoundStaticMesh->IsSourceModelValid(LODIndex)) ? &(FoundStaticMesh->GetSourceModel(LODIndex)) : nullptr;
-		if (!SrcModel)
+		// Make sure we can access the appropriate SourceModel
+		if (!FoundStaticMesh->IsSourceModelValid(LODIndex))
 		{
 			HOUDINI_LOG_ERROR(
 				TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d, %s] Could not access SourceModel for the LOD %d - skipping."),
@@ -3165,753 +3261,352 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			continue;
 		}
 
-		if (bDoTiming)
-		{
-			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - PreMeshDescription in %f seconds."), FPlatformTime::Seconds() - tick);
-			tick = FPlatformTime::Seconds();
-		}
-
-		bool bHasNormal = false;
-		bool bHasTangents = false;
+		FHoudiniMeshSplitBuildJob& CurrentJob = SplitBuildJobs.AddDefaulted_GetRef();
+		CurrentJob.SplitGroupName = SplitGroupName;
+		CurrentJob.SplitId = SplitId;
+		CurrentJob.SplitType = SplitType;
+		CurrentJob.OutputObjectIdentifier = OutputObjectIdentifier;
+		CurrentJob.StaticMesh = FoundStaticMesh;
+		CurrentJob.LODIndex = LODIndex;
+		CurrentJob.bNewStaticMeshCreated = bNewStaticMeshCreated;
+		CurrentJob.bRebuildMesh = bRebuildStaticMesh;
 
 		// Load the existing mesh description if we don't need to rebuild the mesh		
-		FMeshDescription* MeshDescription;
 		if (!bRebuildStaticMesh)
 		{
 			// We dont need to rebuild the mesh itself:
 			// the geometry hasn't changed, but the materials have.
 			// We can just reuse the old MeshDescription and reuse it.
-			MeshDescription = FoundStaticMesh->GetMeshDescription(LODIndex);
+			CurrentJob.MeshDescription = FoundStaticMesh->GetMeshDescription(LODIndex);
+			continue;
 		}
-		else
-		{
-			// Extract all the data needed for this split
-			// Start by initializing the MeshDescription for this LOD			
-			MeshDescription = FoundStaticMesh->CreateMeshDescription(LODIndex);
-			FStaticMeshAttributes(*MeshDescription).Register();
-
-			// Mesh description uses material to create its PolygonGroups,
-			// so we first need to know how many different materials we have for this split
-			// and what vertices/indices belong to each material for remapping
-
-			//--------------------------------------------------------------------------------------------------------------------- 
-			//  INDICES
-			//--------------------------------------------------------------------------------------------------------------------- 
-
-			//
-			// Because of the splits, we don't need to declare all the vertices in the Part, 
-			// but only the one that are currently used by the split's faces.
-			// The indicesMapper array is used to map those indices from Part Vertices to Split Vertices.
-			// We also keep track of the needed vertices index to declare them easily afterwards.
-			//
-
-			// SplitNeededVertices
-			// Array containing the (unique) part indices for the vertices that are needed for this split
-			// SplitNeededVertices[splitIndex] = PartIndex
-			TArray<int32> SplitNeededVertices;
-			//SplitNeededVertices.SetNumZeroed(SplitVertexCount);
-
-			// IndicesMapper:
-			// Maps index values for all vertices in the Part:
-			// - Vertices unused by the split will be set to -1
-			// - Used vertices will have their value set to the "NewIndex" so that IndicesMapper[ partIndex ] => splitIndex
-			TArray<int32> PartToSplitIndicesMapper;
-			PartToSplitIndicesMapper.Init(-1, SplitVertexList.Num());
-			//TMap<int32, int32> SplitToPartIndicesMapper;
-
-			// SplitIndices
-			// Array of SplitIndices used to describe this split's polygons
-			TArray<uint32> SplitIndices;
-			SplitIndices.SetNumZeroed(SplitVertexCount);
-
-			int32 CurrentSplitIndex = 0;
-			int32 ValidVertexId = 0;
-			bool bHasInvalidFaceIndices = false;
-			for (int32 VertexIdx = 0; VertexIdx < SplitVertexList.Num(); VertexIdx += 3)
-			{
-				int32 WedgeCheck = SplitVertexList[VertexIdx + 0];
-				if (WedgeCheck == -1)
-					continue;
-
-				int32 WedgeIndices[3] =
-				{
-					SplitVertexList[VertexIdx + 0],
-					SplitVertexList[VertexIdx + 1],
-					SplitVertexList[VertexIdx + 2]
-				};
-
-				// Ensure the indices are valid
-				if (!PartToSplitIndicesMapper.IsValidIndex(WedgeIndices[0])
-					|| !PartToSplitIndicesMapper.IsValidIndex(WedgeIndices[1])
-					|| !PartToSplitIndicesMapper.IsValidIndex(WedgeIndices[2]))
-				{
-					// Invalid face index.
-					bHasInvalidFaceIndices = true;
-					continue;
-				}
-
-				// Converting Old (Part) Indices to New (Split) Indices:
-				for (int32 i = 0; i < 3; i++)
-				{
-					if (PartToSplitIndicesMapper[WedgeIndices[i]] < 0)
-					{
-						// This part index has not yet been "converted" to a new split index
-						SplitNeededVertices.Add(WedgeIndices[i]);
-						PartToSplitIndicesMapper[WedgeIndices[i]] = CurrentSplitIndex;
-						//SplitToPartIndicesMapper.Add(CurrentSplitIndex, WedgeIndices[i]);
-						CurrentSplitIndex++;
-					}
 
-					// Replace the old part index with the new split index
-					WedgeIndices[i] = PartToSplitIndicesMapper[WedgeIndices[i]];
-				}
-
-				if (!SplitIndices.IsValidIndex(ValidVertexId + 2))
-					break;
-
-				// Flip wedge indices to fix the winding order.
-				SplitIndices[ValidVertexId + 0] = WedgeIndices[0];
-				SplitIndices[ValidVertexId + 1] = WedgeIndices[2];
-				SplitIndices[ValidVertexId + 2] = WedgeIndices[1];
-
-				ValidVertexId += 3;
-			}
-
-			if (bHasInvalidFaceIndices)
-			{
-				HOUDINI_LOG_MESSAGE(
-					TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] has some invalid face indices"),
-					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
-			}
-			
-			if (bDoTiming)
-			{
-				HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Indices in %f seconds."), FPlatformTime::Seconds() - tick);
-				tick = FPlatformTime::Seconds();
-			}
+		// Initialize the MeshDescription for this LOD, it will be filled by the build pass
+		CurrentJob.MeshDescription = FoundStaticMesh->CreateMeshDescription(LODIndex);
 
-			//--------------------------------------------------------------------------------------------------------------------- 
-			// POSITIONS
-			//--------------------------------------------------------------------------------------------------------------------- 			
-			
-			// Extract position for this part
-			UpdatePartPositionIfNeeded();
+		// Extract all the part data needed by the build pass now, as it cannot call HAPI
+		UpdatePartPositionIfNeeded();
+		UpdatePartNormalsIfNeeded();
+		if (bReadTangents)
+			UpdatePartTangentsIfNeeded();
+		UpdatePartColorsIfNeeded();
+		UpdatePartAlphasIfNeeded();
+		UpdatePartUVSetsIfNeeded(true);
+		UpdatePartFaceSmoothingIfNeeded();
+		UpdatePartLightmapResolutionsIfNeeded();
 
-			// Transfer vertex positions:
-			//
-			// Because of the split, we're only interested in the needed vertices.
-			// Instead of declaring all the Positions, we'll only declare the vertices
-			// needed by the current split.
-			//
-			TVertexAttributesRef<FVector> VertexPositions =
-				MeshDescription->VertexAttributes().GetAttributesRef<FVector>(MeshAttribute::Vertex::Position);
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// MATERIALS
+		//---------------------------------------------------------------------------------------------------------------------
+		
+		// Mesh description uses material to create its PolygonGroups,
+		// so we first need to know how many different materials we have for this split
+		// and what vertices/indices belong to each material for remapping
+		TArray<FStaticMaterial>& FoundStaticMaterials = FoundStaticMesh->GetStaticMaterials();
 
-			bool bHasInvalidPositionIndexData = false;
-			MeshDescription->ReserveNewVertices(SplitNeededVertices.Num());
-			for ( const int32& NeededVertexIndex : SplitNeededVertices)
-			{
-				// Create a new Vertex
-				FVertexID VertexID = MeshDescription->CreateVertex();
-				if (PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
-				{
-					// We need to swap Z and Y coordinate here, and convert from m to cm. 
-					VertexPositions[VertexID].X = PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-					VertexPositions[VertexID].Y = PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-					VertexPositions[VertexID].Z = PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
-				}
-				else
-				{
-					// Error when retrieving positions.
-					bHasInvalidPositionIndexData = true;
+		// // TODO: Check if still needed for MeshDescription
+		// // We need to reset the Static Mesh's materials once per SM:
+		// // so, for the first lod, or the main geo...
+		// if (!MeshMaterialsHaveBeenReset && (SplitType == EHoudiniSplitType::LOD || SplitType == EHoudiniSplitType::Normal))
+		// {
+		// 	FoundStaticMaterials.Empty();
+		// 	MeshMaterialsHaveBeenReset = true;
+		// }
+		//
+		// // ..  or for each visible complex collider
+		// if (SplitType == EHoudiniSplitType::RenderedComplexCollider)
+		// 	FoundStaticMaterials.Empty();
 
-					continue;
-				}
-			}
+		// Clear the materials array of the mesh the first time we encounter it
+		if (!MapUnrealMaterialInterfaceToUnrealIndexPerMesh.Contains(FoundStaticMesh))
+		{
+			FoundStaticMaterials.Empty();
+		}
+		TMap<UMaterialInterface*, int32>& MapUnrealMaterialInterfaceToUnrealMaterialIndexThisMesh = MapUnrealMaterialInterfaceToUnrealIndexPerMesh.FindOrAdd(FoundStaticMesh);
 
-			if (bHasInvalidPositionIndexData)
-			{
-				HOUDINI_LOG_WARNING(
-					TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
-					TEXT("- skipping."),
-					HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
-			}
-			
-			if (bDoTiming)
-			{
-				HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Positions in %f seconds."), FPlatformTime::Seconds() - tick);
-				tick = FPlatformTime::Seconds();
-			}
+		// Get this split's faces
+		TArray<int32>& SplitGroupFaceIndices = AllSplitFaceIndices[SplitGroupName];
+		// Array holding the materials needed for this split
+		//TArray<UMaterialInterface*> SplitMaterials;
+		// Split Material indices per face, by default all faces are set to use the first Material
+		TArray<int32>& SplitFaceMaterialIndices = CurrentJob.FaceMaterialIndices;
+		SplitFaceMaterialIndices.SetNumZeroed(SplitGroupFaceIndices.Num());
 
-			//--------------------------------------------------------------------------------------------------------------------- 
-			// MATERIALS
-			//---------------------------------------------------------------------------------------------------------------------
-			
-			TArray<FStaticMaterial>& FoundStaticMaterials = FoundStaticMesh->GetStaticMaterials();
-
-			// // TODO: Check if still needed for MeshDescription
-			// // We need to reset the Static Mesh's materials once per SM:
-			// // so, for the first lod, or the main geo...
-			// if (!MeshMaterialsHaveBeenReset && (SplitType == EHoudiniSplitType::LOD || SplitType == EHoudiniSplitType::Normal))
-			// {
-			// 	FoundStaticMaterials.Empty();
-			// 	MeshMaterialsHaveBeenReset = true;
-			// }
-			//
-			// // ..  or for each visible complex collider
-			// if (SplitType == EHoudiniSplitType::RenderedComplexCollider)
-			// 	FoundStaticMaterials.Empty();
+		bool HasHoudiniMaterials = PartUniqueMaterialIds.Num() > 0;
+		bool HasMaterialOverrides = PartFaceMaterialOverrides.Num() > 0;
+		if (!HasHoudiniMaterials && !HasMaterialOverrides)
+		{
+			// We don't have any material override or houdini material
+			// we just need one polygon group using the default Houdini material.
+			UMaterialInterface * MaterialInterface = Cast<UMaterialInterface>(FHoudiniEngine::Get().GetHoudiniDefaultMaterial(HGPO.bIsTemplated).Get());
 
-			// Clear the materials array of the mesh the first time we encounter it
-			if (!MapUnrealMaterialInterfaceToUnrealIndexPerMesh.Contains(FoundStaticMesh))
-			{
-				FoundStaticMaterials.Empty();
-			}
-			TMap<UMaterialInterface*, int32>& MapUnrealMaterialInterfaceToUnrealMaterialIndexThisMesh = MapUnrealMaterialInterfaceToUnrealIndexPerMesh.FindOrAdd(FoundStaticMesh);
+			// See if we have a replacement material and use it on the mesh instead
+			UMaterialInterface * const * ReplacementMaterial = ReplacementMaterials.Find(HAPI_UNREAL_DEFAULT_MATERIAL_NAME);
+			if (ReplacementMaterial && *ReplacementMaterial)
+				MaterialInterface = *ReplacementMaterial;
 
-			// Get this split's faces
-			TArray<int32>& SplitGroupFaceIndices = AllSplitFaceIndices[SplitGroupName];
-			// Array holding the materials needed for this split
-			//TArray<UMaterialInterface*> SplitMaterials;
-			// Split Material indices per face, by default all faces are set to use the first Material
-			TArray<int32> SplitFaceMaterialIndices;
-			SplitFaceMaterialIndices.SetNumZeroed(SplitGroupFaceIndices.Num());
+			FoundStaticMaterials.Empty();
+			FoundStaticMaterials.Add(MaterialInterface);
 
-			bool HasHoudiniMaterials = PartUniqueMaterialIds.Num() > 0;
-			bool HasMaterialOverrides = PartFaceMaterialOverrides.Num() > 0;
-			if (!HasHoudiniMaterials && !HasMaterialOverrides)
+			// TODO: ? Add default mat to the assignement map?
+		}
+		else if (HasHoudiniMaterials && !HasMaterialOverrides)
+		{
+			// We have Houdini Material but no overrides
+			if (bOnlyOneFaceMaterial || PartUniqueMaterialIds.Num() == 1)
 			{
-				// We don't have any material override or houdini material
-				// we just need one polygon group using the default Houdini material.
+				// We have only one Houdini material.
+				// Use default Houdini material if no valid material is assigned to any of the faces.
 				UMaterialInterface * MaterialInterface = Cast<UMaterialInterface>(FHoudiniEngine::Get().GetHoudiniDefaultMaterial(HGPO.bIsTemplated).Get());
 
+				// Get id of this single material.
+				FString MaterialPathName = HAPI_UNREAL_DEFAULT_MATERIAL_NAME;
+				FHoudiniMaterialTranslator::GetMaterialRelativePath(HGPO.AssetId, PartFaceMaterialIds[0], MaterialPathName);
+				UMaterialInterface * const * FoundMaterial = OutputAssignmentMaterials.Find(MaterialPathName);
+				if (FoundMaterial)
+					MaterialInterface = *FoundMaterial;
+
 				// See if we have a replacement material and use it on the mesh instead
-				UMaterialInterface * const * ReplacementMaterial = ReplacementMaterials.Find(HAPI_UNREAL_DEFAULT_MATERIAL_NAME);
+				UMaterialInterface * const * ReplacementMaterial = ReplacementMaterials.Find(MaterialPathName);
 				if (ReplacementMaterial && *ReplacementMaterial)
 					MaterialInterface = *ReplacementMaterial;
 
 				FoundStaticMaterials.Empty();
 				FoundStaticMaterials.Add(MaterialInterface);
 
-				// TODO: ? Add default mat to the assignement map?
+				// TODO: ? Add the mat to the assignement map?
 			}
-			else if (HasHoudiniMaterials && !HasMaterialOverrides)
+			else
 			{
-				// We have Houdini Material but no overrides
-				if (bOnlyOneFaceMaterial || PartUniqueMaterialIds.Num() == 1)
-				{
-					// We have only one Houdini material.
-					// Use default Houdini material if no valid material is assigned to any of the faces.
-					UMaterialInterface * MaterialInterface = Cast<UMaterialInterface>(FHoudiniEngine::Get().GetHoudiniDefaultMaterial(HGPO.bIsTemplated).Get());
-
-					// Get id of this single material.
-					FString MaterialPathName = HAPI_UNREAL_DEFAULT_MATERIAL_NAME;
-					FHoudiniMaterialTranslator::GetMaterialRelativePath(HGPO.AssetId, PartFaceMaterialIds[0], MaterialPathName);
-					UMaterialInterface * const * FoundMaterial = OutputAssignmentMaterials.Find(MaterialPathName);
-					if (FoundMaterial)
-						MaterialInterface = *FoundMaterial;
-
-					// See if we have a replacement material and use it on the mesh instead
-					UMaterialInterface * const * ReplacementMaterial = ReplacementMaterials.Find(MaterialPathName);
-					if (ReplacementMaterial && *ReplacementMaterial)
-						MaterialInterface = *ReplacementMaterial;
-
-					FoundStaticMaterials.Empty();
-					FoundStaticMaterials.Add(MaterialInterface);
-
-					// TODO: ? Add the mat to the assignement map?
-				}
-				else
-				{
-					// We have multiple houdini materials
-					// Get default Houdini material.
-					UMaterial * MaterialDefault = FHoudiniEngine::Get().GetHoudiniDefaultMaterial(HGPO.bIsTemplated).Get();
+				// We have multiple houdini materials
+				// Get default Houdini material.
+				UMaterial * MaterialDefault = FHoudiniEngine::Get().GetHoudiniDefaultMaterial(HGPO.bIsTemplated).Get();
 
-					// Reset Rawmesh material face assignments.
-					for (int32 FaceIdx = 0; FaceIdx < SplitGroupFaceIndices.Num(); ++FaceIdx)
-					{
-						int32 SplitFaceIndex = SplitGroupFaceIndices[FaceIdx];
-						if (!PartFaceMaterialIds.IsValidIndex(SplitFaceIndex))
-							continue;
+				// Reset Rawmesh material face assignments.
+				for (int32 FaceIdx = 0; FaceIdx < SplitGroupFaceIndices.Num(); ++FaceIdx)
+				{
+					int32 SplitFaceIndex = SplitGroupFaceIndices[FaceIdx];
+					if (!PartFaceMaterialIds.IsValidIndex(SplitFaceIndex))
+						continue;
 
-						// Get material id for this face.
-						HAPI_NodeId MaterialId = PartFaceMaterialIds[SplitFaceIndex];
+					// Get material id for this face.
+					HAPI_NodeId MaterialId = PartFaceMaterialIds[SplitFaceIndex];
 
-						// See if we have already treated that material
-						UMaterialInterface** FoundMaterialInterface = MapHoudiniMatIdToUnrealInterface.Find(MaterialId);
-						UMaterialInterface* MaterialInterface = nullptr;
-						if (FoundMaterialInterface)
-							MaterialInterface = *FoundMaterialInterface;
+					// See if we have already treated that material
+					UMaterialInterface** FoundMaterialInterface = MapHoudiniMatIdToUnrealInterface.Find(MaterialId);
+					UMaterialInterface* MaterialInterface = nullptr;
+					if (FoundMaterialInterface)
+						MaterialInterface = *FoundMaterialInterface;
 
-						if (MaterialInterface)
+					if (MaterialInterface)
+					{
+						int32 const * FoundUnrealMatIndex = MapUnrealMaterialInterfaceToUnrealMaterialIndexThisMesh.Find(MaterialInterface);
+						if (FoundUnrealMatIndex)
 						{
-							int32 const * FoundUnrealMatIndex = MapUnrealMaterialInterfaceToUnrealMaterialIndexThisMesh.Find(MaterialInterface);
-							if (FoundUnrealMatIndex)
-							{
-								// This material has been mapped already, just assign the mat index
-								SplitFaceMaterialIndices[FaceIdx] = *FoundUnrealMatIndex;
-								continue;
-							}
+							// This material has been mapped already, just assign the mat index
+							SplitFaceMaterialIndices[FaceIdx] = *FoundUnrealMatIndex;
+							continue;
 						}
-						else
-						{
-							MaterialInterface = Cast<UMaterialInterface>(MaterialDefault);
-
-							FString MaterialPathName = HAPI_UNREAL_DEFAULT_MATERIAL_NAME;
-							FHoudiniMaterialTranslator::GetMaterialRelativePath(HGPO.AssetId, MaterialId, MaterialPathName);
-							UMaterialInterface * const * FoundMaterial = OutputAssignmentMaterials.Find(MaterialPathName);
-							if (FoundMaterial)
-								MaterialInterface = *FoundMaterial;
+					}
+					else
+					{
+						MaterialInterface = Cast<UMaterialInterface>(MaterialDefault);
 
-							// See if we have a replacement material and use it on the mesh instead
-							UMaterialInterface * const * ReplacementMaterial = ReplacementMaterials.Find(MaterialPathName);
-							if (ReplacementMaterial && *ReplacementMaterial)
-								MaterialInterface = *ReplacementMaterial;
+						FString MaterialPathName = HAPI_UNREAL_DEFAULT_MATERIAL_NAME;
+						FHoudiniMaterialTranslator::GetMaterialRelativePath(HGPO.AssetId, MaterialId, MaterialPathName);
+						UMaterialInterface * const * FoundMaterial = OutputAssignmentMaterials.Find(MaterialPathName);
+						if (FoundMaterial)
+							MaterialInterface = *FoundMaterial;
 
-							MapHoudiniMatIdToUnrealInterface.Add(MaterialId, MaterialInterface);
-						}
+						// See if we have a replacement material and use it on the mesh instead
+						UMaterialInterface * const * ReplacementMaterial = ReplacementMaterials.Find(MaterialPathName);
+						if (ReplacementMaterial && *ReplacementMaterial)
+							MaterialInterface = *ReplacementMaterial;
 
-						if (MaterialInterface)
-						{
-							// Add the material to the Static mesh
-							//int32 UnrealMatIndex = SplitMaterials.Add(Material);
-							int32 UnrealMatIndex = FoundStaticMaterials.Add(MaterialInterface);
+						MapHoudiniMatIdToUnrealInterface.Add(MaterialId, MaterialInterface);
+					}
+
+					if (MaterialInterface)
+					{
+						// Add the material to the Static mesh
+						//int32 UnrealMatIndex = SplitMaterials.Add(Material);
+						int32 UnrealMatIndex = FoundStaticMaterials.Add(MaterialInterface);
 
-							// Map the houdini ID to the unreal one
-							MapUnrealMaterialInterfaceToUnrealMaterialIndexThisMesh.Add(MaterialInterface, UnrealMatIndex);
+						// Map the houdini ID to the unreal one
+						MapUnrealMaterialInterfaceToUnrealMaterialIndexThisMesh.Add(MaterialInterface, UnrealMatIndex);
 
-							// Update the face index
-							SplitFaceMaterialIndices[FaceIdx] = UnrealMatIndex;
-						}
+						// Update the face index
+						SplitFaceMaterialIndices[FaceIdx] = UnrealMatIndex;
 					}
 				}
 			}
-			else
+		}
+		else
+		{
+			// Array used to avoid constantly attempting to load invalid materials
+			TArray<FString> InvalidMaterials;
+
+			// If we have material overrides
+			for (int32 FaceIdx = 0; FaceIdx < SplitGroupFaceIndices.Num(); ++FaceIdx)
 			{
-				// Array used to avoid constantly attempting to load invalid materials
-				TArray<FString> InvalidMaterials;
+				int32 SplitFaceIndex = SplitGroupFaceIndices[FaceIdx];
 
-				// If we have material overrides
-				for (int32 FaceIdx = 0; FaceIdx < SplitGroupFaceIndices.Num(); ++FaceIdx)
+				UMaterialInterface * MaterialInterface = nullptr;
+				int32 CurrentFaceMaterialIdx = -1;
+				if (PartFaceMaterialOverrides.IsValidIndex(SplitFaceIndex))
 				{
-					int32 SplitFaceIndex = SplitGroupFaceIndices[FaceIdx];
+					const FString & MaterialName = PartFaceMaterialOverrides[SplitFaceIndex];
+					UMaterialInterface** FoundMaterialInterface = MapHoudiniMatAttributesToUnrealInterface.Find(MaterialName);
+					if (FoundMaterialInterface)
+						MaterialInterface = *FoundMaterialInterface;
 
-					UMaterialInterface * MaterialInterface = nullptr;
-					int32 CurrentFaceMaterialIdx = -1;
-					if (PartFaceMaterialOverrides.IsValidIndex(SplitFaceIndex))
+					if (!MaterialInterface)
 					{
-						const FString & MaterialName = PartFaceMaterialOverrides[SplitFaceIndex];
-						UMaterialInterface** FoundMaterialInterface = MapHoudiniMatAttributesToUnrealInterface.Find(MaterialName);
+						// Try to locate the corresponding material interface
+
+						// Start by looking in our assignment map
+						FoundMaterialInterface = OutputAssignmentMaterials.Find(MaterialName);
 						if (FoundMaterialInterface)
 							MaterialInterface = *FoundMaterialInterface;
 
-						if (!MaterialInterface)
+						if (!MaterialInterface && !MaterialName.IsEmpty() && !InvalidMaterials.Contains(MaterialName))
 						{
-							// Try to locate the corresponding material interface
-
-							// Start by looking in our assignment map
-							FoundMaterialInterface = OutputAssignmentMaterials.Find(MaterialName);
-							if (FoundMaterialInterface)
-								MaterialInterface = *FoundMaterialInterface;
+							// Only try to load a material if has a chance to be valid!
+							MaterialInterface = Cast< UMaterialInterface >(
+								StaticLoadObject(UMaterialInterface::StaticClass(),
+									nullptr, *MaterialName, nullptr, LOAD_NoWarn, nullptr));
 
-							if (!MaterialInterface && !MaterialName.IsEmpty() && !InvalidMaterials.Contains(MaterialName))
-							{
-								// Only try to load a material if has a chance to be valid!
-								MaterialInterface = Cast< UMaterialInterface >(
-									StaticLoadObject(UMaterialInterface::StaticClass(),
-										nullptr, *MaterialName, nullptr, LOAD_NoWarn, nullptr));
-
-								if (!MaterialInterface)
-									InvalidMaterials.Add(MaterialName);
-							}
-
-							if (MaterialInterface)
-							{
-								// We managed to load the UE4 material
-								// Make sure this material is in the assignments before replacing it.
-								OutputAssignmentMaterials.Add(MaterialName, MaterialInterface);
-								
-								// See if we have a replacement material and use it on the mesh instead
-								UMaterialInterface * const *ReplacementMaterialInterface = ReplacementMaterials.Find(MaterialName);
-								if (ReplacementMaterialInterface && *ReplacementMaterialInterface)
-									MaterialInterface = *ReplacementMaterialInterface;
-
-								// Add this material to the map
-								MapHoudiniMatAttributesToUnrealInterface.Add(MaterialName, MaterialInterface);
-							}
+							if (!MaterialInterface)
+								InvalidMaterials.Add(MaterialName);
 						}
 
-						if (!MaterialInterface)
+						if (MaterialInterface)
 						{
-							// The attribute Material or its replacement do not exist
-							// See if we can fallback to the Houdini material assigned on the face
-
-							// Get the unreal material corresponding to this houdini one
-							HAPI_NodeId MaterialId = PartFaceMaterialIds[SplitFaceIndex];
-
-							// See if we have already treated that material
-							FoundMaterialInterface = MapHoudiniMatIdToUnrealInterface.Find(MaterialId);
-							if (FoundMaterialInterface)
-								MaterialInterface = *FoundMaterialInterface;
+							// We managed to load the UE4 material
+							// Make sure this material is in the assignments before replacing it.
+							OutputAssignmentMaterials.Add(MaterialName, MaterialInterface);
+							
+							// See if we have a replacement material and use it on the mesh instead
+							UMaterialInterface * const *ReplacementMaterialInterface = ReplacementMaterials.Find(MaterialName);
+							if (ReplacementMaterialInterface && *ReplacementMaterialInterface)
+								MaterialInterface = *ReplacementMaterialInterface;
 
-							if (!MaterialInterface)
-							{
-								// If everything else fails, we'll use the default material
-								MaterialInterface = Cast<UMaterialInterface>(FHoudiniEngine::Get().GetHoudiniDefaultMaterial(HGPO.bIsTemplated).Get());
-
-								// We need to add this material to the map
-								FString MaterialPathName = HAPI_UNREAL_DEFAULT_MATERIAL_NAME;
-								FHoudiniMaterialTranslator::GetMaterialRelativePath(HGPO.AssetId, MaterialId, MaterialPathName);
-								UMaterialInterface * const * FoundMaterial = OutputAssignmentMaterials.Find(MaterialPathName);
-								if (FoundMaterial)
-									MaterialInterface = *FoundMaterial;
-
-								// See if we have a replacement material and use it on the mesh instead
-								UMaterialInterface * const *ReplacementMaterialInterface = ReplacementMaterials.Find(MaterialPathName);
-								if (ReplacementMaterialInterface && *ReplacementMaterialInterface)
-									MaterialInterface = *ReplacementMaterialInterface;
-
-								// Map the Houdini ID to the unreal one
-								MapHoudiniMatIdToUnrealInterface.Add(MaterialId, MaterialInterface);
-							}
+							// Add this material to the map
+							MapHoudiniMatAttributesToUnrealInterface.Add(MaterialName, MaterialInterface);
 						}
 					}
 
-					int32 const * FoundFaceMaterialIdx = MapUnrealMaterialInterfaceToUnrealMaterialIndexThisMesh.Find(MaterialInterface);
-					if (FoundFaceMaterialIdx)
-					{
-						// We already know what material index to use for that override
-						CurrentFaceMaterialIdx = *FoundFaceMaterialIdx;
-					}
-					else
+					if (!MaterialInterface)
 					{
-						// Add the material to the Static mesh
-						CurrentFaceMaterialIdx = FoundStaticMaterials.Add(FStaticMaterial(MaterialInterface));
-						MapUnrealMaterialInterfaceToUnrealMaterialIndexThisMesh.Add(MaterialInterface, CurrentFaceMaterialIdx);
-					}
-
-					// Update the Face Material on the mesh
-					SplitFaceMaterialIndices[FaceIdx] = CurrentFaceMaterialIdx;
-				}
-			}
-
-			// Create a Polygon Group for each material slot
-			TPolygonGroupAttributesRef<FName> PolygonGroupImportedMaterialSlotNames =
-				MeshDescription->PolygonGroupAttributes().GetAttributesRef<FName>(MeshAttribute::PolygonGroup::ImportedMaterialSlotName);
-
-			// We must use the number of assignment materials found to reserve the number of material slots
-			// Don't use the SM's StaticMaterials here as we may not reserve enough polygon groups when adding more materials
-			int32 NumberOfMaterials = OutputAssignmentMaterials.Num();
-			if (NumberOfMaterials <= 0)
-			{
-				// No materials, create a polygon group for the default one
-				const FPolygonGroupID& PolygonGroupID = MeshDescription->CreatePolygonGroup();
-				PolygonGroupImportedMaterialSlotNames[PolygonGroupID] = FName(HAPI_UNREAL_DEFAULT_MATERIAL_NAME);
-			}
-			else
-			{
-				MeshDescription->ReserveNewPolygonGroups(NumberOfMaterials);
-				//for (int32 MatIndex = 0; MatIndex < NumberOfMaterials; ++MatIndex)
-				for (auto& CurrentMatAssignement : OutputAssignmentMaterials)
-				{
-					const FPolygonGroupID& PolygonGroupID = MeshDescription->CreatePolygonGroup();
-					PolygonGroupImportedMaterialSlotNames[PolygonGroupID] =
-						FName(CurrentMatAssignement.Value ? *(CurrentMatAssignement.Value->GetName()) : *(CurrentMatAssignement.Key));
-				}
-			}
-
-			if (bDoTiming)
-			{
-				HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Materials in %f seconds."), FPlatformTime::Seconds() - tick);
-				tick = FPlatformTime::Seconds();
-			}
-
-			//
-			// VERTEX INSTANCE ATTRIBUTES
-			// NORMALS, TANGENTS, COLORS, UVS, Alpha
-			//
-
-			// Extract the normals
-			UpdatePartNormalsIfNeeded();
-			// Get the normals for this split
-			TArray<float> SplitNormals;
-			FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-				SplitVertexList, AttribInfoNormals, PartNormals, SplitNormals);
-
-			TVertexInstanceAttributesRef<FVector> VertexInstanceNormals = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector>(MeshAttribute::VertexInstance::Normal);
-
-			// No need to read the tangents if we want unreal to recompute them after
-			const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
-			bool bReadTangents = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->RecomputeTangentsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always : true;
-
-			// Extract the tangents
-			TArray<float> SplitTangentU;
-			TArray<float> SplitTangentV;
-			if (bReadTangents)
-			{
-				// Extract this part's Tangents if needed
-				UpdatePartTangentsIfNeeded();
-
-				// Get the Tangents for this split
-				FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-					SplitVertexList, AttribInfoTangentU, PartTangentU, SplitTangentU);
-
-				// Get the binormals for this split
-				FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-					SplitVertexList, AttribInfoTangentV, PartTangentV, SplitTangentV);
+						// The attribute Material or its replacement do not exist
+						// See if we can fallback to the Houdini material assigned on the face
 
-				// We need to manually generate tangents if:
-				// - we have normals but dont have tangentu or tangentv attributes
-				// - we have not specified that we wanted unreal to generate them
-				int32 NormalCount = SplitNormals.Num();
-				bool bGenerateTangents = (NormalCount > 0) && (SplitTangentU.Num() <= 0 || SplitTangentV.Num() <= 0);
-				// Check that the number of tangents read matches the number of normals
-				if (SplitTangentU.Num() != NormalCount || SplitTangentV.Num() != NormalCount)
-					bGenerateTangents = true;
+						// Get the unreal material corresponding to this houdini one
+						HAPI_NodeId MaterialId = PartFaceMaterialIds[SplitFaceIndex];
 
-				if (bGenerateTangents && (HoudiniRuntimeSettings->RecomputeTangentsFlag == EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always))
-				{
-					// No need to generate tangents if we want unreal to recompute them after
-					bGenerateTangents = false;
-				}
+						// See if we have already treated that material
+						FoundMaterialInterface = MapHoudiniMatIdToUnrealInterface.Find(MaterialId);
+						if (FoundMaterialInterface)
+							MaterialInterface = *FoundMaterialInterface;
 
-				// Generate the tangents if needed
-				if (bGenerateTangents)
-				{
-					SplitTangentU.SetNumZeroed(NormalCount);
-					SplitTangentV.SetNumZeroed(NormalCount);
-					for (int32 Idx = 0; Idx + 2 < NormalCount; Idx += 3)
-					{
-						FVector TangentZ;
-						TangentZ.X = SplitNormals[Idx + 0];
-						TangentZ.Y = SplitNormals[Idx + 2];
-						TangentZ.Z = SplitNormals[Idx + 1];
+						if (!MaterialInterface)
+						{
+							// If everything else fails, we'll use the default material
+							MaterialInterface = Cast<UMaterialInterface>(FHoudiniEngine::Get().GetHoudiniDefaultMaterial(HGPO.bIsTemplated).Get());
 
-						FVector TangentX, TangentY;
-						TangentZ.FindBestAxisVectors(TangentX, TangentY);
+							// We need to add this material to the map
+							FString MaterialPathName = HAPI_UNREAL_DEFAULT_MATERIAL_NAME;
+							FHoudiniMaterialTranslator::GetMaterialRelativePath(HGPO.AssetId, MaterialId, MaterialPathName);
+							UMaterialInterface * const * FoundMaterial = OutputAssignmentMaterials.Find(MaterialPathName);
+							if (FoundMaterial)
+								MaterialInterface = *FoundMaterial;
 
-						SplitTangentU[Idx + 0] = TangentX.X;
-						SplitTangentU[Idx + 2] = TangentX.Y;
-						SplitTangentU[Idx + 1] = TangentX.Z;
+							// See if we have a replacement material and use it on the mesh instead
+							UMaterialInterface * const *ReplacementMaterialInterface = ReplacementMaterials.Find(MaterialPathName);
+							if (ReplacementMaterialInterface && *ReplacementMaterialInterface)
+								MaterialInterface = *ReplacementMaterialInterface;
 
-						SplitTangentV[Idx + 0] = TangentY.X;
-						SplitTangentV[Idx + 2] = TangentY.Y;
-						SplitTangentV[Idx + 1] = TangentY.Z;
+							// Map the Houdini ID to the unreal one
+							MapHoudiniMatIdToUnrealInterface.Add(MaterialId, MaterialInterface);
+						}
 					}
 				}
-			}
-			TVertexInstanceAttributesRef<FVector> VertexInstanceTangents = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector>(MeshAttribute::VertexInstance::Tangent);
-			TVertexInstanceAttributesRef<float> VertexInstanceBinormalSigns = MeshDescription->VertexInstanceAttributes().GetAttributesRef<float>(MeshAttribute::VertexInstance::BinormalSign);
-
-			// Extract the color values
-			UpdatePartColorsIfNeeded();
-			// Get the colors values for this split
-			TArray<float> SplitColors;
-			FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-				SplitVertexList, AttribInfoColors, PartColors, SplitColors);
-
-			// Extract the alpha values
-			UpdatePartAlphasIfNeeded();
-			// Get the colors values for this split
-			TArray<float> SplitAlphas;
-			FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-				SplitVertexList, AttribInfoAlpha, PartAlphas, SplitAlphas);
-			TVertexInstanceAttributesRef<FVector4> VertexInstanceColors = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector4>(MeshAttribute::VertexInstance::Color);
-
-			// Extract UVs
-			UpdatePartUVSetsIfNeeded(true);
-			// See if we need to transfer uv point attributes to vertex attributes.
-			int32 UVSetCount = PartUVSets.Num();
-			TArray<TArray<float>> SplitUVSets;
-			SplitUVSets.SetNum(UVSetCount);
-			for (int32 TexCoordIdx = 0; TexCoordIdx < UVSetCount; TexCoordIdx++)
-			{
-				FHoudiniMeshTranslator::TransferPartAttributesToSplit<float>(
-					SplitVertexList, AttribInfoUVSets[TexCoordIdx], PartUVSets[TexCoordIdx], SplitUVSets[TexCoordIdx]);
-			}
-			TVertexInstanceAttributesRef<FVector2D> VertexInstanceUVs = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector2D>(MeshAttribute::VertexInstance::TextureCoordinate);					
-			VertexInstanceUVs.SetNumIndices(UVSetCount);
-
-			if (bDoTiming)
-			{
-				HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - VertexAttr extracted in %f seconds."), FPlatformTime::Seconds() - tick);
-				tick = FPlatformTime::Seconds();
-			}
-
-			// Allocate space for the vertex instances and polygons
-			MeshDescription->ReserveNewVertexInstances(SplitIndices.Num());
-			MeshDescription->ReserveNewPolygons(SplitIndices.Num() / 3);
-			//Approximately 2.5 edges per polygons
-			MeshDescription->ReserveNewEdges(SplitIndices.Num() * 2.5f / 3);
-
-			bHasNormal = SplitNormals.Num() > 0;
-			bHasTangents = SplitTangentU.Num() > 0 && SplitTangentV.Num() > 0;
-			bool bHasRGB = SplitColors.Num() > 0;
-			bool bHasRGBA = bHasRGB && AttribInfoColors.tupleSize == 4;
-			bool bHasAlpha = SplitAlphas.Num() > 0;
-
-			TArray<bool> HasUVSets;
-			HasUVSets.SetNumZeroed(PartUVSets.Num());
-			for (int32 Idx = 0; Idx < PartUVSets.Num(); Idx++)
-				HasUVSets[Idx] = PartUVSets[Idx].Num() > 0;
-
-			uint32 FaceCount = SplitIndices.Num() / 3;
-			for (uint32 FaceIndex = 0; FaceIndex < FaceCount; FaceIndex++)
-			{
-				TArray<FVertexInstanceID> FaceVertexInstanceIDs;
-				FaceVertexInstanceIDs.SetNum(3);
 
-				// Ignore degenerate triangles
-				FVertexID VertexIDs[3];
-				for (int32 Corner = 0; Corner < 3; ++Corner)
+				int32 const * FoundFaceMaterialIdx = MapUnrealMaterialInterfaceToUnrealMaterialIndexThisMesh.Find(MaterialInterface);
+				if (FoundFaceMaterialIdx)
 				{
-					VertexIDs[Corner] = FVertexID(SplitIndices[(FaceIndex * 3) + Corner]);
+					// We already know what material index to use for that override
+					CurrentFaceMaterialIdx = *FoundFaceMaterialIdx;
 				}
-				if (VertexIDs[0] == VertexIDs[1] || VertexIDs[0] == VertexIDs[2] || VertexIDs[1] == VertexIDs[2])
-					continue;
-
-				//FVertexID FaceVertexIDs[3];
-				for (int32 Corner = 0; Corner < 3; Corner++)
+				else
 				{
-					uint32 SplitIndex = (FaceIndex * 3) + Corner;
-					uint32 SplitVertexIndex = SplitIndices[SplitIndex];
-					const FVertexInstanceID& VertexInstanceID = MeshDescription->CreateVertexInstance(FVertexID(SplitVertexIndex));
-
-					// Fix the winding order by updating the SplitIndex (invert corner 1 and 2)
-					// instead of going 0 1 2 go 0 2 1
-					// TODO; this slows down StaticMesh->Build() considerably!
-					Corner == 1 ? SplitIndex++ : Corner == 2 ? SplitIndex-- : SplitIndex;
-
-					const uint32 SplitVertexIndex_X = SplitIndex * 3 + 0;
-					const uint32 SplitVertexIndex_Y = SplitIndex * 3 + 2;
-					const uint32 SplitVertexIndex_Z = SplitIndex * 3 + 1;
-					// Normals
-					if (bHasNormal)
-					{
-						// We need to swap Z and Y coordinate here, and convert from m to cm. 
-						VertexInstanceNormals[VertexInstanceID].X = SplitNormals[SplitVertexIndex_X];
-						VertexInstanceNormals[VertexInstanceID].Y = SplitNormals[SplitVertexIndex_Y];
-						VertexInstanceNormals[VertexInstanceID].Z = SplitNormals[SplitVertexIndex_Z];
-					}
-
-					// Tangents and binormals
-					if (bHasTangents)
-					{
-						// We need to swap Z and Y coordinate here, and convert from m to cm.
-						VertexInstanceTangents[VertexInstanceID].X = SplitTangentU[SplitVertexIndex_X];
-						VertexInstanceTangents[VertexInstanceID].Y = SplitTangentU[SplitVertexIndex_Y];
-						VertexInstanceTangents[VertexInstanceID].Z = SplitTangentU[SplitVertexIndex_Z];
-
-						FVector TangentY;
-						TangentY.X = SplitTangentV[SplitVertexIndex_X];
-						TangentY.Y = SplitTangentV[SplitVertexIndex_Y];
-						TangentY.Z = SplitTangentV[SplitVertexIndex_Z];
-
-						VertexInstanceBinormalSigns[VertexInstanceID] = GetBasisDeterminantSign(
-							VertexInstanceTangents[VertexInstanceID].GetSafeNormal(),
-							TangentY.GetSafeNormal(),
-							VertexInstanceNormals[VertexInstanceID].GetSafeNormal());
-					}
-
-					// Color
-					FLinearColor Color = FLinearColor::White;
-					if (bHasRGB)
-					{
-						Color.R = FMath::Clamp(
-							SplitColors[SplitIndex * AttribInfoColors.tupleSize + 0], 0.0f, 1.0f);
-						Color.G = FMath::Clamp(
-							SplitColors[SplitIndex * AttribInfoColors.tupleSize + 1], 0.0f, 1.0f);
-						Color.B = FMath::Clamp(
-							SplitColors[SplitIndex * AttribInfoColors.tupleSize + 2], 0.0f, 1.0f);
-					}
-					// Alpha
-					if (bHasAlpha)
-					{
-						Color.A = FMath::Clamp(SplitAlphas[SplitIndex], 0.0f, 1.0f);
-					}
-					else if (bHasRGBA)
-					{
-						Color.A = FMath::Clamp(SplitColors[SplitIndex * AttribInfoColors.tupleSize + 3], 0.0f, 1.0f);
-					}
-					VertexInstanceColors[VertexInstanceID] = FVector4(Color);
-
-					// UVs
-					for (int32 UVIndex = 0; UVIndex < SplitUVSets.Num(); UVIndex++)
-					{
-						if (HasUVSets[UVIndex])
-						{
-							// We need to flip V coordinate when it's coming from HAPI.
-							FVector2D CurrentUV;
-							CurrentUV.X = SplitUVSets[UVIndex][SplitIndex * 2 + 0];
-							CurrentUV.Y = 1.0f - SplitUVSets[UVIndex][SplitIndex * 2 + 1];
-
-							VertexInstanceUVs.Set(VertexInstanceID, UVIndex, CurrentUV);
-						}
-					}
-
-					FaceVertexInstanceIDs[Corner] = VertexInstanceID;
+					// Add the material to the Static mesh
+					CurrentFaceMaterialIdx = FoundStaticMaterials.Add(FStaticMaterial(MaterialInterface));
+					MapUnrealMaterialInterfaceToUnrealMaterialIndexThisMesh.Add(MaterialInterface, CurrentFaceMaterialIdx);
 				}
 
-				const FPolygonGroupID PolygonGroupID(SplitFaceMaterialIndices[FaceIndex]);
-
-				// Insert a triangle into the mesh
-				MeshDescription->CreateTriangle(PolygonGroupID, FaceVertexInstanceIDs);
+				// Update the Face Material on the mesh
+				SplitFaceMaterialIndices[FaceIdx] = CurrentFaceMaterialIdx;
 			}
+		}
 
-			if (bDoTiming)
+		// Snapshot the polygon group names for this split, the build pass will create one group per material slot.
+		// We must use the number of assignment materials found to reserve the number of material slots
+		// Don't use the SM's StaticMaterials here as we may not reserve enough polygon groups when adding more materials
+		if (OutputAssignmentMaterials.Num() <= 0)
+		{
+			// No materials, create a polygon group for the default one
+			CurrentJob.PolygonGroupNames.Add(FName(HAPI_UNREAL_DEFAULT_MATERIAL_NAME));
+		}
+		else
+		{
+			CurrentJob.PolygonGroupNames.Reserve(OutputAssignmentMaterials.Num());
+			for (auto& CurrentMatAssignement : OutputAssignmentMaterials)
 			{
-				HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - VertexAttr filled in %f seconds."), FPlatformTime::Seconds() - tick);
-				tick = FPlatformTime::Seconds();
+				CurrentJob.PolygonGroupNames.Add(
+					FName(CurrentMatAssignement.Value ? *(CurrentMatAssignement.Value->GetName()) : *(CurrentMatAssignement.Key)));
 			}
+		}
+	}
 
-			//--------------------------------------------------------------------------------------------------------------------- 
-			//  FACE SMOOTHING
-			//---------------------------------------------------------------------------------------------------------------------
-
-			// Extract this part's FaceSmoothing values if needed
-			UpdatePartFaceSmoothingIfNeeded();
-
-			// Get the FaceSmoothing values for this split
-			TArray<int32> SplitFaceSmoothingMasks;
-			FHoudiniMeshTranslator::TransferPartAttributesToSplit<int32>(
-				SplitVertexList, AttribInfoFaceSmoothingMasks, PartFaceSmoothingMasks, SplitFaceSmoothingMasks);
-
-			// FaceSmoothing masks must be initialized even if we don't have a value from Houdini!
-			// TODO: Expose the default FaceSmoothing value
-			// 0 will make hard face
-			TArray<uint32> FaceSmoothingMasks;
-			FaceSmoothingMasks.Init(DefaultMeshSmoothing, SplitVertexCount / 3);
-
-			// Check that the number of face smoothing values we retrieved is correct
-			int32 WedgeFaceSmoothCount = SplitFaceSmoothingMasks.Num() / 3;
-			if (SplitFaceSmoothingMasks.Num() != 0 && !SplitFaceSmoothingMasks.IsValidIndex((WedgeFaceSmoothCount - 1) * 3 + 2))
-			{
-				// Ignore our face smoothing values
-				WedgeFaceSmoothCount = 0;
-				HOUDINI_LOG_WARNING(TEXT("Invalid face smoothing mask count detected - Skipping them."));
-			}
+	if (bDoTiming)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Splits prepared in %f seconds."), FPlatformTime::Seconds() - tick);
+		tick = FPlatformTime::Seconds();
+	}
 
-			// Transfer the face smoothing masks to the raw mesh if we have any
-			for (int32 WedgeFaceSmoothIdx = 0; WedgeFaceSmoothIdx < WedgeFaceSmoothCount; WedgeFaceSmoothIdx += 3)
-			{
-				FaceSmoothingMasks[WedgeFaceSmoothIdx] = SplitFaceSmoothingMasks[WedgeFaceSmoothIdx * 3];
-			}
+	// Build the splits' MeshDescriptions.
+	// Each job only reads the part's cached data and writes to its own MeshDescription.
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription - BuildSplits"));
 
-			// TODO
-			// Check
-			FStaticMeshOperations::ConvertSmoothGroupToHardEdges(FaceSmoothingMasks, *MeshDescription);
+		const bool bBuildInParallel = CVarHoudiniEngineParallelMeshBuild.GetValueOnAnyThread() != 0;
+		ParallelFor(SplitBuildJobs.Num(), [&](int32 JobIdx)
+		{
+			if (SplitBuildJobs[JobIdx].bRebuildMesh)
+				BuildSplitMeshDescription(SplitBuildJobs[JobIdx], bReadTangents);
+		}, bBuildInParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+	}
 
-			if (bDoTiming)
-			{
-				HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - FaceSoothing filled in %f seconds."), FPlatformTime::Seconds() - tick);
-				tick = FPlatformTime::Seconds();
-			}
+	if (bDoTiming)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Splits built in %f seconds."), FPlatformTime::Seconds() - tick);
+		tick = FPlatformTime::Seconds();
+	}
 
-			//--------------------------------------------------------------------------------------------------------------------- 
-			// LIGHTMAP RESOLUTION
-			//--------------------------------------------------------------------------------------------------------------------- 
-			// Extract this part's LightmapResolution values if needed
-			UpdatePartLightmapResolutionsIfNeeded();
+	// Commit the MeshDescriptions and update the static meshes
+	for (FHoudiniMeshSplitBuildJob& CurrentJob : SplitBuildJobs)
+	{
+		const FString& SplitGroupName = CurrentJob.SplitGroupName;
+		const FHoudiniOutputObjectIdentifier& OutputObjectIdentifier = CurrentJob.OutputObjectIdentifier;
+		UStaticMesh* FoundStaticMesh = CurrentJob.StaticMesh;
+		const int32 LODIndex = CurrentJob.LODIndex;
+		FMeshDescription* MeshDescription = CurrentJob.MeshDescription;
+		FStaticMeshSourceModel* SrcModel = &(FoundStaticMesh->GetSourceModel(LODIndex));
+		FHoudiniOutputObject* FoundOutputObject = OutputObjects.Find(OutputObjectIdentifier);
 
+		if (CurrentJob.bRebuildMesh)
+		{
 			// make sure the mesh has a new lighting guid
 			FoundStaticMesh->SetLightingGuid(FGuid::NewGuid());
 		}
@@ -3919,8 +3614,8 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		// Update the Build Settings using the default setting values
 		UpdateMeshBuildSettings(
 			SrcModel->BuildSettings,
-			bHasNormal,
-			bHasTangents,
+			CurrentJob.bHasNormal,
+			CurrentJob.bHasTangents,
 			PartUVSets.Num() > 0);
 
 		// Set the lightmap Coordinate Index
@@ -4062,26 +3757,24 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		}
 
 		// Notify that we created a new Static Mesh if needed
-		if(bNewStaticMeshCreated)
+		if(CurrentJob.bNewStaticMeshCreated)
 			FAssetRegistryModule::AssetCreated(FoundStaticMesh);
 
-		// Add the Static mesh to the output maps and the build map if we haven't already
+		// Update the output object and add the Static mesh to the build map if we haven't already
 		if (FoundOutputObject)
 		{
 			FoundOutputObject->OutputObject = FoundStaticMesh;
 			FoundOutputObject->bProxyIsCurrent = false;
 			FoundOutputObject->bIsImplicit = false;
-			OutputObjects.FindOrAdd(OutputObjectIdentifier, *FoundOutputObject);
 		}
 
 		StaticMeshToBuild.FindOrAdd(OutputObjectIdentifier, FoundStaticMesh);
+	}
 
-		if (bDoTiming)
-		{
-			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Finished Split in %f seconds."), FPlatformTime::Seconds() - tick);
-			tick = FPlatformTime::Seconds();
-			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Total Split time: %f seconds."), tick - split_tick);
-		}
+	if (bDoTiming)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Splits committed in %f seconds."), FPlatformTime::Seconds() - tick);
+		tick = FPlatformTime::Seconds();
 	}
 
 	// Look if we only have colliders
@@ -4252,6 +3945,455 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 	return true;
 }
 
+void
+FHoudiniMeshTranslator::BuildSplitMeshDescription(FHoudiniMeshSplitBuildJob& InOutJob, const bool& bInReadTangents) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::BuildSplitMeshDescription"));
+
+	bool bDoTiming = CVarHoudiniEngineMeshBuildTimer.GetValueOnAnyThread() != 0.0;
+	double tick = FPlatformTime::Seconds();
+
+	FMeshDescription* MeshDescription = InOutJob.MeshDescription;
+	if (!MeshDescription)
+		return;
+
+	const FString& SplitGroupName = InOutJob.SplitGroupName;
+	const int32& SplitId = InOutJob.SplitId;
+
+	// Get the vertex indices for this group
+	const TArray<int32>& SplitVertexList = AllSplitVertexLists.FindChecked(SplitGroupName);
+
+	// Get valid count of vertex indices for this split.
+	const int32& SplitVertexCount = AllSplitVertexCounts.FindChecked(SplitGroupName);
+
+	FStaticMeshAttributes(*MeshDescription).Register();
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	//  INDICES
+	//--------------------------------------------------------------------------------------------------------------------- 
+
+	//
+	// Because of the splits, we don't need to declare all the vertices in the Part, 
+	// but only the one that are currently used by the split's faces.
+	// The indicesMapper array is used to map those indices from Part Vertices to Split Vertices.
+	// We also keep track of the needed vertices index to declare them easily afterwards.
+	//
+
+	// SplitNeededVertices
+	// Array containing the (unique) part indices for the vertices that are needed for this split
+	// SplitNeededVertices[splitIndex] = PartIndex
+	TArray<int32> SplitNeededVertices;
+	//SplitNeededVertices.SetNumZeroed(SplitVertexCount);
+
+	// IndicesMapper:
+	// Maps index values for all vertices in the Part:
+	// - Vertices unused by the split will be set to -1
+	// - Used vertices will have their value set to the "NewIndex" so that IndicesMapper[ partIndex ] => splitIndex
+	TArray<int32> PartToSplitIndicesMapper;
+	PartToSplitIndicesMapper.Init(-1, SplitVertexList.Num());
+	//TMap<int32, int32> SplitToPartIndicesMapper;
+
+	// SplitIndices
+	// Array of SplitIndices used to describe this split's polygons
+	TArray<uint32> SplitIndices;
+	SplitIndices.SetNumZeroed(SplitVertexCount);
+
+	int32 CurrentSplitIndex = 0;
+	int32 ValidVertexId = 0;
+	bool bHasInvalidFaceIndices = false;
+	for (int32 VertexIdx = 0; VertexIdx < SplitVertexList.Num(); VertexIdx += 3)
+	{
+		int32 WedgeCheck = SplitVertexList[VertexIdx + 0];
+		if (WedgeCheck == -1)
+			continue;
+
+		int32 WedgeIndices[3] =
+		{
+			SplitVertexList[VertexIdx + 0],
+			SplitVertexList[VertexIdx + 1],
+			SplitVertexList[VertexIdx + 2]
+		};
+
+		// Ensure the indices are valid
+		if (!PartToSplitIndicesMapper.IsValidIndex(WedgeIndices[0])
+			|| !PartToSplitIndicesMapper.IsValidIndex(WedgeIndices[1])
+			|| !PartToSplitIndicesMapper.IsValidIndex(WedgeIndices[2]))
+		{
+			// Invalid face index.
+			bHasInvalidFaceIndices = true;
+			continue;
+		}
+
+		// Converting Old (Part) Indices to New (Split) Indices:
+		for (int32 i = 0; i < 3; i++)
+		{
+			if (PartToSplitIndicesMapper[WedgeIndices[i]] < 0)
+			{
+				// This part index has not yet been "converted" to a new split index
+				SplitNeededVertices.Add(WedgeIndices[i]);
+				PartToSplitIndicesMapper[WedgeIndices[i]] = CurrentSplitIndex;
+				//SplitToPartIndicesMapper.Add(CurrentSplitIndex, WedgeIndices[i]);
+				CurrentSplitIndex++;
+			}
+
+			// Replace the old part index with the new split index
+			WedgeIndices[i] = PartToSplitIndicesMapper[WedgeIndices[i]];
+		}
+
+		if (!SplitIndices.IsValidIndex(ValidVertexId + 2))
+			break;
+
+		// Flip wedge indices to fix the winding order.
+		SplitIndices[ValidVertexId + 0] = WedgeIndices[0];
+		SplitIndices[ValidVertexId + 1] = WedgeIndices[2];
+		SplitIndices[ValidVertexId + 2] = WedgeIndices[1];
+
+		ValidVertexId += 3;
+	}
+
+	if (bHasInvalidFaceIndices)
+	{
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] has some invalid face indices"),
+			HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
+	}
+	
+	if (bDoTiming)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Indices in %f seconds."), FPlatformTime::Seconds() - tick);
+		tick = FPlatformTime::Seconds();
+	}
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// POSITIONS
+	//--------------------------------------------------------------------------------------------------------------------- 			
+	
+	// Transfer vertex positions:
+	//
+	// Because of the split, we're only interested in the needed vertices.
+	// Instead of declaring all the Positions, we'll only declare the vertices
+	// needed by the current split.
+	//
+	TVertexAttributesRef<FVector> VertexPositions =
+		MeshDescription->VertexAttributes().GetAttributesRef<FVector>(MeshAttribute::Vertex::Position);
+
+	bool bHasInvalidPositionIndexData = false;
+	MeshDescription->ReserveNewVertices(SplitNeededVertices.Num());
+	for ( const int32& NeededVertexIndex : SplitNeededVertices)
+	{
+		// Create a new Vertex
+		FVertexID VertexID = MeshDescription->CreateVertex();
+		if (PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
+		{
+			// We need to swap Z and Y coordinate here, and convert from m to cm. 
+			VertexPositions[VertexID].X = PartPositions[NeededVertexIndex * 3 + 0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			VertexPositions[VertexID].Y = PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			VertexPositions[VertexID].Z = PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		}
+		else
+		{
+			// Error when retrieving positions.
+			bHasInvalidPositionIndexData = true;
+
+			continue;
+		}
+	}
+
+	if (bHasInvalidPositionIndexData)
+	{
+		HOUDINI_LOG_WARNING(
+			TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
+			TEXT("- skipping."),
+			HGPO.ObjectId, *HGPO.ObjectName, HGPO.GeoId, HGPO.PartId, *HGPO.PartName, SplitId, *SplitGroupName);
+	}
+	
+	if (bDoTiming)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Positions in %f seconds."), FPlatformTime::Seconds() - tick);
+		tick = FPlatformTime::Seconds();
+	}
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// MATERIALS
+	//---------------------------------------------------------------------------------------------------------------------
+
+	// Create a Polygon Group for each material slot
+	TPolygonGroupAttributesRef<FName> PolygonGroupImportedMaterialSlotNames =
+		MeshDescription->PolygonGroupAttributes().GetAttributesRef<FName>(MeshAttribute::PolygonGroup::ImportedMaterialSlotName);
+
+	MeshDescription->ReserveNewPolygonGroups(InOutJob.PolygonGroupNames.Num());
+	for (const FName& CurrentGroupName : InOutJob.PolygonGroupNames)
+	{
+		const FPolygonGroupID& PolygonGroupID = MeshDescription->CreatePolygonGroup();
+		PolygonGroupImportedMaterialSlotNames[PolygonGroupID] = CurrentGroupName;
+	}
+
+	if (bDoTiming)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - PolygonGroups in %f seconds."), FPlatformTime::Seconds() - tick);
+		tick = FPlatformTime::Seconds();
+	}
+
+	//
+	// VERTEX INSTANCE ATTRIBUTES
+	// NORMALS, TANGENTS, COLORS, UVS, Alpha
+	//
+
+	// Get the normals for this split
+	TArray<float> SplitNormals;
+	FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+		SplitVertexList, AttribInfoNormals, PartNormals, SplitNormals);
+
+	TVertexInstanceAttributesRef<FVector> VertexInstanceNormals = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector>(MeshAttribute::VertexInstance::Normal);
+
+	// Extract the tangents
+	TArray<float> SplitTangentU;
+	TArray<float> SplitTangentV;
+	if (bInReadTangents)
+	{
+		// Get the Tangents for this split
+		FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+			SplitVertexList, AttribInfoTangentU, PartTangentU, SplitTangentU);
+
+		// Get the binormals for this split
+		FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+			SplitVertexList, AttribInfoTangentV, PartTangentV, SplitTangentV);
+
+		// We need to manually generate tangents if:
+		// - we have normals but dont have tangentu or tangentv attributes
+		// - we have not specified that we wanted unreal to generate them
+		int32 NormalCount = SplitNormals.Num();
+		bool bGenerateTangents = (NormalCount > 0) && (SplitTangentU.Num() <= 0 || SplitTangentV.Num() <= 0);
+		// Check that the number of tangents read matches the number of normals
+		if (SplitTangentU.Num() != NormalCount || SplitTangentV.Num() != NormalCount)
+			bGenerateTangents = true;
+
+		// Generate the tangents if needed
+		if (bGenerateTangents)
+		{
+			SplitTangentU.SetNumZeroed(NormalCount);
+			SplitTangentV.SetNumZeroed(NormalCount);
+			for (int32 Idx = 0; Idx + 2 < NormalCount; Idx += 3)
+			{
+				FVector TangentZ;
+				TangentZ.X = SplitNormals[Idx + 0];
+				TangentZ.Y = SplitNormals[Idx + 2];
+				TangentZ.Z = SplitNormals[Idx + 1];
+
+				FVector TangentX, TangentY;
+				TangentZ.FindBestAxisVectors(TangentX, TangentY);
+
+				SplitTangentU[Idx + 0] = TangentX.X;
+				SplitTangentU[Idx + 2] = TangentX.Y;
+				SplitTangentU[Idx + 1] = TangentX.Z;
+
+				SplitTangentV[Idx + 0] = TangentY.X;
+				SplitTangentV[Idx + 2] = TangentY.Y;
+				SplitTangentV[Idx + 1] = TangentY.Z;
+			}
+		}
+	}
+	TVertexInstanceAttributesRef<FVector> VertexInstanceTangents = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector>(MeshAttribute::VertexInstance::Tangent);
+	TVertexInstanceAttributesRef<float> VertexInstanceBinormalSigns = MeshDescription->VertexInstanceAttributes().GetAttributesRef<float>(MeshAttribute::VertexInstance::BinormalSign);
+
+	// Get the colors values for this split
+	TArray<float> SplitColors;
+	FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+		SplitVertexList, AttribInfoColors, PartColors, SplitColors);
+
+	// Get the colors values for this split
+	TArray<float> SplitAlphas;
+	FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+		SplitVertexList, AttribInfoAlpha, PartAlphas, SplitAlphas);
+	TVertexInstanceAttributesRef<FVector4> VertexInstanceColors = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector4>(MeshAttribute::VertexInstance::Color);
+
+	// See if we need to transfer uv point attributes to vertex attributes.
+	int32 UVSetCount = PartUVSets.Num();
+	TArray<TArray<float>> SplitUVSets;
+	SplitUVSets.SetNum(UVSetCount);
+	for (int32 TexCoordIdx = 0; TexCoordIdx < UVSetCount; TexCoordIdx++)
+	{
+		FHoudiniMeshTranslator::TransferPartAttributesToSplit<float>(
+			SplitVertexList, AttribInfoUVSets[TexCoordIdx], PartUVSets[TexCoordIdx], SplitUVSets[TexCoordIdx]);
+	}
+	TVertexInstanceAttributesRef<FVector2D> VertexInstanceUVs = MeshDescription->VertexInstanceAttributes().GetAttributesRef<FVector2D>(MeshAttribute::VertexInstance::TextureCoordinate);					
+	VertexInstanceUVs.SetNumIndices(UVSetCount);
+
+	if (bDoTiming)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - VertexAttr extracted in %f seconds."), FPlatformTime::Seconds() - tick);
+		tick = FPlatformTime::Seconds();
+	}
+
+	// Allocate space for the vertex instances and polygons
+	MeshDescription->ReserveNewVertexInstances(SplitIndices.Num());
+	MeshDescription->ReserveNewPolygons(SplitIndices.Num() / 3);
+	//Approximately 2.5 edges per polygons
+	MeshDescription->ReserveNewEdges(SplitIndices.Num() * 2.5f / 3);
+
+	InOutJob.bHasNormal = SplitNormals.Num() > 0;
+	InOutJob.bHasTangents = SplitTangentU.Num() > 0 && SplitTangentV.Num() > 0;
+	const bool& bHasNormal = InOutJob.bHasNormal;
+	const bool& bHasTangents = InOutJob.bHasTangents;
+	bool bHasRGB = SplitColors.Num() > 0;
+	bool bHasRGBA = bHasRGB && AttribInfoColors.tupleSize == 4;
+	bool bHasAlpha = SplitAlphas.Num() > 0;
+
+	TArray<bool> HasUVSets;
+	HasUVSets.SetNumZeroed(PartUVSets.Num());
+	for (int32 Idx = 0; Idx < PartUVSets.Num(); Idx++)
+		HasUVSets[Idx] = PartUVSets[Idx].Num() > 0;
+
+	uint32 FaceCount = SplitIndices.Num() / 3;
+	for (uint32 FaceIndex = 0; FaceIndex < FaceCount; FaceIndex++)
+	{
+		TArray<FVertexInstanceID> FaceVertexInstanceIDs;
+		FaceVertexInstanceIDs.SetNum(3);
+
+		// Ignore degenerate triangles
+		FVertexID VertexIDs[3];
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			VertexIDs[Corner] = FVertexID(SplitIndices[(FaceIndex * 3) + Corner]);
+		}
+		if (VertexIDs[0] == VertexIDs[1] || VertexIDs[0] == VertexIDs[2] || VertexIDs[1] == VertexIDs[2])
+			continue;
+
+		//FVertexID FaceVertexIDs[3];
+		for (int32 Corner = 0; Corner < 3; Corner++)
+		{
+			uint32 SplitIndex = (FaceIndex * 3) + Corner;
+			uint32 SplitVertexIndex = SplitIndices[SplitIndex];
+			const FVertexInstanceID& VertexInstanceID = MeshDescription->CreateVertexInstance(FVertexID(SplitVertexIndex));
+
+			// Fix the winding order by updating the SplitIndex (invert corner 1 and 2)
+			// instead of going 0 1 2 go 0 2 1
+			// TODO; this slows down StaticMesh->Build() considerably!
+			Corner == 1 ? SplitIndex++ : Corner == 2 ? SplitIndex-- : SplitIndex;
+
+			const uint32 SplitVertexIndex_X = SplitIndex * 3 + 0;
+			const uint32 SplitVertexIndex_Y = SplitIndex * 3 + 2;
+			const uint32 SplitVertexIndex_Z = SplitIndex * 3 + 1;
+			// Normals
+			if (bHasNormal)
+			{
+				// We need to swap Z and Y coordinate here, and convert from m to cm. 
+				VertexInstanceNormals[VertexInstanceID].X = SplitNormals[SplitVertexIndex_X];
+				VertexInstanceNormals[VertexInstanceID].Y = SplitNormals[SplitVertexIndex_Y];
+				VertexInstanceNormals[VertexInstanceID].Z = SplitNormals[SplitVertexIndex_Z];
+			}
+
+			// Tangents and binormals
+			if (bHasTangents)
+			{
+				// We need to swap Z and Y coordinate here, and convert from m to cm.
+				VertexInstanceTangents[VertexInstanceID].X = SplitTangentU[SplitVertexIndex_X];
+				VertexInstanceTangents[VertexInstanceID].Y = SplitTangentU[SplitVertexIndex_Y];
+				VertexInstanceTangents[VertexInstanceID].Z = SplitTangentU[SplitVertexIndex_Z];
+
+				FVector TangentY;
+				TangentY.X = SplitTangentV[SplitVertexIndex_X];
+				TangentY.Y = SplitTangentV[SplitVertexIndex_Y];
+				TangentY.Z = SplitTangentV[SplitVertexIndex_Z];
+
+				VertexInstanceBinormalSigns[VertexInstanceID] = GetBasisDeterminantSign(
+					VertexInstanceTangents[VertexInstanceID].GetSafeNormal(),
+					TangentY.GetSafeNormal(),
+					VertexInstanceNormals[VertexInstanceID].GetSafeNormal());
+			}
+
+			// Color
+			FLinearColor Color = FLinearColor::White;
+			if (bHasRGB)
+			{
+				Color.R = FMath::Clamp(
+					SplitColors[SplitIndex * AttribInfoColors.tupleSize + 0], 0.0f, 1.0f);
+				Color.G = FMath::Clamp(
+					SplitColors[SplitIndex * AttribInfoColors.tupleSize + 1], 0.0f, 1.0f);
+				Color.B = FMath::Clamp(
+					SplitColors[SplitIndex * AttribInfoColors.tupleSize + 2], 0.0f, 1.0f);
+			}
+			// Alpha
+			if (bHasAlpha)
+			{
+				Color.A = FMath::Clamp(SplitAlphas[SplitIndex], 0.0f, 1.0f);
+			}
+			else if (bHasRGBA)
+			{
+				Color.A = FMath::Clamp(SplitColors[SplitIndex * AttribInfoColors.tupleSize + 3], 0.0f, 1.0f);
+			}
+			VertexInstanceColors[VertexInstanceID] = FVector4(Color);
+
+			// UVs
+			for (int32 UVIndex = 0; UVIndex < SplitUVSets.Num(); UVIndex++)
+			{
+				if (HasUVSets[UVIndex])
+				{
+					// We need to flip V coordinate when it's coming from HAPI.
+					FVector2D CurrentUV;
+					CurrentUV.X = SplitUVSets[UVIndex][SplitIndex * 2 + 0];
+					CurrentUV.Y = 1.0f - SplitUVSets[UVIndex][SplitIndex * 2 + 1];
+
+					VertexInstanceUVs.Set(VertexInstanceID, UVIndex, CurrentUV);
+				}
+			}
+
+			FaceVertexInstanceIDs[Corner] = VertexInstanceID;
+		}
+
+		const FPolygonGroupID PolygonGroupID(InOutJob.FaceMaterialIndices[FaceIndex]);
+
+		// Insert a triangle into the mesh
+		MeshDescription->CreateTriangle(PolygonGroupID, FaceVertexInstanceIDs);
+	}
+
+	if (bDoTiming)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - VertexAttr filled in %f seconds."), FPlatformTime::Seconds() - tick);
+		tick = FPlatformTime::Seconds();
+	}
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	//  FACE SMOOTHING
+	//---------------------------------------------------------------------------------------------------------------------
+
+	// Get the FaceSmoothing values for this split
+	TArray<int32> SplitFaceSmoothingMasks;
+	FHoudiniMeshTranslator::TransferPartAttributesToSplit<int32>(
+		SplitVertexList, AttribInfoFaceSmoothingMasks, PartFaceSmoothingMasks, SplitFaceSmoothingMasks);
+
+	// FaceSmoothing masks must be initialized even if we don't have a value from Houdini!
+	// TODO: Expose the default FaceSmoothing value
+	// 0 will make hard face
+	TArray<uint32> FaceSmoothingMasks;
+	FaceSmoothingMasks.Init(DefaultMeshSmoothing, SplitVertexCount / 3);
+
+	// Check that the number of face smoothing values we retrieved is correct
+	int32 WedgeFaceSmoothCount = SplitFaceSmoothingMasks.Num() / 3;
+	if (SplitFaceSmoothingMasks.Num() != 0 && !SplitFaceSmoothingMasks.IsValidIndex((WedgeFaceSmoothCount - 1) * 3 + 2))
+	{
+		// Ignore our face smoothing values
+		WedgeFaceSmoothCount = 0;
+		HOUDINI_LOG_WARNING(TEXT("Invalid face smoothing mask count detected - Skipping them."));
+	}
+
+	// Transfer the face smoothing masks to the raw mesh if we have any
+	for (int32 WedgeFaceSmoothIdx = 0; WedgeFaceSmoothIdx < WedgeFaceSmoothCount; WedgeFaceSmoothIdx += 3)
+	{
+		FaceSmoothingMasks[WedgeFaceSmoothIdx] = SplitFaceSmoothingMasks[WedgeFaceSmoothIdx * 3];
+	}
+
+	// TODO
+	// Check
+	FStaticMeshOperations::ConvertSmoothGroupToHardEdges(FaceSmoothingMasks, *MeshDescription);
+
+	if (bDoTiming)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - FaceSoothing filled in %f seconds."), FPlatformTime::Seconds() - tick);
+		tick = FPlatformTime::Seconds();
+	}
+}
+
 bool
 FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 {
@@ -4277,6 +4419,9 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 	// Resets the containers used for the raw data extraction.
 	ResetPartCache();
 
+	// Fetch the part's main attributes in one pass
+	PrefetchPartAttributes();
+
 	// Determine if there is "main" geo, if not we'll use the first LOD
 	// as main geo
 	bool bHasMainGeo = false;
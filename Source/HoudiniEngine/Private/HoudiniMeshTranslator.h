@@ -31,6 +31,7 @@
 #include "HoudiniOutput.h"
 #include "HoudiniPackageParams.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniAttributeRequestSet.h"
 
 #include "CoreMinimal.h"
 #include "UObject/ObjectMacros.h"
@@ -48,6 +49,7 @@ class UHoudiniStaticMeshComponent;
 
 struct FKAggregateGeom;
 struct FHoudiniGenericAttribute;
+struct FMeshDescription;
 
 
 UENUM()
@@ -69,6 +71,36 @@ enum class EHoudiniSplitType : uint8
 	InvisibleSimpleCollider
 };
 
+// Data needed to build the MeshDescription of a split,
+// prepared on the game thread and filled by BuildSplitMeshDescription()
+struct FHoudiniMeshSplitBuildJob
+{
+	// Split this job is building
+	FString SplitGroupName;
+	int32 SplitId = -1;
+	EHoudiniSplitType SplitType = EHoudiniSplitType::Invalid;
+	FHoudiniOutputObjectIdentifier OutputObjectIdentifier;
+
+	// Static mesh and LOD the MeshDescription belongs to
+	UStaticMesh* StaticMesh = nullptr;
+	int32 LODIndex = 0;
+	bool bNewStaticMeshCreated = false;
+
+	// Indicates that the MeshDescription has to be rebuilt,
+	// if false, the existing MeshDescription is reused as is
+	bool bRebuildMesh = false;
+	FMeshDescription* MeshDescription = nullptr;
+
+	// Material index for each of the split's faces
+	TArray<int32> FaceMaterialIndices;
+	// Names of the polygon groups to create in the MeshDescription
+	TArray<FName> PolygonGroupNames;
+
+	// Filled by the build
+	bool bHasNormal = false;
+	bool bHasTangents = false;
+};
+
 struct HOUDINIENGINE_API FHoudiniMeshTranslator
 {
 	public:
@@ -173,6 +205,10 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		// Create a StaticMesh using the MeshDescription format
 		bool CreateStaticMesh_MeshDescription();
 
+		// Fills a split's MeshDescription using the part's cached data.
+		// Does not call HAPI or touch any UObject, so can be run on a worker thread.
+		void BuildSplitMeshDescription(FHoudiniMeshSplitBuildJob& InOutJob, const bool& bInReadTangents) const;
+
 		// Legacy function using RawMesh for static Mesh creation
 		bool CreateStaticMesh_RawMesh();
 
@@ -188,6 +224,9 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 
 		void ResetPartCache();
 
+		// Fetches the part's main vertex attributes (positions, normals, colors, uvs...) in one pass
+		void PrefetchPartAttributes();
+
 		bool UpdatePartVertexList();
 
 		void SortSplitGroups();
@@ -353,6 +392,9 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 		// Vertex Indices for the part
 		TArray<int32> PartVertexList;
 
+		// Batched attribute fetch for this part, used by the UpdatePartXXXIfNeeded functions
+		FHoudiniAttributeRequestSet PartAttributeRequests;
+
 		// Positions
 		TArray<float> PartPositions;
 		HAPI_AttributeInfo AttribInfoPositions;
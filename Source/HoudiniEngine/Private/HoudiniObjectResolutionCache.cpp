@@ -0,0 +1,243 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniObjectResolutionCache.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "AssetRegistryModule.h"
+#include "Engine/StreamableManager.h"
+#include "Misc/PackageName.h"
+#include "Modules/ModuleManager.h"
+
+TMap<FString, TWeakObjectPtr<UObject>> FHoudiniObjectResolutionCache::ResolvedObjects;
+TSet<FString> FHoudiniObjectResolutionCache::FailedObjectPaths;
+TUniquePtr<FStreamableManager> FHoudiniObjectResolutionCache::StreamableManager;
+bool FHoudiniObjectResolutionCache::bAssetRegistryDelegatesRegistered = false;
+FDelegateHandle FHoudiniObjectResolutionCache::OnAssetAddedHandle;
+FDelegateHandle FHoudiniObjectResolutionCache::OnAssetRemovedHandle;
+FDelegateHandle FHoudiniObjectResolutionCache::OnAssetRenamedHandle;
+
+UObject*
+FHoudiniObjectResolutionCache::ResolveObject(const FString& InObjectPath)
+{
+	TMap<FString, UObject*> Objects;
+	ResolveObjects({ InObjectPath }, Objects);
+
+	UObject** FoundObject = Objects.Find(InObjectPath);
+	return FoundObject ? *FoundObject : nullptr;
+}
+
+void
+FHoudiniObjectResolutionCache::ResolveObjects(const TArray<FString>& InObjectPaths, TMap<FString, UObject*>& OutObjects)
+{
+	check(IsInGameThread());
+
+	RegisterAssetRegistryDelegates();
+
+	// Look for the paths in the cache and in memory first,
+	// and gather the ones we need to load
+	TArray<FString> PathsToLoad;
+	TArray<FSoftObjectPath> SoftPathsToLoad;
+	for (const FString& ObjectPath : InObjectPaths)
+	{
+		if (OutObjects.Contains(ObjectPath))
+			continue;
+
+		if (ObjectPath.IsEmpty())
+		{
+			OutObjects.Add(ObjectPath, nullptr);
+			continue;
+		}
+
+		UObject* Object = nullptr;
+		if (!FindCachedObject(ObjectPath, Object))
+		{
+			Object = FindObjectInMemory(ObjectPath);
+			if (!Object)
+			{
+				FSoftObjectPath SoftPath(FPackageName::ExportTextPathToObjectPath(ObjectPath));
+				if (SoftPath.IsValid())
+					SoftPathsToLoad.Add(SoftPath);
+
+				PathsToLoad.Add(ObjectPath);
+			}
+			else
+			{
+				ResolvedObjects.Add(ObjectPath, Object);
+			}
+		}
+
+		OutObjects.Add(ObjectPath, Object);
+	}
+
+	if (PathsToLoad.Num() <= 0)
+		return;
+
+	// Load all the missing objects in one batch, so their packages are loaded concurrently
+	if (SoftPathsToLoad.Num() > 0)
+	{
+		if (!StreamableManager.IsValid())
+			StreamableManager = MakeUnique<FStreamableManager>();
+
+		StreamableManager->RequestSyncLoad(SoftPathsToLoad);
+	}
+
+	for (const FString& ObjectPath : PathsToLoad)
+	{
+		// Fallback to a regular load for the paths that didn't resolve after the batch (ie, package paths)
+		UObject* Object = FindObjectInMemory(ObjectPath);
+		if (!Object)
+			Object = StaticLoadObject(UObject::StaticClass(), nullptr, *ObjectPath, nullptr, LOAD_NoWarn, nullptr);
+
+		if (IsValid(Object))
+			ResolvedObjects.Add(ObjectPath, Object);
+		else
+			FailedObjectPaths.Add(ObjectPath);
+
+		OutObjects.Add(ObjectPath, IsValid(Object) ? Object : nullptr);
+	}
+}
+
+void
+FHoudiniObjectResolutionCache::Clear()
+{
+	ResolvedObjects.Empty();
+	FailedObjectPaths.Empty();
+}
+
+void
+FHoudiniObjectResolutionCache::Shutdown()
+{
+	if (bAssetRegistryDelegatesRegistered)
+	{
+		FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry"));
+		if (AssetRegistryModule)
+		{
+			IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+			AssetRegistry.OnAssetAdded().Remove(OnAssetAddedHandle);
+			AssetRegistry.OnAssetRemoved().Remove(OnAssetRemovedHandle);
+			AssetRegistry.OnAssetRenamed().Remove(OnAssetRenamedHandle);
+		}
+
+		bAssetRegistryDelegatesRegistered = false;
+	}
+
+	Clear();
+	StreamableManager.Reset();
+}
+
+bool
+FHoudiniObjectResolutionCache::FindCachedObject(const FString& InObjectPath, UObject*& OutObject)
+{
+	OutObject = nullptr;
+	if (FailedObjectPaths.Contains(InObjectPath))
+		return true;
+
+	TWeakObjectPtr<UObject>* FoundObject = ResolvedObjects.Find(InObjectPath);
+	if (!FoundObject)
+		return false;
+
+	if (!FoundObject->IsValid())
+	{
+		// The object has been garbage collected, resolve it again
+		ResolvedObjects.Remove(InObjectPath);
+		return false;
+	}
+
+	OutObject = FoundObject->Get();
+	return true;
+}
+
+UObject*
+FHoudiniObjectResolutionCache::FindObjectInMemory(const FString& InObjectPath)
+{
+	const FString ObjectPath = FPackageName::ExportTextPathToObjectPath(InObjectPath);
+	UObject* Object = StaticFindObjectSafe(UObject::StaticClass(), nullptr, *ObjectPath);
+	if (IsValid(Object))
+		return Object;
+
+	// See if the ref is a class that we can instantiate
+	UClass* FoundClass = FindObject<UClass>(ANY_PACKAGE, *InObjectPath);
+	if (IsValid(FoundClass))
+		return FoundClass;
+
+	return nullptr;
+}
+
+void
+FHoudiniObjectResolutionCache::RegisterAssetRegistryDelegates()
+{
+	if (bAssetRegistryDelegatesRegistered)
+		return;
+
+	FAssetRegistryModule* AssetRegistryModule = FModuleManager::LoadModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry"));
+	if (!AssetRegistryModule)
+		return;
+
+	IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+	OnAssetAddedHandle = AssetRegistry.OnAssetAdded().AddStatic(&FHoudiniObjectResolutionCache::OnAssetAdded);
+	OnAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddStatic(&FHoudiniObjectResolutionCache::OnAssetRemoved);
+	OnAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddStatic(&FHoudiniObjectResolutionCache::OnAssetRenamed);
+
+	bAssetRegistryDelegatesRegistered = true;
+}
+
+void
+FHoudiniObjectResolutionCache::OnAssetAdded(const FAssetData& InAssetData)
+{
+	// A new asset might resolve one of the paths that previously failed
+	FailedObjectPaths.Empty();
+}
+
+void
+FHoudiniObjectResolutionCache::OnAssetRemoved(const FAssetData& InAssetData)
+{
+	InvalidatePackage(InAssetData.PackageName.ToString());
+}
+
+void
+FHoudiniObjectResolutionCache::OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath)
+{
+	InvalidatePackage(FPackageName::ObjectPathToPackageName(InOldObjectPath));
+	
+	// The new path might resolve one of the paths that previously failed
+	FailedObjectPaths.Empty();
+}
+
+void
+FHoudiniObjectResolutionCache::InvalidatePackage(const FString& InPackageName)
+{
+	if (InPackageName.IsEmpty())
+		return;
+
+	for (auto Iter = ResolvedObjects.CreateIterator(); Iter; ++Iter)
+	{
+		if (FPackageName::ObjectPathToPackageName(FPackageName::ExportTextPathToObjectPath(Iter.Key())) == InPackageName)
+			Iter.RemoveCurrent();
+	}
+}
@@ -0,0 +1,87 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+struct FAssetData;
+struct FStreamableManager;
+
+// Persistent cache of the objects referenced by path in attributes (instanced objects, materials...), shared by all HACs.
+// Paths that failed to resolve are cached as well, so they aren't loaded again on every cook.
+// Entries are invalidated when the asset registry adds, removes or renames an asset.
+// Must only be used on the game thread.
+struct HOUDINIENGINE_API FHoudiniObjectResolutionCache
+{
+	public:
+
+		// Resolves a single object path, returns null if the object couldn't be found or loaded.
+		static UObject* ResolveObject(const FString& InObjectPath);
+
+		// Resolves a list of object paths. The objects that aren't cached or in memory yet are loaded in one batch.
+		// OutObjects contains an entry (possibly null) for each unique path.
+		static void ResolveObjects(const TArray<FString>& InObjectPaths, TMap<FString, UObject*>& OutObjects);
+
+		// Discards all the cached entries
+		static void Clear();
+
+		// Unregisters the asset registry delegates and releases the cache (on module shutdown).
+		static void Shutdown();
+
+	protected:
+
+		// Returns true if the path is cached, OutObject is null for failed paths.
+		static bool FindCachedObject(const FString& InObjectPath, UObject*& OutObject);
+
+		// Attempts to find the object in memory, or as a class
+		static UObject* FindObjectInMemory(const FString& InObjectPath);
+
+		static void RegisterAssetRegistryDelegates();
+
+		static void OnAssetAdded(const FAssetData& InAssetData);
+		static void OnAssetRemoved(const FAssetData& InAssetData);
+		static void OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath);
+
+		// Discards the cached entries referencing the given package
+		static void InvalidatePackage(const FString& InPackageName);
+
+	protected:
+
+		static TMap<FString, TWeakObjectPtr<UObject>> ResolvedObjects;
+
+		static TSet<FString> FailedObjectPaths;
+
+		static TUniquePtr<FStreamableManager> StreamableManager;
+
+		static bool bAssetRegistryDelegatesRegistered;
+		static FDelegateHandle OnAssetAddedHandle;
+		static FDelegateHandle OnAssetRemovedHandle;
+		static FDelegateHandle OnAssetRenamedHandle;
+};
@@ -32,6 +32,7 @@
 
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniAttributeInfoCache.h"
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniAsset.h"
@@ -58,9 +59,20 @@
 #include "WorldBrowserModule.h"
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "InstancedFoliageActor.h"
+#include "Async/Async.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineOutputFetchWorkers(
+	TEXT("HoudiniEngine.OutputFetchWorkers"),
+	4,
+	TEXT("Maximum number of parts whose data is fetched from HAPI concurrently on worker threads when building outputs.\n")
+	TEXT("Only the fetch is overlapped with the game thread's matching of the previous parts to their outputs,\n")
+	TEXT("the meshes, instancers, etc. are still translated afterwards on the game thread.\n")
+	TEXT("0: Fetch the parts serially on the game thread.\n")
+);
+
 // 
 bool
 FHoudiniOutputTranslator::UpdateOutputs(
@@ -1233,6 +1245,9 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 			if (!CurrentCookCounts.Contains(CurrentHapiGeoInfo.nodeId))
 			{
 				CurrentCookCounts.Add(CurrentHapiGeoInfo.nodeId, FHoudiniEngineUtils::HapiGetCookCount(CurrentHapiGeoInfo.nodeId));
+
+				// Let the attribute info cache know about the current cook of this node
+				FHoudiniAttributeInfoCache::ValidateCookCount(AssetId, CurrentHapiGeoInfo.nodeId, CurrentCookCounts[CurrentHapiGeoInfo.nodeId]);
 			}
 			
 			if (OutputNodeCookCounts.Contains(CurrentHapiGeoInfo.nodeId))
@@ -1284,399 +1299,157 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 			// Store all the sockets found for this geo's part
 			TArray<FHoudiniMeshSocket> GeoMeshSockets;
 
-			// Iterate on this geo's parts
-			for (int32 PartId = 0; PartId < CurrentGeoInfo.PartCount; ++PartId)
-			{
-				// Get part information.
-				HAPI_PartInfo CurrentHapiPartInfo;
-				FHoudiniApi::PartInfo_Init(&CurrentHapiPartInfo);
+			// When pipelining, the parts' data is fetched from HAPI on worker threads, while the game thread
+			// matches the previous parts to their outputs. Only the fetch overlaps: the outputs themselves
+			// (meshes, instancers...) are translated later, on the game thread, from the HGPOs built here.
+			const int32 MaxFetchWorkers = CVarHoudiniEngineOutputFetchWorkers.GetValueOnAnyThread();
+			const bool bPipelineParts = MaxFetchWorkers > 0 && CurrentGeoInfo.PartCount > 1;
+			TArray<TFuture<FHoudiniOutputPartData>> PendingParts;
+			int32 NumDispatchedParts = 0;
 
-				// If the geo is templated, cook it manually
-				if (CurrentHapiGeoInfo.isTemplated && InOutputTemplatedGeos)
-				{
-					//HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-					//FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, &CookOptions);
-					FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
-				}
+			// The workers need to query the same pooled session as we do
+			const int32 SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
 
-				bool bPartInfoFailed = false;
-				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
-					FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, PartId, &CurrentHapiPartInfo))
+			// Starts fetching the next part's data on a worker thread
+			auto DispatchNextPart = [&]()
+			{
+				const int32 PartIdx = NumDispatchedParts++;
+				PendingParts[PartIdx] = Async(EAsyncExecution::ThreadPool,
+					[AssetId, CurrentAssetName, CurrentHapiObjectInfo, CurrentObjectInfo, TransformMatrix, CurrentHapiGeoInfo, CurrentGeoInfo, PartIdx, SessionIndex, GeoGroupNames]()
 				{
-					bPartInfoFailed = true;
+					FHoudiniScopedSession ScopedSession(SessionIndex);
+					FHoudiniOutputPartData PartData;
 
-					// If the geo is templated, attempt to cook it manually
-					if(CurrentHapiGeoInfo.isTemplated && InOutputTemplatedGeos)
+					HAPI_PartInfo HapiPartInfo;
+					FHoudiniApi::PartInfo_Init(&HapiPartInfo);
+					if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
+						FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, PartIdx, &HapiPartInfo))
 					{
-						//HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-						//FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, nullptr);
-						FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
-
-						HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
-							FHoudiniEngine::Get().GetSession(),
-							CurrentHapiGeoInfo.nodeId,
-							&GeoInfos[GeoIdx]));
-
-						if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetPartInfo(
-							FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, PartId, &CurrentHapiPartInfo))
-						{
-							// We managed to get the templated part infos after cooking
-							bPartInfoFailed = false;
-						}
+						PartData.bPartInfoFailed = true;
+						return PartData;
 					}
-				}
 
-				if (bPartInfoFailed)
-				{
-					// Error retrieving part info.
-					HOUDINI_LOG_MESSAGE(
-						TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d] unable to retrieve PartInfo - skipping."),
-						CurrentHapiObjectInfo.nodeId, *CurrentObjectName, CurrentHapiGeoInfo.nodeId, PartId);
-					continue;
-				}
+					// The geo's group names have been fetched before dispatching the parts
+					TArray<FString> PartGeoGroupNames = GeoGroupNames;
+					FHoudiniOutputTranslator::FetchPartOutputData(
+						AssetId, CurrentAssetName, CurrentHapiObjectInfo, CurrentObjectInfo, TransformMatrix,
+						CurrentHapiGeoInfo, CurrentGeoInfo, HapiPartInfo, &PartGeoGroupNames, true, PartData);
 
-				// Convert/cache the part info
-				FHoudiniPartInfo CurrentPartInfo;
-				CachePartInfo(CurrentHapiPartInfo, CurrentPartInfo);
+					return PartData;
+				});
+			};
 
-				// Retrieve part name.
-				FString CurrentPartName = CurrentPartInfo.Name;
+			if (bPipelineParts)
+			{
+				// If the geo is templated, cook it once before fetching its parts
+				if (CurrentHapiGeoInfo.isTemplated && InOutputTemplatedGeos)
+					FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
 
-				// Unsupported/Invalid part
-				if (CurrentPartInfo.Type == EHoudiniPartType::Invalid)
-					continue;
+				// Fetch the geo's group names once, the non-instanced parts share them
+				GetSplitGroupNames(CurrentHapiGeoInfo.nodeId, 0, false, GeoGroupNames);
 
-				// Update part/instancer type from the part infos
-				EHoudiniPartType CurrentPartType = EHoudiniPartType::Invalid;
-				EHoudiniInstancerType CurrentInstancerType = EHoudiniInstancerType::Invalid;
-				switch (CurrentHapiPartInfo.type)
-				{
-					case HAPI_PARTTYPE_BOX:
-					case HAPI_PARTTYPE_SPHERE:
-					case HAPI_PARTTYPE_MESH:
-					{
-						if (CurrentHapiGeoInfo.type == HAPI_GEOTYPE_CURVE)
-						{
-							// Closed curve will be seen as mesh
-							CurrentPartType = EHoudiniPartType::Curve;
-						}
-						else
-						{
-							CurrentPartType = EHoudiniPartType::Mesh;
-							
-							if (CurrentHapiObjectInfo.isInstancer)
-							{
-								if (FHoudiniEngineUtils::IsAttributeInstancer(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, CurrentInstancerType))
-								{
-									// That part is actually an attribute instancer
-									CurrentPartType = EHoudiniPartType::Instancer;
-									// Instancer type is set by IsAttributeInstancer
-								}
-								else
-								{
-									// That part is actually an instancer
-									CurrentPartType = EHoudiniPartType::Instancer;
-									CurrentInstancerType = EHoudiniInstancerType::ObjectInstancer;
-								}
-								
-							}
-							else if (CurrentHapiPartInfo.vertexCount <= 0 && CurrentHapiPartInfo.pointCount <= 0)
-							{
-								// No points, no vertices, we're likely invalid
-								CurrentPartType = EHoudiniPartType::Invalid;
-								HOUDINI_LOG_MESSAGE(
-									TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] is a mesh with no points or vertices - skipping."),
-									CurrentHapiObjectInfo.nodeId, *CurrentObjectName, CurrentHapiGeoInfo.nodeId, PartId, *CurrentPartName);
-							}
-							else if (CurrentHapiPartInfo.vertexCount <= 0)
-							{
-								// This is not an instancer, we do not have vertices, but we have points
-								// Maybe this is a point cloud with attribute override instancing
-								if(FHoudiniEngineUtils::IsAttributeInstancer(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, CurrentInstancerType))
-								{
-									// Mark it as an instancer
-									CurrentPartType = EHoudiniPartType::Instancer;
-									// Instancer type is set by IsAttributeInstancer
-									//CurrentInstancerType = EHoudiniInstancerType::OldSchoolAttributeInstancer;
-								}
-								else
-								{
-									// No vertices, not an instancer, just a point cloud, consider ourself as invalid
-									CurrentPartType = EHoudiniPartType::Invalid;
-									HOUDINI_LOG_MESSAGE(
-										TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] is a point cloud mesh - skipping."),
-										CurrentHapiObjectInfo.nodeId, *CurrentObjectName, CurrentHapiGeoInfo.nodeId, PartId, *CurrentPartName);
-								}
-							}
-						}
-					}
-					break;
+				PendingParts.SetNum(CurrentGeoInfo.PartCount);
+				while (NumDispatchedParts < FMath::Min(MaxFetchWorkers, CurrentGeoInfo.PartCount))
+					DispatchNextPart();
+			}
 
-					case HAPI_PARTTYPE_CURVE:
+			// Iterate on this geo's parts
+			for (int32 PartId = 0; PartId < CurrentGeoInfo.PartCount; ++PartId)
+			{
+				FHoudiniOutputPartData PartData;
+				bool bFetchPartHere = true;
+				if (bPipelineParts)
+				{
+					// Wait for this part's data, profile this to see how much of the fetch is still exposed
+					TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniOutputTranslator::WaitForPartOutputData"));
+					PartData = PendingParts[PartId].Get();
+					PendingParts[PartId].Reset();
+
+					// Parts of templated geos might need another cook to be retrieved, this has to be done here
+					bFetchPartHere = PartData.bPartInfoFailed && CurrentHapiGeoInfo.isTemplated && InOutputTemplatedGeos;
+					if (bFetchPartHere)
 					{
-						// Make sure that this curve is not an an attribute instancer!
-						if (FHoudiniEngineUtils::IsAttributeInstancer(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, CurrentInstancerType))
-						{
-							// Mark the part as an instancer it as an instancer
-							CurrentPartType = EHoudiniPartType::Instancer;
-							// Instancer type is set by IsAttributeInstancer
-							//CurrentInstancerType = EHoudiniInstancerType::OldSchoolAttributeInstancer;
-						}
-						else
+						// Make sure no worker is still fetching data before cooking the node
+						for (TFuture<FHoudiniOutputPartData>& CurrentPending : PendingParts)
 						{
-							// The curve is a curve!
-							CurrentPartType = EHoudiniPartType::Curve;
+							if (CurrentPending.IsValid())
+								CurrentPending.Wait();
 						}
 					}
-						break;
-
-					case HAPI_PARTTYPE_INSTANCER:
-						// This is a packed primitive instancer
-						CurrentPartType = EHoudiniPartType::Instancer;
-						CurrentInstancerType = EHoudiniInstancerType::PackedPrimitive;
-						break;
-
-					case HAPI_PARTTYPE_VOLUME:
-						// Volume data, likely a Heightfield height / mask	
-						CurrentPartType = EHoudiniPartType::Volume;
-						break;
-
-					default:
-						// Unsupported Part Type
-						break;
 				}
 
-				// There are no vertices AND no points and this part is not a packed prim instancer
-				if ((CurrentPartInfo.VertexCount <= 0 && CurrentPartInfo.PointCount <= 0)
-					&& (CurrentPartType != EHoudiniPartType::Instancer || CurrentInstancerType != EHoudiniInstancerType::PackedPrimitive))
+				if (bFetchPartHere)
 				{
-					HOUDINI_LOG_MESSAGE(
-						TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] no points or vertices found - skipping."),
-						CurrentHapiObjectInfo.nodeId, *CurrentObjectName, CurrentHapiGeoInfo.nodeId, PartId, *CurrentPartName);
-					continue;
-				}
+					// Get part information.
+					HAPI_PartInfo CurrentHapiPartInfo;
+					FHoudiniApi::PartInfo_Init(&CurrentHapiPartInfo);
 
-				// This is an instancer with no points.
-				if (CurrentHapiObjectInfo.isInstancer && CurrentHapiPartInfo.pointCount <= 0)
-				{
-					HOUDINI_LOG_MESSAGE(
-						TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] is instancer but has 0 points - skipping."),
-						CurrentHapiObjectInfo.nodeId, *CurrentObjectName, CurrentHapiGeoInfo.nodeId, PartId, *CurrentPartName);
-					continue;
-				}
-				
-				// Extract Mesh sockets
-				// Do this before ignoring invalid parts, as socket groups/attributes could be set on parts
-				// that don't have any mesh, just points! Those would be be considered "invalid" parts but
-				// could still have valid sockets!
-				TArray<FHoudiniMeshSocket> PartMeshSockets;
-				FHoudiniEngineUtils::AddMeshSocketsToArray_DetailAttribute(
-					CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, PartMeshSockets, CurrentHapiPartInfo.isInstanced);
-				FHoudiniEngineUtils::AddMeshSocketsToArray_Group(
-					CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, PartMeshSockets, CurrentHapiPartInfo.isInstanced);
-
-				// Ignore invalid parts
-				if (CurrentPartType == EHoudiniPartType::Invalid)
-				{
-					if(PartMeshSockets.Num() > 0)
+					// If the geo is templated, cook it manually
+					if (CurrentHapiGeoInfo.isTemplated && InOutputTemplatedGeos)
 					{
-						// Store these Part sockets for the Geo
-						// We'll copy them to the outputs produced by this Geo later
-						GeoMeshSockets.Append(PartMeshSockets);
+						//HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
+						//FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, &CookOptions);
+						FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
 					}
 
-					continue;
-				}
-
-				// Build the HGPO corresponding to this part
-				FHoudiniGeoPartObject currentHGPO;
-				currentHGPO.AssetId = AssetId;
-				currentHGPO.AssetName = CurrentAssetName;
-
-				currentHGPO.ObjectId = CurrentHapiObjectInfo.nodeId;
-				currentHGPO.ObjectName = CurrentObjectName;
-
-				currentHGPO.GeoId = CurrentHapiGeoInfo.nodeId;
-
-				currentHGPO.PartId = CurrentHapiPartInfo.id;
-
-				currentHGPO.Type = CurrentPartType;
-				currentHGPO.InstancerType = CurrentInstancerType;
-
-				currentHGPO.TransformMatrix = TransformMatrix;
-
-				currentHGPO.NodePath = TEXT("");
-
-				currentHGPO.bIsVisible = CurrentHapiObjectInfo.isVisible && !CurrentHapiPartInfo.isInstanced;
-				currentHGPO.bIsEditable = CurrentHapiGeoInfo.isEditable;
-				currentHGPO.bIsInstanced = CurrentHapiPartInfo.isInstanced;
-				// Never consider a display geo as templated!
-				currentHGPO.bIsTemplated = CurrentHapiGeoInfo.isDisplayGeo ? false : CurrentHapiGeoInfo.isTemplated;
-
-				currentHGPO.bHasGeoChanged = CurrentHapiGeoInfo.hasGeoChanged;
-				currentHGPO.bHasPartChanged = CurrentHapiPartInfo.hasChanged;
-				currentHGPO.bHasMaterialsChanged = CurrentHapiGeoInfo.hasMaterialChanged;
-				currentHGPO.bHasTransformChanged = CurrentHapiObjectInfo.hasTransformChanged;
-				
-				// Copy the HAPI info caches 
-				currentHGPO.ObjectInfo = CurrentObjectInfo;
-				currentHGPO.GeoInfo = CurrentGeoInfo;
-				currentHGPO.PartInfo = CurrentPartInfo;
-
-				currentHGPO.AllMeshSockets = PartMeshSockets;
-				
-				// If the mesh is NOT visible and is NOT instanced, skip it.
-				if (!currentHGPO.bIsVisible && !currentHGPO.bIsInstanced)
-				{
-					continue;
-				}
-
-				// We only support meshes for templated geos
-				if (currentHGPO.bIsTemplated && (CurrentPartType != EHoudiniPartType::Mesh))
-					continue;
-
-				// Update the HGPO's node path
-				FHoudiniEngineUtils::HapiGetNodePath(currentHGPO, currentHGPO.NodePath);
-
-				// Try to get the custom part name from attribute
-				FString CustomPartName;
-				if (FHoudiniOutputTranslator::GetCustomPartNameFromAttribute(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, CustomPartName))
-					currentHGPO.SetCustomPartName(CustomPartName);
-				else
-					currentHGPO.PartName = CurrentPartName;
-
-				//
-				// Mesh Only - Extract split groups
-				// 
-				// Extract the group names used by this part to see if it will require splitting
-				// Only meshes can be split, via their primitive groups
-				TArray<FString> SplitGroupNames;
-				if (CurrentPartType == EHoudiniPartType::Mesh)
-				{
-					if (!CurrentHapiPartInfo.isInstanced && GeoGroupNames.Num() > 0)
-					{
-						// We are not instanced and already have extracted the geo's group names
-						// We can simply reuse the Geo group names / socket groups
-						currentHGPO.SplitGroups = GeoGroupNames;
-					}
-					else
+					bool bPartInfoFailed = false;
+					if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
+						FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, PartId, &CurrentHapiPartInfo))
 					{
-						// We need to get the primitive group names from HAPI
-						int32 GroupCount = 0;
-						TArray<FString> GroupNames;
-						if (!FHoudiniEngineUtils::HapiGetGroupNames(
-							CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id,
-							HAPI_GROUPTYPE_PRIM, CurrentHapiPartInfo.isInstanced,
-							GroupNames))
-						{
-							GroupCount = 0;
-							GroupNames.Empty();
-						}
+						bPartInfoFailed = true;
 
-						// Convert the string handles to FStrings
-						for (const FString& GroupName : GroupNames)
+						// If the geo is templated, attempt to cook it manually
+						if(CurrentHapiGeoInfo.isTemplated && InOutputTemplatedGeos)
 						{
-							FString LodGroup = HAPI_UNREAL_GROUP_LOD_PREFIX;
-							FString CollisionGroup = HAPI_UNREAL_GROUP_INVISIBLE_COLLISION_PREFIX;
-							FString RenderedCollisionGroup = HAPI_UNREAL_GROUP_RENDERED_COLLISION_PREFIX;
-							if (GroupName.StartsWith(LodGroup, ESearchCase::IgnoreCase)
-								|| GroupName.StartsWith(CollisionGroup, ESearchCase::IgnoreCase)
-								|| GroupName.StartsWith(RenderedCollisionGroup, ESearchCase::IgnoreCase))
-								//|| GroupName.StartsWith(HAPI_UNREAL_GROUP_USER_SPLIT_PREFIX, ESearchCase::IgnoreCase))
-							{
-								// Split by collisions / lods
-								currentHGPO.SplitGroups.Add(GroupName);
-							}
-						}
+							//HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
+							//FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, nullptr);
+							FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
 
-						// Sort the Group name array by name, 
-						// this will order the LODs and other incremental group names
-						currentHGPO.SplitGroups.Sort();
+							HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
+								FHoudiniEngine::Get().GetSession(),
+								CurrentHapiGeoInfo.nodeId,
+								&GeoInfos[GeoIdx]));
 
-						// If this part is not instanced, we can copy the geo
-						// group names so we can reuse them for another part
-						if (!CurrentHapiPartInfo.isInstanced)
-						{
-							GeoGroupNames = currentHGPO.SplitGroups;
+							if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetPartInfo(
+								FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, PartId, &CurrentHapiPartInfo))
+							{
+								// We managed to get the templated part infos after cooking
+								bPartInfoFailed = false;
+							}
 						}
 					}
-				}
-
-				//
-				// Volume Only - Extract volume name/tile index
-				// 
-				// Extract the volume's name, and see if a tile attribute is present
-				FHoudiniVolumeInfo CurrentVolumeInfo;
-				if (CurrentPartType == EHoudiniPartType::Volume)
-				{
-					// Get this volume's info
-					HAPI_VolumeInfo CurrentHapiVolumeInfo;
-					FHoudiniApi::VolumeInfo_Init(&CurrentHapiVolumeInfo);
-
-					bool bVolumeValid = true;
-					if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetVolumeInfo(
-						FHoudiniEngine::Get().GetSession(),
-						CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id,
-						&CurrentHapiVolumeInfo))
-					{
-						bVolumeValid = false;
-					}
-					else if (CurrentHapiVolumeInfo.tupleSize != 1)
-					{
-						bVolumeValid = false;
-					}
-					else if (CurrentHapiVolumeInfo.zLength != 1)
-					{
-						bVolumeValid = false;
-					}
-					else if (CurrentHapiVolumeInfo.storage != HAPI_STORAGETYPE_FLOAT)
-					{
-						bVolumeValid = false;
-					}
 
-					// Only cache valid volumes
-					if (bVolumeValid)
+					PartData.bPartInfoFailed = bPartInfoFailed;
+					if (!bPartInfoFailed)
 					{
-						// Convert/Cache the volume info
-						CacheVolumeInfo(CurrentHapiVolumeInfo, CurrentVolumeInfo);
-
-						// Get the volume's name
-						currentHGPO.VolumeName = CurrentVolumeInfo.Name;
-
-						// Now see if this volume has a tile attribute
-						TArray<int32> TileValues;
-						if (FHoudiniEngineUtils::GetTileAttribute(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, TileValues, HAPI_ATTROWNER_PRIM, 0, 1))
-						{
-							if (TileValues.Num() > 0 && TileValues[0] >= 0)
-								currentHGPO.VolumeTileIndex = TileValues[0];
-							else
-								currentHGPO.VolumeTileIndex = -1;
-						}
-
-						currentHGPO.bHasEditLayers = FHoudiniEngineUtils::GetEditLayerName(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, currentHGPO.VolumeLayerName, HAPI_ATTROWNER_PRIM);
+						FetchPartOutputData(
+							AssetId, CurrentAssetName, CurrentHapiObjectInfo, CurrentObjectInfo, TransformMatrix,
+							CurrentHapiGeoInfo, CurrentGeoInfo, CurrentHapiPartInfo, &GeoGroupNames, bPipelineParts, PartData);
 					}
 				}
-				currentHGPO.VolumeInfo = CurrentVolumeInfo;
 
-				// Cache the curve info as well
-				// !!! Only call GetCurveInfo if the PartType is Curve
-				// !!! Closed curves are actually Meshes, and calling GetCurveInfo on a Mesh will crash HAPI!
-				FHoudiniCurveInfo CurrentCurveInfo;
-				if (CurrentPartType == EHoudiniPartType::Curve && CurrentPartInfo.Type == EHoudiniPartType::Curve)
+				// Keep the workers busy
+				if (bPipelineParts && NumDispatchedParts < CurrentGeoInfo.PartCount)
+					DispatchNextPart();
+
+				if (PartData.bPartInfoFailed)
 				{
-					HAPI_CurveInfo CurrentHapiCurveInfo;
-					FHoudiniApi::CurveInfo_Init(&CurrentHapiCurveInfo);
-					if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetCurveInfo(
-						FHoudiniEngine::Get().GetSession(),
-						CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id,
-						&CurrentHapiCurveInfo))
-					{
-						// Cache/Convert this part's curve info
-						CacheCurveInfo(CurrentHapiCurveInfo, CurrentCurveInfo);
-					}
+					// Error retrieving part info.
+					HOUDINI_LOG_MESSAGE(
+						TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d] unable to retrieve PartInfo - skipping."),
+						CurrentHapiObjectInfo.nodeId, *CurrentObjectName, CurrentHapiGeoInfo.nodeId, PartId);
+					continue;
 				}
-				currentHGPO.CurveInfo = CurrentCurveInfo;
 
+				// Store the sockets of invalid parts for the Geo
+				// We'll copy them to the outputs produced by this Geo later
+				if (PartData.bAddSocketsToGeo)
+					GeoMeshSockets.Append(PartData.HGPO.AllMeshSockets);
+
+				if (PartData.bSkipPart)
+					continue;
+
+				FHoudiniGeoPartObject& currentHGPO = PartData.HGPO;
 
 				// TODO:
 				// DONE? bake folders are handled out of this loop?
@@ -1870,6 +1643,383 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 	return true;
 }
 
+void
+FHoudiniOutputTranslator::GetSplitGroupNames(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const bool& bInIsInstanced,
+	TArray<FString>& OutSplitGroupNames)
+{
+	TArray<FString> GroupNames;
+	if (!FHoudiniEngineUtils::HapiGetGroupNames(
+		InGeoId, InPartId,
+		HAPI_GROUPTYPE_PRIM, bInIsInstanced,
+		GroupNames))
+	{
+		GroupNames.Empty();
+	}
+
+	for (const FString& GroupName : GroupNames)
+	{
+		FString LodGroup = HAPI_UNREAL_GROUP_LOD_PREFIX;
+		FString CollisionGroup = HAPI_UNREAL_GROUP_INVISIBLE_COLLISION_PREFIX;
+		FString RenderedCollisionGroup = HAPI_UNREAL_GROUP_RENDERED_COLLISION_PREFIX;
+		if (GroupName.StartsWith(LodGroup, ESearchCase::IgnoreCase)
+			|| GroupName.StartsWith(CollisionGroup, ESearchCase::IgnoreCase)
+			|| GroupName.StartsWith(RenderedCollisionGroup, ESearchCase::IgnoreCase))
+			//|| GroupName.StartsWith(HAPI_UNREAL_GROUP_USER_SPLIT_PREFIX, ESearchCase::IgnoreCase))
+		{
+			// Split by collisions / lods
+			OutSplitGroupNames.Add(GroupName);
+		}
+	}
+
+	// Sort the Group name array by name, 
+	// this will order the LODs and other incremental group names
+	OutSplitGroupNames.Sort();
+}
+
+void
+FHoudiniOutputTranslator::FetchPartOutputData(
+	const HAPI_NodeId& InAssetId,
+	const FString& InAssetName,
+	const HAPI_ObjectInfo& InHapiObjectInfo,
+	const FHoudiniObjectInfo& InObjectInfo,
+	const FTransform& InTransform,
+	const HAPI_GeoInfo& InHapiGeoInfo,
+	const FHoudiniGeoInfo& InGeoInfo,
+	const HAPI_PartInfo& InHapiPartInfo,
+	TArray<FString>* InOutGeoGroupNames,
+	const bool& bInGeoGroupNamesFetched,
+	FHoudiniOutputPartData& OutPartData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniOutputTranslator::FetchPartOutputData"));
+
+	OutPartData.bPartInfoFailed = false;
+	OutPartData.bSkipPart = true;
+	OutPartData.bAddSocketsToGeo = false;
+
+	const FString& CurrentObjectName = InObjectInfo.Name;
+	const int32& PartId = InHapiPartInfo.id;
+
+	// Convert/cache the part info
+	FHoudiniPartInfo CurrentPartInfo;
+	CachePartInfo(InHapiPartInfo, CurrentPartInfo);
+
+	// Retrieve part name.
+	FString CurrentPartName = CurrentPartInfo.Name;
+
+	// Unsupported/Invalid part
+	if (CurrentPartInfo.Type == EHoudiniPartType::Invalid)
+		return;
+
+	// Update part/instancer type from the part infos
+	EHoudiniPartType CurrentPartType = EHoudiniPartType::Invalid;
+	EHoudiniInstancerType CurrentInstancerType = EHoudiniInstancerType::Invalid;
+	switch (InHapiPartInfo.type)
+	{
+		case HAPI_PARTTYPE_BOX:
+		case HAPI_PARTTYPE_SPHERE:
+		case HAPI_PARTTYPE_MESH:
+		{
+			if (InHapiGeoInfo.type == HAPI_GEOTYPE_CURVE)
+			{
+				// Closed curve will be seen as mesh
+				CurrentPartType = EHoudiniPartType::Curve;
+			}
+			else
+			{
+				CurrentPartType = EHoudiniPartType::Mesh;
+				
+				if (InHapiObjectInfo.isInstancer)
+				{
+					if (FHoudiniEngineUtils::IsAttributeInstancer(InHapiGeoInfo.nodeId, InHapiPartInfo.id, CurrentInstancerType))
+					{
+						// That part is actually an attribute instancer
+						CurrentPartType = EHoudiniPartType::Instancer;
+						// Instancer type is set by IsAttributeInstancer
+					}
+					else
+					{
+						// That part is actually an instancer
+						CurrentPartType = EHoudiniPartType::Instancer;
+						CurrentInstancerType = EHoudiniInstancerType::ObjectInstancer;
+					}
+					
+				}
+				else if (InHapiPartInfo.vertexCount <= 0 && InHapiPartInfo.pointCount <= 0)
+				{
+					// No points, no vertices, we're likely invalid
+					CurrentPartType = EHoudiniPartType::Invalid;
+					HOUDINI_LOG_MESSAGE(
+						TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] is a mesh with no points or vertices - skipping."),
+						InHapiObjectInfo.nodeId, *CurrentObjectName, InHapiGeoInfo.nodeId, PartId, *CurrentPartName);
+				}
+				else if (InHapiPartInfo.vertexCount <= 0)
+				{
+					// This is not an instancer, we do not have vertices, but we have points
+					// Maybe this is a point cloud with attribute override instancing
+					if(FHoudiniEngineUtils::IsAttributeInstancer(InHapiGeoInfo.nodeId, InHapiPartInfo.id, CurrentInstancerType))
+					{
+						// Mark it as an instancer
+						CurrentPartType = EHoudiniPartType::Instancer;
+						// Instancer type is set by IsAttributeInstancer
+						//CurrentInstancerType = EHoudiniInstancerType::OldSchoolAttributeInstancer;
+					}
+					else
+					{
+						// No vertices, not an instancer, just a point cloud, consider ourself as invalid
+						CurrentPartType = EHoudiniPartType::Invalid;
+						HOUDINI_LOG_MESSAGE(
+							TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] is a point cloud mesh - skipping."),
+							InHapiObjectInfo.nodeId, *CurrentObjectName, InHapiGeoInfo.nodeId, PartId, *CurrentPartName);
+					}
+				}
+			}
+		}
+		break;
+
+		case HAPI_PARTTYPE_CURVE:
+		{
+			// Make sure that this curve is not an an attribute instancer!
+			if (FHoudiniEngineUtils::IsAttributeInstancer(InHapiGeoInfo.nodeId, InHapiPartInfo.id, CurrentInstancerType))
+			{
+				// Mark the part as an instancer it as an instancer
+				CurrentPartType = EHoudiniPartType::Instancer;
+				// Instancer type is set by IsAttributeInstancer
+				//CurrentInstancerType = EHoudiniInstancerType::OldSchoolAttributeInstancer;
+			}
+			else
+			{
+				// The curve is a curve!
+				CurrentPartType = EHoudiniPartType::Curve;
+			}
+		}
+			break;
+
+		case HAPI_PARTTYPE_INSTANCER:
+			// This is a packed primitive instancer
+			CurrentPartType = EHoudiniPartType::Instancer;
+			CurrentInstancerType = EHoudiniInstancerType::PackedPrimitive;
+			break;
+
+		case HAPI_PARTTYPE_VOLUME:
+			// Volume data, likely a Heightfield height / mask	
+			CurrentPartType = EHoudiniPartType::Volume;
+			break;
+
+		default:
+			// Unsupported Part Type
+			break;
+	}
+
+	// There are no vertices AND no points and this part is not a packed prim instancer
+	if ((CurrentPartInfo.VertexCount <= 0 && CurrentPartInfo.PointCount <= 0)
+		&& (CurrentPartType != EHoudiniPartType::Instancer || CurrentInstancerType != EHoudiniInstancerType::PackedPrimitive))
+	{
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] no points or vertices found - skipping."),
+			InHapiObjectInfo.nodeId, *CurrentObjectName, InHapiGeoInfo.nodeId, PartId, *CurrentPartName);
+		return;
+	}
+
+	// This is an instancer with no points.
+	if (InHapiObjectInfo.isInstancer && InHapiPartInfo.pointCount <= 0)
+	{
+		HOUDINI_LOG_MESSAGE(
+			TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] is instancer but has 0 points - skipping."),
+			InHapiObjectInfo.nodeId, *CurrentObjectName, InHapiGeoInfo.nodeId, PartId, *CurrentPartName);
+		return;
+	}
+	
+	// Extract Mesh sockets
+	// Do this before ignoring invalid parts, as socket groups/attributes could be set on parts
+	// that don't have any mesh, just points! Those would be be considered "invalid" parts but
+	// could still have valid sockets!
+	TArray<FHoudiniMeshSocket> PartMeshSockets;
+	FHoudiniEngineUtils::AddMeshSocketsToArray_DetailAttribute(
+		InHapiGeoInfo.nodeId, InHapiPartInfo.id, PartMeshSockets, InHapiPartInfo.isInstanced);
+	FHoudiniEngineUtils::AddMeshSocketsToArray_Group(
+		InHapiGeoInfo.nodeId, InHapiPartInfo.id, PartMeshSockets, InHapiPartInfo.isInstanced);
+
+	// Ignore invalid parts
+	if (CurrentPartType == EHoudiniPartType::Invalid)
+	{
+		if(PartMeshSockets.Num() > 0)
+		{
+			// Store these Part sockets for the Geo
+			// They'll be copied to the outputs produced by this Geo later
+			OutPartData.HGPO.AllMeshSockets = PartMeshSockets;
+			OutPartData.bAddSocketsToGeo = true;
+		}
+
+		return;
+	}
+
+	// Build the HGPO corresponding to this part
+	FHoudiniGeoPartObject& currentHGPO = OutPartData.HGPO;
+	currentHGPO.AssetId = InAssetId;
+	currentHGPO.AssetName = InAssetName;
+
+	currentHGPO.ObjectId = InHapiObjectInfo.nodeId;
+	currentHGPO.ObjectName = CurrentObjectName;
+
+	currentHGPO.GeoId = InHapiGeoInfo.nodeId;
+
+	currentHGPO.PartId = InHapiPartInfo.id;
+
+	currentHGPO.Type = CurrentPartType;
+	currentHGPO.InstancerType = CurrentInstancerType;
+
+	currentHGPO.InTransform = InTransform;
+
+	currentHGPO.NodePath = TEXT("");
+
+	currentHGPO.bIsVisible = InHapiObjectInfo.isVisible && !InHapiPartInfo.isInstanced;
+	currentHGPO.bIsEditable = InHapiGeoInfo.isEditable;
+	currentHGPO.bIsInstanced = InHapiPartInfo.isInstanced;
+	// Never consider a display geo as templated!
+	currentHGPO.bIsTemplated = InHapiGeoInfo.isDisplayGeo ? false : InHapiGeoInfo.isTemplated;
+
+	currentHGPO.bHasGeoChanged = InHapiGeoInfo.hasGeoChanged;
+	currentHGPO.bHasPartChanged = InHapiPartInfo.hasChanged;
+	currentHGPO.bHasMaterialsChanged = InHapiGeoInfo.hasMaterialChanged;
+	currentHGPO.bHasTransformChanged = InHapiObjectInfo.hasTransformChanged;
+	
+	// Copy the HAPI info caches 
+	currentHGPO.ObjectInfo = InObjectInfo;
+	currentHGPO.GeoInfo = InGeoInfo;
+	currentHGPO.PartInfo = CurrentPartInfo;
+
+	currentHGPO.AllMeshSockets = PartMeshSockets;
+	
+	// If the mesh is NOT visible and is NOT instanced, skip it.
+	if (!currentHGPO.bIsVisible && !currentHGPO.bIsInstanced)
+	{
+		return;
+	}
+
+	// We only support meshes for templated geos
+	if (currentHGPO.bIsTemplated && (CurrentPartType != EHoudiniPartType::Mesh))
+		return;
+
+	// Update the HGPO's node path
+	FHoudiniEngineUtils::HapiGetNodePath(currentHGPO, currentHGPO.NodePath);
+
+	// Try to get the custom part name from attribute
+	FString CustomPartName;
+	if (FHoudiniOutputTranslator::GetCustomPartNameFromAttribute(InHapiGeoInfo.nodeId, InHapiPartInfo.id, CustomPartName))
+		currentHGPO.SetCustomPartName(CustomPartName);
+	else
+		currentHGPO.PartName = CurrentPartName;
+
+	//
+	// Mesh Only - Extract split groups
+	// 
+	// Extract the group names used by this part to see if it will require splitting
+	// Only meshes can be split, via their primitive groups
+	TArray<FString> SplitGroupNames;
+	if (CurrentPartType == EHoudiniPartType::Mesh)
+	{
+		if (!InHapiPartInfo.isInstanced && InOutGeoGroupNames && (bInGeoGroupNamesFetched || InOutGeoGroupNames->Num() > 0))
+		{
+			// We are not instanced and already have extracted the geo's group names
+			// We can simply reuse the Geo group names / socket groups
+			currentHGPO.SplitGroups = *InOutGeoGroupNames;
+		}
+		else
+		{
+			// We need to get the primitive group names from HAPI
+			GetSplitGroupNames(InHapiGeoInfo.nodeId, InHapiPartInfo.id, InHapiPartInfo.isInstanced, currentHGPO.SplitGroups);
+
+			// If this part is not instanced, we can copy the geo
+			// group names so we can reuse them for another part
+			if (!InHapiPartInfo.isInstanced && InOutGeoGroupNames)
+			{
+				*InOutGeoGroupNames = currentHGPO.SplitGroups;
+			}
+		}
+	}
+
+	//
+	// Volume Only - Extract volume name/tile index
+	// 
+	// Extract the volume's name, and see if a tile attribute is present
+	FHoudiniVolumeInfo CurrentVolumeInfo;
+	if (CurrentPartType == EHoudiniPartType::Volume)
+	{
+		// Get this volume's info
+		HAPI_VolumeInfo CurrentHapiVolumeInfo;
+		FHoudiniApi::VolumeInfo_Init(&CurrentHapiVolumeInfo);
+
+		bool bVolumeValid = true;
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetVolumeInfo(
+			FHoudiniEngine::Get().GetSession(),
+			InHapiGeoInfo.nodeId, InHapiPartInfo.id,
+			&CurrentHapiVolumeInfo))
+		{
+			bVolumeValid = false;
+		}
+		else if (CurrentHapiVolumeInfo.tupleSize != 1)
+		{
+			bVolumeValid = false;
+		}
+		else if (CurrentHapiVolumeInfo.zLength != 1)
+		{
+			bVolumeValid = false;
+		}
+		else if (CurrentHapiVolumeInfo.storage != HAPI_STORAGETYPE_FLOAT)
+		{
+			bVolumeValid = false;
+		}
+
+		// Only cache valid volumes
+		if (bVolumeValid)
+		{
+			// Convert/Cache the volume info
+			CacheVolumeInfo(CurrentHapiVolumeInfo, CurrentVolumeInfo);
+
+			// Get the volume's name
+			currentHGPO.VolumeName = CurrentVolumeInfo.Name;
+
+			// Now see if this volume has a tile attribute
+			TArray<int32> TileValues;
+			if (FHoudiniEngineUtils::GetTileAttribute(InHapiGeoInfo.nodeId, InHapiPartInfo.id, TileValues, HAPI_ATTROWNER_PRIM, 0, 1))
+			{
+				if (TileValues.Num() > 0 && TileValues[0] >= 0)
+					currentHGPO.VolumeTileIndex = TileValues[0];
+				else
+					currentHGPO.VolumeTileIndex = -1;
+			}
+
+			currentHGPO.bHasEditLayers = FHoudiniEngineUtils::GetEditLayerName(InHapiGeoInfo.nodeId, InHapiPartInfo.id, currentHGPO.VolumeLayerName, HAPI_ATTROWNER_PRIM);
+		}
+	}
+	currentHGPO.VolumeInfo = CurrentVolumeInfo;
+
+	// Cache the curve info as well
+	// !!! Only call GetCurveInfo if the PartType is Curve
+	// !!! Closed curves are actually Meshes, and calling GetCurveInfo on a Mesh will crash HAPI!
+	FHoudiniCurveInfo CurrentCurveInfo;
+	if (CurrentPartType == EHoudiniPartType::Curve && CurrentPartInfo.Type == EHoudiniPartType::Curve)
+	{
+		HAPI_CurveInfo CurrentHapiCurveInfo;
+		FHoudiniApi::CurveInfo_Init(&CurrentHapiCurveInfo);
+		if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetCurveInfo(
+			FHoudiniEngine::Get().GetSession(),
+			InHapiGeoInfo.nodeId, InHapiPartInfo.id,
+			&CurrentHapiCurveInfo))
+		{
+			// Cache/Convert this part's curve info
+			CacheCurveInfo(CurrentHapiCurveInfo, CurrentCurveInfo);
+		}
+	}
+	currentHGPO.CurveInfo = CurrentCurveInfo;
+
+	// This part can be output
+	OutPartData.bSkipPart = false;
+}
+
 bool
 FHoudiniOutputTranslator::UpdateChangedOutputs(UHoudiniAssetComponent* HAC)
 {
@@ -27,6 +27,7 @@
 #pragma once
 
 #include "HAPI/HAPI_Common.h"
+#include "HoudiniGeoPartObject.h"
 
 #include "CoreMinimal.h"
 
@@ -44,6 +45,21 @@ enum class EHoudiniGeoType : uint8;
 enum class EHoudiniPartType : uint8;
 enum class EHoudiniCurveType : int8;
 
+// Data fetched from HAPI for a part by BuildAllOutputs, before its output is found or created.
+// Fetching this data does not touch any UObject, so it can be done on a worker thread.
+struct FHoudiniOutputPartData
+{
+	// The part's info could not be retrieved
+	bool bPartInfoFailed = false;
+	// Indicates the part should not be output
+	bool bSkipPart = true;
+	// Indicates that the part's sockets should be added to its geo's outputs (for invalid parts)
+	bool bAddSocketsToGeo = false;
+
+	// HGPO built for this part
+	FHoudiniGeoPartObject HGPO;
+};
+
 struct HOUDINIENGINE_API FHoudiniOutputTranslator
 {
 	// 
@@ -76,6 +92,30 @@ struct HOUDINIENGINE_API FHoudiniOutputTranslator
 	static bool UpdateChangedOutputs(
 		UHoudiniAssetComponent* HAC);
 
+	// Fetches the data needed to create the output for a part, and builds its HGPO.
+	// Only calls HAPI, so this can be run on a worker thread.
+	// InOutGeoGroupNames allows non-instanced parts of the same geo to share their group names, can be null.
+	// If bInGeoGroupNamesFetched is true, InOutGeoGroupNames already holds the geo's split groups, even if empty.
+	static void FetchPartOutputData(
+		const HAPI_NodeId& InAssetId,
+		const FString& InAssetName,
+		const HAPI_ObjectInfo& InHapiObjectInfo,
+		const FHoudiniObjectInfo& InObjectInfo,
+		const FTransform& InTransform,
+		const HAPI_GeoInfo& InHapiGeoInfo,
+		const FHoudiniGeoInfo& InGeoInfo,
+		const HAPI_PartInfo& InHapiPartInfo,
+		TArray<FString>* InOutGeoGroupNames,
+		const bool& bInGeoGroupNamesFetched,
+		FHoudiniOutputPartData& OutPartData);
+
+	// Gets the sorted LOD/collision primitive group names a mesh part will be split by
+	static void GetSplitGroupNames(
+		const HAPI_NodeId& InGeoId,
+		const HAPI_PartId& InPartId,
+		const bool& bInIsInstanced,
+		TArray<FString>& OutSplitGroupNames);
+
 	// Helpers functions used to convert HAPI types
 	static EHoudiniGeoType ConvertHapiGeoType(const HAPI_GeoType& InType);
 	static EHoudiniPartType ConvertHapiPartType(const HAPI_PartType& InType);
@@ -0,0 +1,250 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniPDGEventPump.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/RunnableThread.h"
+
+static TAutoConsoleVariable<float> CVarHoudiniEnginePDGEventPollMinInterval(
+	TEXT("HoudiniEngine.PDGEventPollMinInterval"),
+	10.0f,
+	TEXT("Time (in ms) between two polls of the PDG events while cooking.\n")
+);
+
+static TAutoConsoleVariable<float> CVarHoudiniEnginePDGEventPollMaxInterval(
+	TEXT("HoudiniEngine.PDGEventPollMaxInterval"),
+	250.0f,
+	TEXT("Maximum time (in ms) between two polls of the PDG events when idle.\n")
+);
+
+// Maximum number of events fetched per call, and of graph contexts
+static const int32 MaxNumberOfPDGEvents = 100;
+static const int32 MaxNumberOfPDGContexts = 20;
+
+FHoudiniPDGEventPump::FHoudiniPDGEventPump()
+	: Thread(nullptr)
+	, WakeEvent(nullptr)
+	, bCookActive(false)
+	, bStopping(false)
+{
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FHoudiniPDGEventPump::~FHoudiniPDGEventPump()
+{
+	Shutdown();
+
+	if (WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+}
+
+bool
+FHoudiniPDGEventPump::Start()
+{
+	if (Thread)
+		return true;
+
+	bStopping = false;
+	Thread = FRunnableThread::Create(this, TEXT("HoudiniPDGEventPumpThread"), 0, TPri_BelowNormal);
+	return Thread != nullptr;
+}
+
+void
+FHoudiniPDGEventPump::Shutdown()
+{
+	if (!Thread)
+		return;
+
+	Stop();
+	Thread->WaitForCompletion();
+
+	delete Thread;
+	Thread = nullptr;
+}
+
+uint32
+FHoudiniPDGEventPump::Run()
+{
+	float PollInterval = 0.0f;
+	while (!bStopping)
+	{
+		const int32 NumEvents = PollEvents();
+
+		// Poll fast while cooking or receiving events, back off exponentially when idle
+		const float MinInterval = FMath::Max(CVarHoudiniEnginePDGEventPollMinInterval.GetValueOnAnyThread(), 1.0f);
+		const float MaxInterval = FMath::Max(CVarHoudiniEnginePDGEventPollMaxInterval.GetValueOnAnyThread(), MinInterval);
+		if (NumEvents > 0 || bCookActive)
+			PollInterval = MinInterval;
+		else
+			PollInterval = FMath::Min(FMath::Max(PollInterval, MinInterval) * 2.0f, MaxInterval);
+
+		if (WakeEvent)
+			WakeEvent->Wait(FMath::CeilToInt(PollInterval));
+	}
+
+	return 0;
+}
+
+void
+FHoudiniPDGEventPump::Stop()
+{
+	bStopping = true;
+
+	// Wake up the thread so it can exit
+	if (WakeEvent)
+		WakeEvent->Trigger();
+}
+
+void
+FHoudiniPDGEventPump::SetCookActive(const bool& bInCookActive)
+{
+	const bool bWasCookActive = bCookActive;
+	bCookActive = bInCookActive;
+
+	// Don't wait for the end of an idle interval to pick up the cook's events
+	if (bInCookActive && !bWasCookActive && WakeEvent)
+		WakeEvent->Trigger();
+}
+
+int32
+FHoudiniPDGEventPump::PollEvents()
+{
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	if (!Session)
+		return 0;
+
+	// Get current PDG graph contexts
+	int32 NumContexts = 0;
+	ContextNames.SetNum(MaxNumberOfPDGContexts);
+	ContextIds.SetNum(MaxNumberOfPDGContexts);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPDGGraphContexts(
+		Session, &NumContexts, ContextNames.GetData(), ContextIds.GetData(), MaxNumberOfPDGContexts) || NumContexts <= 0)
+	{
+		return 0;
+	}
+
+	EventInfos.SetNum(MaxNumberOfPDGEvents);
+
+	int32 NumQueuedEvents = 0;
+	for (int32 ContextIdx = 0; ContextIdx < NumContexts && ContextIdx < ContextIds.Num(); ContextIdx++)
+	{
+		const HAPI_PDG_GraphContextId ContextId = ContextIds[ContextIdx];
+
+		// Fetch all the pending events of that context
+		TArray<FHoudiniPDGEvent> Batch;
+		int32 RemainingPDGEventCount = 0;
+		do
+		{
+			int32 PDGEventCount = 0;
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPDGEvents(
+				Session, ContextId, EventInfos.GetData(),
+				MaxNumberOfPDGEvents, &PDGEventCount, &RemainingPDGEventCount))
+			{
+				HOUDINI_LOG_ERROR(TEXT("Failed to get PDG events"));
+				break;
+			}
+
+			for (int32 EventIdx = 0; EventIdx < PDGEventCount; EventIdx++)
+			{
+				FHoudiniPDGEvent& Event = Batch.AddDefaulted_GetRef();
+				Event.ContextId = ContextId;
+				Event.EventInfo = EventInfos[EventIdx];
+			}
+		}
+		while (RemainingPDGEventCount > 0 && !bStopping);
+
+		if (Batch.Num() <= 0)
+			continue;
+
+		// Collapse the state changes of a work item going through transient states (waiting, scheduled, cooking...).
+		// The merged event replaces the last one, and keeps the first event's last state.
+		TArray<bool> Collapsed;
+		Collapsed.SetNumZeroed(Batch.Num());
+		TMap<TPair<HAPI_NodeId, HAPI_PDG_WorkitemId>, int32> LastStateChanges;
+		for (int32 EventIdx = 0; EventIdx < Batch.Num(); EventIdx++)
+		{
+			HAPI_PDG_EventInfo& EventInfo = Batch[EventIdx].EventInfo;
+			const TPair<HAPI_NodeId, HAPI_PDG_WorkitemId> Key(EventInfo.nodeId, EventInfo.workitemId);
+			if (EventInfo.eventType != HAPI_PDG_EVENT_WORKITEM_STATE_CHANGE)
+			{
+				// Never collapse state changes across other events of the work item or its node
+				if (EventInfo.workitemId >= 0)
+					LastStateChanges.Remove(Key);
+				else
+					LastStateChanges.Empty();
+				continue;
+			}
+
+			int32* PreviousIdx = LastStateChanges.Find(Key);
+			if (PreviousIdx && IsTransientWorkItemState(Batch[*PreviousIdx].EventInfo.currentState))
+			{
+				EventInfo.lastState = Batch[*PreviousIdx].EventInfo.lastState;
+				Collapsed[*PreviousIdx] = true;
+			}
+
+			LastStateChanges.Add(Key, EventIdx);
+		}
+
+		for (int32 EventIdx = 0; EventIdx < Batch.Num(); EventIdx++)
+		{
+			if (Collapsed[EventIdx])
+				continue;
+
+			Events.Enqueue(Batch[EventIdx]);
+			NumQueuedEvents++;
+		}
+
+		HOUDINI_PDG_MESSAGE(TEXT("PDG: Pumped %d events (%d collapsed)."), NumQueuedEvents, Batch.Num() - NumQueuedEvents);
+	}
+
+	return NumQueuedEvents;
+}
+
+bool
+FHoudiniPDGEventPump::IsTransientWorkItemState(const int32& InState)
+{
+	switch ((HAPI_PDG_WorkitemState)InState)
+	{
+		case HAPI_PDG_WORKITEM_UNCOOKED:
+		case HAPI_PDG_WORKITEM_WAITING:
+		case HAPI_PDG_WORKITEM_SCHEDULED:
+		case HAPI_PDG_WORKITEM_COOKING:
+			return true;
+
+		default:
+			return false;
+	}
+}
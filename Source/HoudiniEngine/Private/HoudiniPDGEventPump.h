@@ -0,0 +1,100 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Containers/Queue.h"
+
+class FEvent;
+class FRunnableThread;
+
+// A PDG event and the graph context it was received from
+struct FHoudiniPDGEvent
+{
+	HAPI_PDG_GraphContextId ContextId = -1;
+	HAPI_PDG_EventInfo EventInfo;
+};
+
+// Polls the PDG graph contexts for events on a dedicated thread, so the game thread only has to drain a queue.
+// Polling is fast while cooks are active and backs off exponentially when idle.
+// Consecutive state changes of a work item are collapsed when the intermediate states are transient.
+class FHoudiniPDGEventPump : public FRunnable
+{
+public:
+
+	FHoudiniPDGEventPump();
+	virtual ~FHoudiniPDGEventPump();
+
+	// Starts the pump thread
+	bool Start();
+
+	// Stops the pump thread and waits for it to exit
+	void Shutdown();
+
+	bool IsRunning() const { return Thread != nullptr; }
+
+	// FRunnable methods.
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	// Indicates if any TOP node is cooking, the pump polls at the fastest rate while it is.
+	void SetCookActive(const bool& bInCookActive);
+
+	// Pops the next event. Must only be called from a single consumer thread (the game thread).
+	bool DequeueEvent(FHoudiniPDGEvent& OutEvent) { return Events.Dequeue(OutEvent); }
+
+protected:
+
+	// Fetches and queues the events of all the graph contexts, returns the number of events queued.
+	int32 PollEvents();
+
+	// Returns true if a work item in that state is only waiting for a later state change
+	static bool IsTransientWorkItemState(const int32& InState);
+
+private:
+
+	// Single producer (the pump thread), single consumer (the game thread)
+	TQueue<FHoudiniPDGEvent, EQueueMode::Spsc> Events;
+
+	// Buffers used by the pump thread
+	TArray<HAPI_StringHandle> ContextNames;
+	TArray<HAPI_PDG_GraphContextId> ContextIds;
+	TArray<HAPI_PDG_EventInfo> EventInfos;
+
+	FRunnableThread* Thread;
+
+	// Triggered to wake up the thread early (cook started or stopping)
+	FEvent* WakeEvent;
+
+	FThreadSafeBool bCookActive;
+	FThreadSafeBool bStopping;
+};
@@ -29,6 +29,7 @@
 #include "Modules/ModuleManager.h"
 #include "MessageEndpointBuilder.h"
 #include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
 
 #include "HoudiniApi.h"
 #include "HoudiniAsset.h"
@@ -45,6 +46,7 @@
 #include "HoudiniOutputTranslator.h"
 #include "HoudiniPDGTranslator.h"
 #include "HoudiniPDGImporterMessages.h"
+#include "HoudiniPDGEventPump.h"
 
 #include "HAPI/HAPI_Common.h"
 
@@ -52,12 +54,71 @@ HOUDINI_PDG_DEFINE_LOG_CATEGORY();
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePDGEventPumpThread(
+	TEXT("HoudiniEngine.PDGEventPumpThread"),
+	1,
+	TEXT("Where the PDG events are polled from.\n")
+	TEXT("0: On the game thread, at each tick.\n")
+	TEXT("1: On a dedicated thread, the game thread only processes the queued events (default).\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePDGNumImportCommandlets(
+	TEXT("HoudiniEngine.PDGNumImportCommandlets"),
+	1,
+	TEXT("Number of BGEO commandlet processes used for async importing of work result objects.\n")
+	TEXT("Each commandlet uses its own Houdini Engine session. Takes effect when the commandlets are (re)started.\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePDGMaxConcurrentImports(
+	TEXT("HoudiniEngine.PDGMaxConcurrentImports"),
+	4,
+	TEXT("Maximum number of work result objects each BGEO commandlet can be importing at once.\n")
+);
+
+static TAutoConsoleVariable<float> CVarHoudiniEnginePDGImportTimeBudget(
+	TEXT("HoudiniEngine.PDGImportTimeBudget"),
+	10.0f,
+	TEXT("Time budget (in ms) per tick for loading work result objects on the game thread.\n")
+	TEXT("At least one work result object is loaded per tick.\n")
+);
+
+// A work result object waiting to be loaded
+struct FHoudiniPDGWorkResultLoadRequest
+{
+	UHoudiniPDGAssetLink* AssetLink = nullptr;
+	UTOPNode* TOPNode = nullptr;
+	int32 WorkResultArrayIndex = INDEX_NONE;
+	int32 WorkResultObjectArrayIndex = INDEX_NONE;
+	int32 WorkItemIndex = INDEX_NONE;
+	// Results of the selected TOP node are loaded first
+	bool bSelectedNode = false;
+	FHoudiniPackageParams PackageParams;
+
+	// Used to sort the load queue, requests that should be loaded first are "less"
+	bool operator<(const FHoudiniPDGWorkResultLoadRequest& InOther) const
+	{
+		if (bSelectedNode != InOther.bSelectedNode)
+			return bSelectedNode;
+		if (WorkItemIndex != InOther.WorkItemIndex)
+			return WorkItemIndex < InOther.WorkItemIndex;
+		if (WorkResultArrayIndex != InOther.WorkResultArrayIndex)
+			return WorkResultArrayIndex < InOther.WorkResultArrayIndex;
+		return WorkResultObjectArrayIndex < InOther.WorkResultObjectArrayIndex;
+	}
+};
+
 FHoudiniPDGManager::FHoudiniPDGManager()
+	: BGEOCommandletStatus(EHoudiniBGEOCommandletStatus::NotStarted)
 {
 }
 
 FHoudiniPDGManager::~FHoudiniPDGManager()
 {
+	if (PDGEventPump.IsValid())
+	{
+		PDGEventPump->Shutdown();
+		PDGEventPump.Reset();
+	}
 }
 
 bool
@@ -593,6 +654,9 @@ FHoudiniPDGManager::CookTOPNode(UTOPNode* InTOPNode)
 		return;
 	}
 
+	// Cached string handles might not survive the cook
+	FHoudiniEngineString::ClearStringCache(FHoudiniEngineRuntime::GetCurrentSessionIndex());
+
 	if (HAPI_RESULT_SUCCESS != FHoudiniApi::CookPDG(
 		FHoudiniEngine::Get().GetSession(), InTOPNode->NodeId, 0, 0))
 	{
@@ -663,6 +727,9 @@ FHoudiniPDGManager::CookOutput(UTOPNetwork* InTOPNet)
 		return;
 	}
 
+	// Cached string handles might not survive the cook
+	FHoudiniEngineString::ClearStringCache(FHoudiniEngineRuntime::GetCurrentSessionIndex());
+
 	// TODO: ???
 	// Cancel all cooks. This is required as otherwise the graph gets into an infinite cook state (bug?)
 	if(HAPI_RESULT_SUCCESS != FHoudiniApi::CookPDG(
@@ -753,6 +820,9 @@ FHoudiniPDGManager::Update()
 		}
 	}
 
+	// Start, stop or wake up the event pump thread
+	UpdatePDGEventPump();
+
 	// Do nothing if we dont have any valid PDG asset Link
 	if (PDGAssetLinks.Num() <= 0)
 		return;
@@ -770,11 +840,29 @@ FHoudiniPDGManager::Update()
 void
 FHoudiniPDGManager::UpdatePDGContexts()
 {
-	// Get current PDG graph contexts
-	ReinitializePDGContext();
+	const bool bEventPumpRunning = PDGEventPump.IsValid() && PDGEventPump->IsRunning();
+	if (bEventPumpRunning)
+	{
+		// Process the events queued by the pump thread
+		int32 PDGEventCount = 0;
+		FHoudiniPDGEvent PDGEvent;
+		while (PDGEventPump->DequeueEvent(PDGEvent))
+		{
+			ProcessPDGEvent(PDGEvent.ContextId, PDGEvent.EventInfo);
+			PDGEventCount++;
+		}
+
+		if (PDGEventCount > 0)
+			HOUDINI_LOG_MESSAGE(TEXT("PDG: Tick processed %d pumped events."), PDGEventCount);
+	}
+	else
+	{
+		// Get current PDG graph contexts
+		ReinitializePDGContext();
+	}
 
 	// Process next set of events for each graph context
-	if (PDGContextIDs.Num() > 0)
+	if (!bEventPumpRunning && PDGContextIDs.Num() > 0)
 	{
 		// Only initialize event array if not valid, or user resized max size
 		if(PDGEventInfos.Num() != MaxNumberOfPDGEvents)
@@ -843,6 +931,75 @@ FHoudiniPDGManager::UpdatePDGContexts()
 	}
 }
 
+void
+FHoudiniPDGManager::UpdatePDGEventPump()
+{
+	const bool bUsePump = PDGAssetLinks.Num() > 0 && CVarHoudiniEnginePDGEventPumpThread.GetValueOnGameThread() != 0;
+	if (!bUsePump)
+	{
+		if (PDGEventPump.IsValid())
+		{
+			PDGEventPump->Shutdown();
+
+			// Process the events that were already pumped before switching back to polling
+			FHoudiniPDGEvent PDGEvent;
+			while (PDGAssetLinks.Num() > 0 && PDGEventPump->DequeueEvent(PDGEvent))
+				ProcessPDGEvent(PDGEvent.ContextId, PDGEvent.EventInfo);
+
+			PDGEventPump.Reset();
+		}
+		return;
+	}
+
+	if (!PDGEventPump.IsValid())
+		PDGEventPump = MakeUnique<FHoudiniPDGEventPump>();
+
+	if (!PDGEventPump->IsRunning() && !PDGEventPump->Start())
+	{
+		HOUDINI_LOG_WARNING(TEXT("PDG: Failed to start the event pump thread, polling PDG events on the game thread."));
+		PDGEventPump.Reset();
+		return;
+	}
+
+	PDGEventPump->SetCookActive(IsAnyTOPNodeCooking());
+}
+
+void
+FHoudiniPDGManager::StopPDGEventPump()
+{
+	if (!PDGEventPump.IsValid())
+		return;
+
+	// The pumped events refer to the session being closed, drop them
+	PDGEventPump->Shutdown();
+	PDGEventPump.Reset();
+}
+
+bool
+FHoudiniPDGManager::IsAnyTOPNodeCooking() const
+{
+	for (const TWeakObjectPtr<UHoudiniPDGAssetLink>& CurAssetLink : PDGAssetLinks)
+	{
+		const UHoudiniPDGAssetLink* AssetLink = CurAssetLink.Get();
+		if (!IsValid(AssetLink))
+			continue;
+
+		for (const UTOPNetwork* TOPNetwork : AssetLink->AllTOPNetworks)
+		{
+			if (!IsValid(TOPNetwork))
+				continue;
+
+			for (const UTOPNode* TOPNode : TOPNetwork->AllTOPNodes)
+			{
+				if (IsValid(TOPNode) && (TOPNode->NodeState == EPDGNodeState::Cooking || TOPNode->AnyWorkItemsPending()))
+					return true;
+			}
+		}
+	}
+
+	return false;
+}
+
 // Query the currently active PDG graph contexts in the Houdini Engine session.
 // Should be done each time to get latest set of graph contexts.
 void
@@ -1405,14 +1562,13 @@ FHoudiniPDGManager::CreateOrRelinkWorkItem(
 			FTOPWorkResult LocalWorkResult;
 			LocalWorkResult.WorkItemID = InWorkItemID;
 			LocalWorkResult.WorkItemIndex = WorkItemInfo.index;
-			Index = InTOPNode->WorkResult.Add(LocalWorkResult);
+			Index = InTOPNode->AddWorkResult(LocalWorkResult);
 		}
 		else
 		{
 			// We found a stale entry, re-use it
-			FTOPWorkResult& ReUsedWorkResult = InTOPNode->WorkResult[Index];
-			ReUsedWorkResult.WorkItemID = InWorkItemID;
-			ReUsedWorkResult.WorkItemIndex = WorkItemInfo.index;
+			InTOPNode->SetWorkResultID(Index, InWorkItemID);
+			InTOPNode->WorkResult[Index].WorkItemIndex = WorkItemInfo.index;
 		}
 	}
 
@@ -1627,23 +1783,28 @@ FHoudiniPDGManager::SyncAndPruneWorkItems(UTOPNode* InTOPNode)
 	// Remove any work result entries with invalid IDs or where the WorkItemID is not in the set of ids returned by
 	// HAPI (only if we could get the IDs from HAPI).
 	const FGuid HoudiniComponentGuid(InTOPNode->GetHoudiniComponentGuid());
-	int32 NumRemoved = 0;
+	auto ShouldPrune = [&WorkItemIDSet](const FTOPWorkResult& InWorkResult)
+	{
+		return InWorkResult.WorkItemID == INDEX_NONE || !WorkItemIDSet.Contains(InWorkResult.WorkItemID);
+	};
+
 	const int32 NumWorkItemsInArray = InTOPNode->WorkResult.Num();
 	for (int32 Index = NumWorkItemsInArray - 1; Index >= 0; --Index)
 	{
 		FTOPWorkResult& WorkResult = InTOPNode->WorkResult[Index];
-		if (WorkResult.WorkItemID == INDEX_NONE || !WorkItemIDSet.Contains(WorkResult.WorkItemID))
+		if (ShouldPrune(WorkResult))
 		{
 			HOUDINI_PDG_WARNING(
 				TEXT("Pruning a FTOPWorkResult entry from TOP Node %d, WorkItemID %d, WorkItemIndex %d, Array Index %d"),
 				InTOPNode->NodeId, WorkResult.WorkItemID, WorkResult.WorkItemIndex, Index);
 			WorkResult.ClearAndDestroyResultObjects(HoudiniComponentGuid);
-			InTOPNode->WorkResult.RemoveAt(Index);
 			InTOPNode->OnWorkItemRemoved(WorkResult.WorkItemID);
-			NumRemoved++;
 		}
 	}
 
+	// Remove the pruned entries in a single pass
+	const int32 NumRemoved = InTOPNode->RemoveWorkResults(ShouldPrune);
+
 	return NumRemoved;
 }
 
@@ -1653,6 +1814,9 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniPDGManager::ProcessWorkItemResults);
 
 	const EHoudiniBGEOCommandletStatus CommandletStatus = UpdateAndGetBGEOCommandletStatus();
+
+	// Gather all the work result objects that need to be loaded
+	TArray<FHoudiniPDGWorkResultLoadRequest> LoadRequests;
 	for (auto& CurrentPDGAssetLink : PDGAssetLinks)
 	{
 		// Iterate through all PDG Asset Link
@@ -1660,6 +1824,13 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 		if (!AssetLink)
 			continue;
 
+		AssetLink->NumWorkResultObjectsQueued = 0;
+		AssetLink->NumWorkResultObjectsLoading = 0;
+
+		// Results of the selected TOP node are loaded first
+		const UTOPNetwork* SelectedTOPNet = AssetLink->GetSelectedTOPNetwork();
+		const UTOPNode* SelectedTOPNode = AssetLink->GetSelectedTOPNode();
+
 		// Set up package parameters to:
 		// Cook to temp houdini engine directory
 		// and if the PDG asset link is associated with a Houdini Asset Component (HAC):
@@ -1736,48 +1907,26 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 						FTOPWorkResultObject& CurrentWorkResultObj = CurrentWorkResult.ResultObjects[WorkResultObjectArrayIndex];
 						if (CurrentWorkResultObj.State == EPDGWorkResultState::ToLoad)
 						{
-							CurrentWorkResultObj.State = EPDGWorkResultState::Loading;
-
-							// Load this WRObj
-							PackageParams.PDGTOPNetworkName = CurrentTOPNet->NodeName;
-							PackageParams.PDGTOPNodeName = CurrentTOPNode->NodeName;
-							PackageParams.PDGWorkItemIndex = CurrentWorkResult.WorkItemIndex;
+							// Queue this WRObj, the results are loaded by priority after the scan
+							FHoudiniPDGWorkResultLoadRequest& Request = LoadRequests.AddDefaulted_GetRef();
+							Request.AssetLink = AssetLink;
+							Request.TOPNode = CurrentTOPNode;
+							Request.WorkResultArrayIndex = WorkResultArrayIndex;
+							Request.WorkResultObjectArrayIndex = WorkResultObjectArrayIndex;
+							Request.WorkItemIndex = CurrentWorkResult.WorkItemIndex;
+							Request.bSelectedNode = CurrentTOPNet == SelectedTOPNet && CurrentTOPNode == SelectedTOPNode;
+
+							Request.PackageParams = PackageParams;
+							Request.PackageParams.PDGTOPNetworkName = CurrentTOPNet->NodeName;
+							Request.PackageParams.PDGTOPNodeName = CurrentTOPNode->NodeName;
+							Request.PackageParams.PDGWorkItemIndex = CurrentWorkResult.WorkItemIndex;
 							// Use the array index to ensure uniqueness among the work items of the node (
 							// CurrentWorkResult.WorkItemIndex is not necessarily unique)
-							PackageParams.PDGWorkResultArrayIndex = WorkResultArrayIndex;
-
-							if (CommandletStatus == EHoudiniBGEOCommandletStatus::Connected)
-							{
-								BGEOCommandletEndpoint->Send(new FHoudiniPDGImportBGEOMessage(
-									CurrentWorkResultObj.FilePath,
-									CurrentWorkResultObj.Name,
-									PackageParams,
-									CurrentTOPNode->NodeId,
-									CurrentWorkResult.WorkItemID
-								), BGEOCommandletAddress);
-							}
-							else
-							{
-								if (FHoudiniPDGTranslator::CreateAllResultObjectsForPDGWorkItem(
-									AssetLink,
-									CurrentTOPNode,
-									CurrentWorkResultObj,
-									PackageParams))
-								{
-									CurrentWorkResultObj.State = EPDGWorkResultState::Loaded;
-									CurrentWorkResultObj.SetAutoBakedSinceLastLoad(false);
-									CurrentTOPNode->bCachedHaveLoadedWorkResults = true;
-									
-									// Broadcast that we have loaded the work result object to those interested
-									AssetLink->OnWorkResultObjectLoaded.Broadcast(
-										AssetLink, CurrentTOPNode, WorkResultArrayIndex,
-										CurrentWorkResultObj.WorkItemResultInfoIndex);
-								}
-								else
-								{
-									CurrentWorkResultObj.State = EPDGWorkResultState::None;
-								}
-							}
+							Request.PackageParams.PDGWorkResultArrayIndex = WorkResultArrayIndex;
+						}
+						else if (CurrentWorkResultObj.State == EPDGWorkResultState::Loading)
+						{
+							AssetLink->NumWorkResultObjectsLoading++;
 						}
 						else if (CurrentWorkResultObj.State == EPDGWorkResultState::Loaded)
 						{
@@ -1815,6 +1964,105 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 			}
 		}
 	}
+
+	if (LoadRequests.Num() <= 0)
+		return;
+
+	// Load the queued work result objects by priority.
+	// Each commandlet worker is limited to a number of concurrent imports, while loads on the game thread are limited to a
+	// time budget per tick, so large wedges don't freeze the editor.
+	LoadRequests.Heapify();
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double TimeBudget = FMath::Max(CVarHoudiniEnginePDGImportTimeBudget.GetValueOnGameThread(), 0.0f) / 1000.0;
+	const int32 MaxConcurrentImports = FMath::Max(CVarHoudiniEnginePDGMaxConcurrentImports.GetValueOnGameThread(), 1);
+	int32 NumLoadedOnGameThread = 0;
+	while (LoadRequests.Num() > 0)
+	{
+		FHoudiniBGEOCommandletWorker* Worker = nullptr;
+		if (CommandletStatus == EHoudiniBGEOCommandletStatus::Connected)
+		{
+			// Dispatch to the least loaded worker
+			Worker = GetLeastLoadedBGEOCommandletWorker(MaxConcurrentImports);
+			if (!Worker)
+				break;
+		}
+		else if (NumLoadedOnGameThread > 0 && (FPlatformTime::Seconds() - StartTime) >= TimeBudget)
+		{
+			break;
+		}
+
+		FHoudiniPDGWorkResultLoadRequest Request;
+		LoadRequests.HeapPop(Request, false);
+
+		UHoudiniPDGAssetLink* AssetLink = Request.AssetLink;
+		UTOPNode* CurrentTOPNode = Request.TOPNode;
+		if (!IsValid(AssetLink) || !IsValid(CurrentTOPNode))
+			continue;
+
+		// Make sure the work result object is still waiting to be loaded
+		if (!CurrentTOPNode->WorkResult.IsValidIndex(Request.WorkResultArrayIndex))
+			continue;
+
+		FTOPWorkResult& CurrentWorkResult = CurrentTOPNode->WorkResult[Request.WorkResultArrayIndex];
+		if (!CurrentWorkResult.ResultObjects.IsValidIndex(Request.WorkResultObjectArrayIndex))
+			continue;
+
+		FTOPWorkResultObject& CurrentWorkResultObj = CurrentWorkResult.ResultObjects[Request.WorkResultObjectArrayIndex];
+		if (CurrentWorkResultObj.State != EPDGWorkResultState::ToLoad)
+			continue;
+
+		CurrentWorkResultObj.State = EPDGWorkResultState::Loading;
+
+		// Load this WRObj
+		if (Worker)
+		{
+			BGEOCommandletEndpoint->Send(new FHoudiniPDGImportBGEOMessage(
+				CurrentWorkResultObj.FilePath,
+				CurrentWorkResultObj.Name,
+				Request.PackageParams,
+				CurrentTOPNode->NodeId,
+				CurrentWorkResult.WorkItemID
+			), Worker->Address);
+
+			FHoudiniBGEOImportRequest& ImportRequest = Worker->ImportsInFlight.AddDefaulted_GetRef();
+			ImportRequest.TOPNodeId = CurrentTOPNode->NodeId;
+			ImportRequest.WorkItemId = CurrentWorkResult.WorkItemID;
+			ImportRequest.Name = CurrentWorkResultObj.Name;
+			AssetLink->NumWorkResultObjectsLoading++;
+		}
+		else
+		{
+			if (FHoudiniPDGTranslator::CreateAllResultObjectsForPDGWorkItem(
+				AssetLink,
+				CurrentTOPNode,
+				CurrentWorkResultObj,
+				Request.PackageParams))
+			{
+				CurrentWorkResultObj.State = EPDGWorkResultState::Loaded;
+				CurrentWorkResultObj.SetAutoBakedSinceLastLoad(false);
+				CurrentTOPNode->bCachedHaveLoadedWorkResults = true;
+				
+				// Broadcast that we have loaded the work result object to those interested
+				AssetLink->OnWorkResultObjectLoaded.Broadcast(
+					AssetLink, CurrentTOPNode, Request.WorkResultArrayIndex,
+					CurrentWorkResultObj.WorkItemResultInfoIndex);
+			}
+			else
+			{
+				CurrentWorkResultObj.State = EPDGWorkResultState::None;
+			}
+
+			NumLoadedOnGameThread++;
+		}
+	}
+
+	// The remaining requests will be picked up again on the next tick
+	for (const FHoudiniPDGWorkResultLoadRequest& Request : LoadRequests)
+	{
+		if (IsValid(Request.AssetLink))
+			Request.AssetLink->NumWorkResultObjectsQueued++;
+	}
 }
 
 void FHoudiniPDGManager::HandleImportBGEODiscoverMessage(
@@ -1822,14 +2070,18 @@ void FHoudiniPDGManager::HandleImportBGEODiscoverMessage(
 	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
 {
 	HOUDINI_LOG_DISPLAY(TEXT("Received Discover from %s"), *InContext->GetSender().ToString());
-	// Ignore any discover acks received if we already have a valid local address
-	// for the commandlet
-	if (BGEOCommandletAddress.IsValid())
+	if (!InMessage.CommandletGuid.IsValid())
 		return;
 
-	if (BGEOCommandletProcHandle.IsValid() && InMessage.CommandletGuid.IsValid() && BGEOCommandletGuid == InMessage.CommandletGuid)
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
 	{
-		BGEOCommandletAddress = InContext->GetSender();
+		// Ignore any discover acks received if we already have a valid local address
+		// for the commandlet
+		if (Worker.Address.IsValid() || !Worker.ProcHandle.IsValid() || Worker.Guid != InMessage.CommandletGuid)
+			continue;
+
+		Worker.Address = InContext->GetSender();
+		break;
 	}
 }
 
@@ -1838,6 +2090,39 @@ void FHoudiniPDGManager::HandleImportBGEOResultMessage(
 	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
 {
 	HOUDINI_LOG_MESSAGE(TEXT("Received BGEO import result message"));
+
+	// Free the worker's slot for that import
+	bool bFoundRequest = false;
+	const FMessageAddress& Sender = InContext->GetSender();
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
+	{
+		if (Worker.Address != Sender)
+			continue;
+
+		const int32 RequestIndex = Worker.ImportsInFlight.IndexOfByPredicate([&InMessage](const FHoudiniBGEOImportRequest& InRequest)
+		{
+			return InRequest.TOPNodeId == InMessage.TOPNodeId
+				&& InRequest.WorkItemId == InMessage.WorkItemId
+				&& InRequest.Name == InMessage.Name;
+		});
+
+		if (RequestIndex != INDEX_NONE)
+		{
+			Worker.ImportsInFlight.RemoveAt(RequestIndex);
+			bFoundRequest = true;
+		}
+		break;
+	}
+
+	// Drop replies to requests that aren't tracked anymore (requeued or pool shrunk), whatever their result:
+	// the requeued import will load the same work result object, and the worker's other in flight imports
+	// must stay tracked so they can be requeued if it crashes
+	if (!bFoundRequest)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("Ignoring BGEO import result for %s, its request is not in flight anymore."), *InMessage.Name);
+		return;
+	}
+
 	if (InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_Success || InMessage.ImportResult == EHoudiniPDGImportBGEOResult::HPIBR_PartialSuccess)
 	{
 		FHoudiniPackageParams PackageParams;
@@ -1863,13 +2148,7 @@ void FHoudiniPDGManager::HandleImportBGEOResultMessage(
 			HOUDINI_LOG_WARNING(TEXT("Failed to find TOP work result with id %d, aborting output object creation."), InMessage.WorkItemId);
 			return;
 		}
-		const FString& WorkResultObjectName = InMessage.Name;
-		FTOPWorkResultObject* WorkResultObject = WorkResult->ResultObjects.FindByPredicate(
-			[&WorkResultObjectName](const FTOPWorkResultObject& WorkResultObject) 
-			{ 
-				return WorkResultObject.Name == WorkResultObjectName; 
-			}
-		);
+		FTOPWorkResultObject* WorkResultObject = WorkResult->GetWorkResultObjectByName(InMessage.Name);
 		if (WorkResultObject == nullptr)
 		{
 			HOUDINI_LOG_WARNING(TEXT("Failed to find TOP work result object with name %s, aborting output object creation."), *InMessage.Name);
@@ -2071,6 +2350,19 @@ void FHoudiniPDGManager::HandleImportBGEOResultMessage(
 	else
 	{
 		HOUDINI_LOG_WARNING(TEXT("Commandlet failed to import bgeo for %s"), *InMessage.Name);
+
+		// Don't leave the work result object in the Loading state
+		UHoudiniPDGAssetLink* AssetLink = nullptr;
+		UTOPNetwork* TOPNetwork = nullptr;
+		UTOPNode* TOPNode = nullptr;
+		if (GetTOPAssetLinkNetworkAndNode(InMessage.TOPNodeId, AssetLink, TOPNetwork, TOPNode) && IsValid(TOPNode))
+		{
+			const int32 WorkResultArrayIndex = TOPNode->ArrayIndexOfWorkResultByID(InMessage.WorkItemId);
+			FTOPWorkResult* WorkResult = WorkResultArrayIndex != INDEX_NONE ? TOPNode->GetWorkResultByArrayIndex(WorkResultArrayIndex) : nullptr;
+			FTOPWorkResultObject* WorkResultObject = WorkResult ? WorkResult->GetWorkResultObjectByName(InMessage.Name) : nullptr;
+			if (WorkResultObject && WorkResultObject->State == EPDGWorkResultState::Loading)
+				WorkResultObject->State = EPDGWorkResultState::None;
+		}
 	}
 }
 
@@ -2078,7 +2370,9 @@ bool FHoudiniPDGManager::CreateBGEOCommandletAndEndpoint()
 {
 	if (!BGEOCommandletEndpoint.IsValid())
 	{
-		BGEOCommandletAddress.Invalidate();
+		for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
+			Worker.Address.Invalidate();
+
 		BGEOCommandletEndpoint = FMessageEndpoint::Builder(TEXT("Houdini BGEO Commandlet"))
 			.Handling<FHoudiniPDGImportBGEOResultMessage>(this, &FHoudiniPDGManager::HandleImportBGEOResultMessage)
 			.Handling<FHoudiniPDGImportBGEODiscoverMessage>(this, &FHoudiniPDGManager::HandleImportBGEODiscoverMessage)
@@ -2093,101 +2387,217 @@ bool FHoudiniPDGManager::CreateBGEOCommandletAndEndpoint()
 		BGEOCommandletEndpoint->Subscribe<FHoudiniPDGImportBGEODiscoverMessage>();
 	}
 
-	if (!BGEOCommandletProcHandle.IsValid() || !FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
+	// Resize the pool, stopping the extra workers
+	const int32 NumWorkers = FMath::Max(CVarHoudiniEnginePDGNumImportCommandlets.GetValueOnGameThread(), 1);
+	for (int32 Idx = BGEOCommandletWorkers.Num() - 1; Idx >= NumWorkers; Idx--)
 	{
-		// Start the bgeo commandlet
-		static const FString BGEOCommandletName = TEXT("HoudiniGeoImport");
-		BGEOCommandletGuid = FGuid::NewGuid();
-		BGEOCommandletAddress.Invalidate();
-
-		// Get the absolute path to the project file, if known, otherwise get
-		// the project name. For the path: quote it for the command line.
-		IFileManager& FileManager = IFileManager::Get();
-		FString ProjectPathOrName = FApp::GetProjectName();
-		if (FPaths::IsProjectFilePathSet())
+		FHoudiniBGEOCommandletWorker& Worker = BGEOCommandletWorkers[Idx];
+		RequeueBGEOCommandletWorkerImports(Worker);
+		if (Worker.ProcHandle.IsValid() && FPlatformProcess::IsProcRunning(Worker.ProcHandle))
 		{
-			const FString ProjectPath = FPaths::GetProjectFilePath();
-			if (!ProjectPath.IsEmpty())
-			{
-				ProjectPathOrName = FString::Printf(
-                    TEXT("\"%s\""),
-                    *FileManager.ConvertToAbsolutePathForExternalAppForRead(*ProjectPath)
-                );
-			}
+			FPlatformProcess::TerminateProc(Worker.ProcHandle, true);
+			FPlatformProcess::WaitForProc(Worker.ProcHandle);
+			FPlatformProcess::CloseProc(Worker.ProcHandle);
 		}
+		BGEOCommandletWorkers.RemoveAt(Idx);
+	}
 
-		if (ProjectPathOrName.IsEmpty())
-			return false;
+	if (BGEOCommandletWorkers.Num() < NumWorkers)
+		BGEOCommandletWorkers.SetNum(NumWorkers);
 
-		// Get the executable path for the app/editor
-		FString ExePath = FPlatformProcess::GenerateApplicationPath(FApp::GetName(), FApp::GetBuildConfiguration());
-		if (!ExePath.IsEmpty())
-			ExePath = FileManager.ConvertToAbsolutePathForExternalAppForRead(*ExePath);
+	// Start the workers that are not running
+	bool bStartedAll = true;
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
+	{
+		if (Worker.ProcHandle.IsValid() && FPlatformProcess::IsProcRunning(Worker.ProcHandle))
+			continue;
 
-		if (ExePath.IsEmpty())
-			return false;
-		
-		const FString CommandLineParameters = FString::Printf(
-			TEXT("%s -messaging -run=%s -guid=%s -listen=%s -managerpid=%d"),
-			*ProjectPathOrName,
-			*BGEOCommandletName,
-			*BGEOCommandletGuid.ToString(),
-			*BGEOCommandletEndpoint->GetAddress().ToString(),
-			FPlatformProcess::GetCurrentProcessId());
-
-		BGEOCommandletProcHandle = FPlatformProcess::CreateProc(
-			*ExePath,
-			*CommandLineParameters,
-			false,
-			true,
-			false,
-			&BGEOCommandletProcessId,
-			0,
-			NULL,
-			NULL);
-		if (!BGEOCommandletProcHandle.IsValid())
+		if (!StartBGEOCommandletWorker(Worker))
+			bStartedAll = false;
+	}
+
+	return bStartedAll;
+}
+
+bool
+FHoudiniPDGManager::StartBGEOCommandletWorker(FHoudiniBGEOCommandletWorker& InWorker)
+{
+	if (!BGEOCommandletEndpoint.IsValid())
+		return false;
+
+	// Any import that was sent to the previous process will not be replied to
+	RequeueBGEOCommandletWorkerImports(InWorker);
+
+	// Start the bgeo commandlet
+	static const FString BGEOCommandletName = TEXT("HoudiniGeoImport");
+	InWorker.Guid = FGuid::NewGuid();
+	InWorker.Address.Invalidate();
+
+	// Get the absolute path to the project file, if known, otherwise get
+	// the project name. For the path: quote it for the command line.
+	IFileManager& FileManager = IFileManager::Get();
+	FString ProjectPathOrName = FApp::GetProjectName();
+	if (FPaths::IsProjectFilePathSet())
+	{
+		const FString ProjectPath = FPaths::GetProjectFilePath();
+		if (!ProjectPath.IsEmpty())
 		{
-			return false;
+			ProjectPathOrName = FString::Printf(
+                TEXT("\"%s\""),
+                *FileManager.ConvertToAbsolutePathForExternalAppForRead(*ProjectPath)
+            );
 		}
 	}
 
+	if (ProjectPathOrName.IsEmpty())
+		return false;
+
+	// Get the executable path for the app/editor
+	FString ExePath = FPlatformProcess::GenerateApplicationPath(FApp::GetName(), FApp::GetBuildConfiguration());
+	if (!ExePath.IsEmpty())
+		ExePath = FileManager.ConvertToAbsolutePathForExternalAppForRead(*ExePath);
+
+	if (ExePath.IsEmpty())
+		return false;
+	
+	const FString CommandLineParameters = FString::Printf(
+		TEXT("%s -messaging -run=%s -guid=%s -listen=%s -managerpid=%d"),
+		*ProjectPathOrName,
+		*BGEOCommandletName,
+		*InWorker.Guid.ToString(),
+		*BGEOCommandletEndpoint->GetAddress().ToString(),
+		FPlatformProcess::GetCurrentProcessId());
+
+	InWorker.ProcHandle = FPlatformProcess::CreateProc(
+		*ExePath,
+		*CommandLineParameters,
+		false,
+		true,
+		false,
+		&InWorker.ProcessId,
+		0,
+		NULL,
+		NULL);
+	if (!InWorker.ProcHandle.IsValid())
+	{
+		return false;
+	}
+
 	return true;
 }
 
 void FHoudiniPDGManager::StopBGEOCommandletAndEndpoint()
 {
 	BGEOCommandletEndpoint.Reset();
-	BGEOCommandletAddress.Invalidate();
-	BGEOCommandletGuid.Invalidate();
 
-	if (BGEOCommandletProcHandle.IsValid() && FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
 	{
-		FPlatformProcess::TerminateProc(BGEOCommandletProcHandle, true);
-		if (BGEOCommandletProcHandle.IsValid())
+		RequeueBGEOCommandletWorkerImports(Worker);
+		Worker.Address.Invalidate();
+		Worker.Guid.Invalidate();
+
+		if (Worker.ProcHandle.IsValid() && FPlatformProcess::IsProcRunning(Worker.ProcHandle))
 		{
-			FPlatformProcess::WaitForProc(BGEOCommandletProcHandle);
-			FPlatformProcess::CloseProc(BGEOCommandletProcHandle);
+			FPlatformProcess::TerminateProc(Worker.ProcHandle, true);
+			if (Worker.ProcHandle.IsValid())
+			{
+				FPlatformProcess::WaitForProc(Worker.ProcHandle);
+				FPlatformProcess::CloseProc(Worker.ProcHandle);
+			}
 		}
 	}
 }
 
 EHoudiniBGEOCommandletStatus FHoudiniPDGManager::UpdateAndGetBGEOCommandletStatus()
 {
-	if (BGEOCommandletProcHandle.IsValid())
+	bool bAnyConnected = false;
+	bool bAnyRunning = false;
+	bool bAnyCrashed = false;
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
 	{
-		if (!FPlatformProcess::IsProcRunning(BGEOCommandletProcHandle))
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Crashed;
-		else if (BGEOCommandletAddress.IsValid())
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Connected;
+		if (Worker.ProcHandle.IsValid())
+		{
+			if (!FPlatformProcess::IsProcRunning(Worker.ProcHandle))
+			{
+				if (Worker.Status != EHoudiniBGEOCommandletStatus::Crashed)
+					HOUDINI_LOG_WARNING(TEXT("BGEO commandlet (PID %d) stopped running, re-dispatching its imports."), Worker.ProcessId);
+
+				// Retry the worker's imports on the other workers
+				Worker.Status = EHoudiniBGEOCommandletStatus::Crashed;
+				Worker.Address.Invalidate();
+				RequeueBGEOCommandletWorkerImports(Worker);
+			}
+			else if (Worker.Address.IsValid())
+				Worker.Status = EHoudiniBGEOCommandletStatus::Connected;
+			else
+				Worker.Status = EHoudiniBGEOCommandletStatus::Running;
+		}
 		else
-			BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Running;
+			Worker.Status = EHoudiniBGEOCommandletStatus::NotStarted;
+
+		bAnyConnected |= Worker.Status == EHoudiniBGEOCommandletStatus::Connected;
+		bAnyRunning |= Worker.Status == EHoudiniBGEOCommandletStatus::Running;
+		bAnyCrashed |= Worker.Status == EHoudiniBGEOCommandletStatus::Crashed;
 	}
+
+	if (bAnyConnected)
+		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Connected;
+	else if (bAnyRunning)
+		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Running;
+	else if (bAnyCrashed)
+		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::Crashed;
 	else
 		BGEOCommandletStatus = EHoudiniBGEOCommandletStatus::NotStarted;
 
 	return BGEOCommandletStatus;
 }
 
+FHoudiniBGEOCommandletWorker*
+FHoudiniPDGManager::GetLeastLoadedBGEOCommandletWorker(const int32& InMaxImportsInFlight)
+{
+	FHoudiniBGEOCommandletWorker* LeastLoadedWorker = nullptr;
+	for (FHoudiniBGEOCommandletWorker& Worker : BGEOCommandletWorkers)
+	{
+		if (Worker.Status != EHoudiniBGEOCommandletStatus::Connected || !Worker.Address.IsValid())
+			continue;
+
+		if (Worker.ImportsInFlight.Num() >= InMaxImportsInFlight)
+			continue;
+
+		if (!LeastLoadedWorker || Worker.ImportsInFlight.Num() < LeastLoadedWorker->ImportsInFlight.Num())
+			LeastLoadedWorker = &Worker;
+	}
+
+	return LeastLoadedWorker;
+}
+
+void
+FHoudiniPDGManager::RequeueBGEOCommandletWorkerImports(FHoudiniBGEOCommandletWorker& InWorker)
+{
+	for (const FHoudiniBGEOImportRequest& Request : InWorker.ImportsInFlight)
+	{
+		UHoudiniPDGAssetLink* AssetLink = nullptr;
+		UTOPNetwork* TOPNetwork = nullptr;
+		UTOPNode* TOPNode = nullptr;
+		if (!GetTOPAssetLinkNetworkAndNode(Request.TOPNodeId, AssetLink, TOPNetwork, TOPNode) || !IsValid(TOPNode))
+			continue;
+
+		const int32 WorkResultArrayIndex = TOPNode->ArrayIndexOfWorkResultByID(Request.WorkItemId);
+		FTOPWorkResult* WorkResult = WorkResultArrayIndex != INDEX_NONE ? TOPNode->GetWorkResultByArrayIndex(WorkResultArrayIndex) : nullptr;
+		if (!WorkResult)
+			continue;
+
+		// The next ProcessWorkItemResults will send it to another worker
+		FTOPWorkResultObject* WorkResultObject = WorkResult->GetWorkResultObjectByName(Request.Name);
+		if (WorkResultObject && WorkResultObject->State == EPDGWorkResultState::Loading)
+		{
+			WorkResultObject->State = EPDGWorkResultState::ToLoad;
+			TOPNode->bCachedHaveNotLoadedWorkResults = true;
+		}
+	}
+
+	InWorker.ImportsInFlight.Empty();
+}
 
 bool
 FHoudiniPDGManager::IsPDGAsset(const HAPI_NodeId& InAssetId)
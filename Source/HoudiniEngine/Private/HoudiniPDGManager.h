@@ -29,6 +29,7 @@
 #include "HAPI/HAPI_Common.h"
 
 #include "HAL/PlatformProcess.h"
+#include "Templates/UniquePtr.h"
 
 #include "MessageEndpoint.h"
 
@@ -37,6 +38,7 @@ class UHoudiniPDGAssetLink;
 class UTOPNetwork;
 class UTOPNode;
 class FSocket;
+class FHoudiniPDGEventPump;
 
 enum class EPDGNodeState : uint8;
 
@@ -55,6 +57,27 @@ enum class HOUDINIENGINE_API EHoudiniBGEOCommandletStatus : uint8
 	Crashed
 };
 
+// A work result object sent to a BGEO commandlet for import
+struct FHoudiniBGEOImportRequest
+{
+	int32 TOPNodeId = -1;
+	int32 WorkItemId = -1;
+	FString Name;
+};
+
+// A BGEO commandlet process of the import pool
+struct FHoudiniBGEOCommandletWorker
+{
+	FGuid Guid;
+	FMessageAddress Address;
+	FProcHandle ProcHandle;
+	uint32 ProcessId = 0;
+	// Keep track of the worker status
+	EHoudiniBGEOCommandletStatus Status = EHoudiniBGEOCommandletStatus::NotStarted;
+	// Import requests sent to the worker that haven't replied yet
+	TArray<FHoudiniBGEOImportRequest> ImportsInFlight;
+};
+
 struct HOUDINIENGINE_API FHoudiniPDGManager
 {
 
@@ -114,6 +137,10 @@ public:
 	// Update all registered PDG Asset links
 	void Update();
 
+	// Stops the PDG event pump thread and discards its pending events.
+	// Must be called before the session it polls is closed.
+	void StopPDGEventPump();
+
 	void ReinitializePDGContext();
 	
 	// Clear all of the specified work item's results from the specified TOP node. This destroys any loaded results
@@ -153,18 +180,33 @@ public:
 		const struct FHoudiniPDGImportBGEOResultMessage& InMessage, 
 		const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext);
 
-	// Create the bgeo commandlet endpoint and start the commandlet (if not already running).
+	// Create the bgeo commandlet endpoint and start the commandlet workers (if not already running).
 	bool CreateBGEOCommandletAndEndpoint();
 
 	void StopBGEOCommandletAndEndpoint();
 
-	// Updates and returns the BGEO commandlet status
+	// Updates and returns the BGEO commandlet status (Connected if any worker is connected)
 	EHoudiniBGEOCommandletStatus UpdateAndGetBGEOCommandletStatus();
 
 private:
 	
 	void UpdatePDGContexts();
 
+	// Starts or stops the PDG event pump thread as needed, and lets it know if a cook is active
+	void UpdatePDGEventPump();
+
+	// Returns true if any TOP node of the registered PDG asset links is cooking
+	bool IsAnyTOPNodeCooking() const;
+
+	// Starts the process of a commandlet worker
+	bool StartBGEOCommandletWorker(FHoudiniBGEOCommandletWorker& InWorker);
+
+	// Returns the connected worker with the fewest imports in flight, or null if they all have InMaxImportsInFlight
+	FHoudiniBGEOCommandletWorker* GetLeastLoadedBGEOCommandletWorker(const int32& InMaxImportsInFlight);
+
+	// Sets the work result objects that were sent to a dead worker back to ToLoad, so they are sent to another one
+	void RequeueBGEOCommandletWorkerImports(FHoudiniBGEOCommandletWorker& InWorker);
+
 	void ProcessWorkItemResults();
 
 	void ProcessPDGEvent(const HAPI_PDG_GraphContextId& InContextID, HAPI_PDG_EventInfo& EventInfo);
@@ -206,10 +248,11 @@ private:
 	int32 MaxNumberOPDGContexts = 20;
 
 	TSharedPtr<FMessageEndpoint, ESPMode::ThreadSafe> BGEOCommandletEndpoint;
-	FMessageAddress BGEOCommandletAddress;
-	FProcHandle BGEOCommandletProcHandle;
-	FGuid BGEOCommandletGuid;
-	uint32 BGEOCommandletProcessId;
+	// The pool of commandlet processes the BGEO imports are dispatched to
+	TArray<FHoudiniBGEOCommandletWorker> BGEOCommandletWorkers;
 	// Keep track of the BGEO commandlet status
 	EHoudiniBGEOCommandletStatus BGEOCommandletStatus;
+
+	// Polls the PDG events on a separate thread, when enabled
+	TUniquePtr<FHoudiniPDGEventPump> PDGEventPump;
 };
\ No newline at end of file
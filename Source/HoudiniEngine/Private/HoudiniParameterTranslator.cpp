@@ -387,6 +387,21 @@ FHoudiniParameterTranslator::BuildAllParameters(
 				FHoudiniEngine::Get().GetSession(), AssetLibraryId, TCHAR_TO_UTF8(*HoudiniAssetName), &ParmInfos[0], 0, ParmCount), false);
 	}
 
+	// Resolve all the parameters' name, label and help strings in one batch,
+	// so the per-parameter string conversions below are served by the string cache
+	{
+		TArray<HAPI_StringHandle> ParmStringHandles;
+		ParmStringHandles.Reserve(ParmCount * 4);
+		for (const HAPI_ParmInfo& CurrentParmInfo : ParmInfos)
+		{
+			ParmStringHandles.Add(CurrentParmInfo.nameSH);
+			ParmStringHandles.Add(CurrentParmInfo.labelSH);
+			ParmStringHandles.Add(CurrentParmInfo.helpSH);
+			ParmStringHandles.Add(CurrentParmInfo.typeInfoSH);
+		}
+		FHoudiniEngineString::ResolveStringHandles(ParmStringHandles);
+	}
+
 	// Create a name lookup cache for the current parameters
 	// Use an array has in some cases, multiple parameters can have the same name!
 	TMap<FString, TArray<UHoudiniParameter*>> CurrentParametersByName;
@@ -997,8 +997,7 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForData(
 	}
 
 	// Finally, commit the geo ...
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-		FHoudiniEngine::Get().GetSession(), CurveNodeId), false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(CurveNodeId), false);
 
 	// And cook it with refinement enabled
 	CookOptions.refineCurveToLinear = true;
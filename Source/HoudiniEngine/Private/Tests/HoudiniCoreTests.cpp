@@ -1,5 +1,8 @@
 ﻿#include "../HoudiniEngine.h"
+#include "../HoudiniHeightfieldConversion.h"
 #include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -10,4 +13,97 @@ bool HoudiniCoreTest::RunTest(const FString & Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniHeightfieldConversionBenchmark, "Houdini.Core.HeightfieldConversionBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+// Times the landscape <-> heightfield conversions at 1k/4k/8k and checks that they match the per-point conversion.
+bool HoudiniHeightfieldConversionBenchmark::RunTest(const FString & Parameters)
+{
+	const double ZCenterOffset = 32767;
+	const double ZSpacing = 512.0 / ((double)UINT16_MAX);
+	const double ZPositionOffset = 1.5;
+	const float FloatMin = -200.0f;
+	const double DigitZRange = 49152.0;
+	const double DigitCenterOffset = FMath::FloorToDouble(((double)UINT16_MAX - DigitZRange) / 2.0);
+	const double HeightZSpacing = DigitZRange / 400.0;
+
+	FRandomStream RandomStream(1234);
+	const int32 Sizes[] = { 1009, 4033, 8129 };
+	for (const int32 Size : Sizes)
+	{
+		const int32 XSize = Size;
+		const int32 YSize = Size + 16;
+		const int32 NumPoints = XSize * YSize;
+
+		TArray<uint16> Heights;
+		Heights.SetNumUninitialized(NumPoints);
+		for (int32 Idx = 0; Idx < NumPoints; Idx++)
+			Heights[Idx] = (uint16)RandomStream.RandRange(0, UINT16_MAX);
+
+		// Unreal to Houdini
+		TArray<float> ReferenceValues;
+		ReferenceValues.SetNumUninitialized(NumPoints);
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 nY = 0; nY < XSize; nY++)
+		{
+			for (int32 nX = 0; nX < YSize; nX++)
+			{
+				double DoubleValue = ((double)Heights[nY + nX * XSize] - ZCenterOffset) * ZSpacing + ZPositionOffset;
+				ReferenceValues[nX + nY * YSize] = (float)DoubleValue;
+			}
+		}
+		const double ReferenceToHoudiniTime = FPlatformTime::Seconds() - StartTime;
+
+		TArray<float> Values;
+		Values.SetNumUninitialized(NumPoints);
+		StartTime = FPlatformTime::Seconds();
+		FHoudiniHeightfieldConversion::ConvertLandscapeHeightsToHeightfield(
+			Heights.GetData(), XSize, YSize, ZCenterOffset, ZSpacing, ZPositionOffset, Values.GetData());
+		const double ToHoudiniTime = FPlatformTime::Seconds() - StartTime;
+
+		TestTrue(FString::Printf(TEXT("%dx%d heights to heightfield are bit-identical"), XSize, YSize),
+			FMemory::Memcmp(Values.GetData(), ReferenceValues.GetData(), NumPoints * sizeof(float)) == 0);
+
+		// Houdini to Unreal, using the heightfield's sizes
+		const int32 HoudiniXSize = YSize;
+		const int32 HoudiniYSize = XSize;
+		TArray<uint16> ReferenceHeights;
+		ReferenceHeights.SetNumUninitialized(NumPoints);
+		StartTime = FPlatformTime::Seconds();
+		int32 nUnreal = 0;
+		for (int32 nY = 0; nY < HoudiniYSize; nY++)
+		{
+			for (int32 nX = 0; nX < HoudiniXSize; nX++)
+			{
+				double DoubleValue = (double)Values[nY + nX * HoudiniYSize] - (double)FloatMin;
+				DoubleValue = DoubleValue * HeightZSpacing + DigitCenterOffset;
+				const int32 IntValue = FMath::RoundToInt(DoubleValue);
+				ReferenceHeights[nUnreal++] = FMath::Clamp(IntValue, 0, FMath::RoundToInt(DigitZRange));
+			}
+		}
+		const double ReferenceToUnrealTime = FPlatformTime::Seconds() - StartTime;
+
+		TArray<uint16> ConvertedHeights;
+		ConvertedHeights.SetNumUninitialized(NumPoints);
+		bool bClippedMin = false;
+		bool bClippedMax = false;
+		StartTime = FPlatformTime::Seconds();
+		FHoudiniHeightfieldConversion::ConvertHeightfieldToLandscapeHeights(
+			Values.GetData(), HoudiniXSize, HoudiniYSize,
+			FloatMin, HeightZSpacing, DigitCenterOffset, DigitZRange,
+			false, 0, ConvertedHeights.GetData(), bClippedMin, bClippedMax);
+		const double ToUnrealTime = FPlatformTime::Seconds() - StartTime;
+
+		TestTrue(FString::Printf(TEXT("%dx%d heightfield to heights are bit-identical"), XSize, YSize),
+			FMemory::Memcmp(ConvertedHeights.GetData(), ReferenceHeights.GetData(), NumPoints * sizeof(uint16)) == 0);
+
+		AddInfo(FString::Printf(
+			TEXT("%dx%d: Unreal to Houdini %.2fms (per-point %.2fms), Houdini to Unreal %.2fms (per-point %.2fms)"),
+			XSize, YSize,
+			ToHoudiniTime * 1000.0, ReferenceToHoudiniTime * 1000.0,
+			ToUnrealTime * 1000.0, ReferenceToUnrealTime * 1000.0));
+	}
+
+	return true;
+}
+
 #endif
\ No newline at end of file
@@ -440,7 +440,7 @@ bool FUnrealBrushTranslator::CreateInputNodeForBrush(
 	}
 
 	// Commit the geo.
-	HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(FHoudiniEngine::Get().GetSession(), CreatedNodeId), false );
+	HOUDINI_CHECK_ERROR_RETURN( FHoudiniEngineUtils::HapiCommitGeo(CreatedNodeId), false );
 
 
 	return true;
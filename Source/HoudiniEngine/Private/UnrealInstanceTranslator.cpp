@@ -30,9 +30,13 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "UnrealMeshTranslator.h"
+#include "HoudiniInputGeometryCache.h"
 
 #include "Engine/StaticMesh.h"
 #include "Components/InstancedStaticMeshComponent.h"
+#include "GameFramework/Actor.h"
+#include "Materials/MaterialInterface.h"
+#include "Async/ParallelFor.h"
 
 bool
 FUnrealInstanceTranslator::HapiCreateInputNodeForInstancer(
@@ -53,15 +57,6 @@ FUnrealInstanceTranslator::HapiCreateInputNodeForInstancer(
 	if (!IsValid(SM))
 		return true;
 
-	// Marshall the Static Mesh to Houdini
-	int32 SMNodeId = -1;
-	FString ISMCName = InNodeName + TEXT("_") + ISMC->GetName();
-	bool bSuccess = FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
-		SM, SMNodeId, InNodeName, ISMC, bExportLODs, bExportSockets, bExportColliders);
-
-	if (!bSuccess)
-		return false;
-
 	// To create the instance properly (via packed prim), we need to:
 	// - create a copytopoints (with pack and instance enable
 	// - an inputnode containing all of the instances transform as points
@@ -79,6 +74,51 @@ FUnrealInstanceTranslator::HapiCreateInputNodeForInstancer(
 	// Get the copytopoints parent OBJ NodeID
 	HAPI_NodeId ParentNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(CopyNodeId);
 
+	// Instancers of the same mesh can share a single upload of it, unless the component adds data to the mesh:
+	// override materials and vertex colors, or component/actor tag groups.
+	// The actor and level paths are added to the instance points instead, and carried to the packed prims.
+	AActor* ParentActor = ISMC->GetOwner();
+	bool bShareMesh = FHoudiniInputGeometryCache::IsEnabled() && ParentNodeId >= 0;
+	if (ISMC->ComponentTags.Num() > 0 || (IsValid(ParentActor) && ParentActor->Tags.Num() > 0))
+		bShareMesh = false;
+
+	for (UMaterialInterface* OverrideMaterial : ISMC->OverrideMaterials)
+	{
+		if (IsValid(OverrideMaterial))
+		{
+			bShareMesh = false;
+			break;
+		}
+	}
+
+	for (int32 LODIdx = 0; bShareMesh && LODIdx < ISMC->LODData.Num(); LODIdx++)
+	{
+		if (ISMC->LODData[LODIdx].OverrideVertexColors)
+			bShareMesh = false;
+	}
+
+	// Marshall the Static Mesh to Houdini
+	int32 SMNodeId = -1;
+	bool bSuccess = false;
+	if (bShareMesh)
+	{
+		// Reference the session's shared node for that mesh from the copytopoints OBJ, it is released along with it
+		bSuccess = FHoudiniInputGeometryCache::AcquireStaticMeshInputNode(
+			SM, SMNodeId, TEXT("mesh"), bExportLODs, bExportSockets, bExportColliders, ParentNodeId);
+	}
+	else
+	{
+		bSuccess = FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
+			SM, SMNodeId, InNodeName, ISMC, bExportLODs, bExportSockets, bExportColliders);
+	}
+
+	if (!bSuccess)
+	{
+		// Clean up the copytopoints OBJ
+		FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), ParentNodeId >= 0 ? ParentNodeId : CopyNodeId);
+		return false;
+	}
+
 	// Now create an input node for the instance transforms
 	int32 InstancesNodeId = -1;
 	HOUDINI_CHECK_ERROR_RETURN( FHoudiniEngineUtils::CreateNode(
@@ -86,17 +126,21 @@ FUnrealInstanceTranslator::HapiCreateInputNodeForInstancer(
 
 	// MARSHALL THE INSTANCE TRANSFORM
 	{
-		// Get the instance transform and convert them to Position/Rotation/Scale array
+		// Get the instance transform and convert them to Position/Rotation/Scale array.
+		// The instances are read in bulk from the component's instance data, and converted on worker threads.
+		const TArray<FInstancedStaticMeshInstanceData>& InstanceData = ISMC->PerInstanceSMData;
+		InstanceCount = InstanceData.Num();
+
 		TArray<float> Positions;
-		Positions.SetNumZeroed(InstanceCount * 3);
+		Positions.SetNumUninitialized(InstanceCount * 3);
 		TArray<float> Rotations;
-		Rotations.SetNumZeroed(InstanceCount * 4);
+		Rotations.SetNumUninitialized(InstanceCount * 4);
 		TArray<float> Scales;
-		Scales.SetNumZeroed(InstanceCount * 3);
-		for (int32 InstanceIdx = 0; InstanceIdx < InstanceCount; InstanceIdx++)
+		Scales.SetNumUninitialized(InstanceCount * 3);
+		ParallelFor(InstanceCount, [&](int32 InstanceIdx)
 		{
-			FTransform CurTransform;
-			ISMC->GetInstanceTransform(InstanceIdx, CurTransform);
+			// Same as GetInstanceTransform(), in the component's space
+			const FTransform CurTransform(InstanceData[InstanceIdx].Transform);
 
 			// Convert Unreal Position to Houdini
 			FVector PositionVector = CurTransform.GetLocation();
@@ -116,7 +160,7 @@ FUnrealInstanceTranslator::HapiCreateInputNodeForInstancer(
 			Scales[InstanceIdx * 3 + 0] = ScaleVector.X;
 			Scales[InstanceIdx * 3 + 1] = ScaleVector.Z;
 			Scales[InstanceIdx * 3 + 2] = ScaleVector.Y;
-		}
+		});
 
 		// Create a part for the instance points.
 		HAPI_PartInfo Part;
@@ -192,9 +236,17 @@ FUnrealInstanceTranslator::HapiCreateInputNodeForInstancer(
 			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfoScale,
 			Scales.GetData(), 0, AttributeInfoScale.count), false);
 
+		if (bShareMesh && IsValid(ParentActor))
+		{
+			// The shared mesh doesn't have the component's actor and level paths, add them to the instances
+			FHoudiniEngineUtils::AddActorPathAttribute(
+				InstancesNodeId, 0, ParentActor, InstanceCount, HAPI_ATTROWNER_POINT);
+			FHoudiniEngineUtils::AddLevelPathAttribute(
+				InstancesNodeId, 0, ParentActor->GetLevel(), InstanceCount, HAPI_ATTROWNER_POINT);
+		}
+
 		// Commit the instance point geo.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-			FHoudiniEngine::Get().GetSession(), InstancesNodeId), false);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(InstancesNodeId), false);
 	}
 		
 	// Connect the mesh to the copytopoints node's second input
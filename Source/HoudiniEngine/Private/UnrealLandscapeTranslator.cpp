@@ -31,9 +31,11 @@
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniInputObject.h"
 
 #include "UnrealLandscapeTranslator.h"
 #include "HoudiniGeoPartObject.h"
+#include "HoudiniHeightfieldConversion.h"
 
 #include "Landscape.h"
 #include "LandscapeDataAccess.h"
@@ -259,8 +261,7 @@ FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
 	*/
 
 	// Commit the geo.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-		FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId), false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(DisplayGeoInfo.nodeId), false);
 
 	// TODO: Remove me!
 	/*
@@ -274,11 +275,17 @@ FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
 
 bool 
 FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
-	ALandscapeProxy* LandscapeProxy, HAPI_NodeId& CreatedHeightfieldNodeId, const FString& InputNodeNameStr) 
+	ALandscapeProxy* LandscapeProxy,
+	HAPI_NodeId& CreatedHeightfieldNodeId,
+	const FString& InputNodeNameStr,
+	UHoudiniInputLandscape* InInputLandscape)
 {
 	if (!LandscapeProxy)
 		return false;
 
+	// Volumes created for this heightfield, by name
+	TMap<FString, HAPI_NodeId> VolumeNodeIds;
+
 	// Export the whole landscape and its layer as a single heightfield.
 	FString NodeName = InputNodeNameStr + TEXT("_") + LandscapeProxy->GetName();
 
@@ -332,8 +339,9 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 	ApplyAttributesToHeightfieldNode(HeightId, PartId, LandscapeProxy);
 
 	// Commit the height volume
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-		FHoudiniEngine::Get().GetSession(), HeightId), false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(HeightId), false);
+
+	VolumeNodeIds.Add(TEXT("height"), HeightId);
 
 	//--------------------------------------------------------------------------------------------------
 	// 5. Extract and convert all the layers
@@ -343,7 +351,7 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		return false;
 
 	int32 MergeInputIndex = 2;
-	if (!ExtractAndConvertAllLandscapeLayers(LandscapeProxy, HeightFieldId, PartId, MergeId, MaskId, HeightfieldVolumeInfo, XSize, YSize, MergeInputIndex))
+	if (!ExtractAndConvertAllLandscapeLayers(LandscapeProxy, HeightFieldId, PartId, MergeId, MaskId, HeightfieldVolumeInfo, XSize, YSize, MergeInputIndex, &VolumeNodeIds))
 		return false;
 
 	auto MergeInputFn = [&MergeInputIndex] (const HAPI_NodeId MergeId, const HAPI_NodeId NodeId) -> HAPI_Result
@@ -472,11 +480,24 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 			ApplyAttributesToHeightfieldNode(LandscapeLayerNodeId, 0, LandscapeProxy);
 			
 			// Commit the volume's geo
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-			FHoudiniEngine::Get().GetSession(), LandscapeLayerNodeId), false);
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(LandscapeLayerNodeId), false);
+
+			VolumeNodeIds.Add(LayerVolumeName, LandscapeLayerNodeId);
 		}
 	}
 
+	// Keep track of what we've sent, so later edits only need to send their dirty regions
+	if (IsValid(InInputLandscape))
+	{
+		int32 MinX, MinY, MaxX, MaxY;
+		GetLandscapeExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY);
+
+		InInputLandscape->DirtyRegions.Empty();
+		InInputLandscape->UploadedVolumeNodeIds = VolumeNodeIds;
+		InInputLandscape->UploadedExtent = FIntRect(MinX, MinY, MaxX, MaxY);
+		InInputLandscape->UploadedLandscapeTransform = LandscapeTransform;
+	}
+
 	HAPI_TransformEuler HAPIObjectTransform;
 	FHoudiniApi::TransformEuler_Init(&HAPIObjectTransform);
 	//FMemory::Memzero< HAPI_TransformEuler >( HAPIObjectTransform );
@@ -506,6 +527,236 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 	return true;
 }
 
+bool
+FUnrealLandscapeTranslator::UpdateHeightfieldDirtyRegions(
+	ALandscapeProxy* LandscapeProxy, UHoudiniInputLandscape* InInputLandscape)
+{
+	if (!IsValid(LandscapeProxy) || !IsValid(InInputLandscape))
+		return false;
+
+	if (!InInputLandscape->CanUploadDirtyRegions())
+		return false;
+
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return false;
+
+	// The landscape's size and transform must match the uploaded heightfield,
+	// as they affect the volumes' resolution and the conversion of all the height values
+	int32 MinX, MinY, MaxX, MaxY;
+	if (!GetLandscapeExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY))
+		return false;
+
+	if (FIntRect(MinX, MinY, MaxX, MaxY) != InInputLandscape->UploadedExtent)
+		return false;
+
+	FTransform LandscapeTM = LandscapeProxy->LandscapeActorToWorld();
+	FTransform ProxyRelativeTM(FVector(LandscapeProxy->LandscapeSectionOffset));
+	FTransform LandscapeTransform = ProxyRelativeTM * LandscapeTM;
+	if (!LandscapeTransform.Equals(InInputLandscape->UploadedLandscapeTransform))
+		return false;
+
+	// The layers must also match the uploaded volumes
+	const TMap<FString, int32>& VolumeNodeIds = InInputLandscape->UploadedVolumeNodeIds;
+	int32 NumVolumes = 1;
+	if (!VolumeNodeIds.Contains(TEXT("height")))
+		return false;
+
+	for (const FLandscapeInfoLayerSettings& LayerSettings : LandscapeInfo->Layers)
+	{
+		if (!LayerSettings.LayerInfoObj)
+			continue;
+
+		FString LayerName = LayerSettings.GetLayerName().ToString();
+		if (FName(LayerName).Compare(ALandscape::VisibilityLayer->LayerName) == 0)
+			LayerName = HAPI_UNREAL_VISIBILITY_LAYER_NAME;
+
+		if (!VolumeNodeIds.Contains(LayerName))
+			return false;
+
+		NumVolumes++;
+	}
+
+	ALandscape* Landscape = LandscapeProxy->GetLandscapeActor();
+	if (IsValid(Landscape))
+	{
+		for (const FLandscapeLayer& Layer : Landscape->LandscapeLayers)
+		{
+			if (!VolumeNodeIds.Contains(FString::Format(TEXT("landscapelayer_{0}"), { Layer.Name.ToString() })))
+				return false;
+
+			NumVolumes++;
+		}
+	}
+
+	if (NumVolumes != VolumeNodeIds.Num())
+		return false;
+
+	for (const auto& VolumePair : VolumeNodeIds)
+	{
+		if (!FHoudiniEngineUtils::IsHoudiniNodeValid(VolumePair.Value))
+			return false;
+	}
+
+	// Merge the dirty regions in ranges of landscape X coordinates.
+	// Since the heightfield's layout is transposed, each of those ranges is a contiguous
+	// range of the volumes' values that can be sent with a single SetHeightFieldData call.
+	TArray<FIntPoint> DirtyRanges;
+	for (const FIntRect& Region : InInputLandscape->DirtyRegions)
+	{
+		if (Region.Max.Y < MinY || Region.Min.Y > MaxY)
+			continue;
+
+		int32 RangeMin = FMath::Max(Region.Min.X, MinX);
+		int32 RangeMax = FMath::Min(Region.Max.X, MaxX);
+		if (RangeMin > RangeMax)
+			continue;
+
+		// The conversion functions expect at least two rows
+		if (RangeMin == RangeMax)
+		{
+			if (RangeMax < MaxX)
+				RangeMax++;
+			else
+				RangeMin--;
+		}
+
+		DirtyRanges.Add(FIntPoint(RangeMin, RangeMax));
+	}
+
+	DirtyRanges.Sort([](const FIntPoint& A, const FIntPoint& B) { return A.X < B.X; });
+
+	TArray<FIntPoint> MergedRanges;
+	for (const FIntPoint& Range : DirtyRanges)
+	{
+		if (MergedRanges.Num() > 0 && Range.X <= MergedRanges.Last().Y + 1)
+			MergedRanges.Last().Y = FMath::Max(MergedRanges.Last().Y, Range.Y);
+		else
+			MergedRanges.Add(Range);
+	}
+
+	if (MergedRanges.Num() <= 0)
+	{
+		// None of the dirty regions are part of this heightfield
+		InInputLandscape->DirtyRegions.Empty();
+		return true;
+	}
+
+	HOUDINI_LANDSCAPE_MESSAGE(
+		TEXT("[FUnrealLandscapeTranslator::UpdateHeightfieldDirtyRegions] Sending %d dirty regions as %d ranges for %s"),
+		InInputLandscape->DirtyRegions.Num(), MergedRanges.Num(), *LandscapeProxy->GetName());
+
+	const int32 YSize = MaxY - MinY + 1;
+	const HAPI_PartId PartId = 0;
+
+	// Sends the heights of the dirty ranges to a height volume
+	auto UpdateHeightVolumeFn = [&](const HAPI_NodeId& VolumeNodeId, const FString& VolumeName)
+	{
+		for (const FIntPoint& Range : MergedRanges)
+		{
+			TArray<uint16> RangeHeightData;
+			int32 RangeXSize, RangeYSize;
+			if (!GetLandscapeData(LandscapeInfo, Range.X, MinY, Range.Y, MaxY, RangeHeightData, RangeXSize, RangeYSize))
+				return false;
+
+			// Min/Max only affect the volume info, which we don't update
+			TArray<float> RangeFloatValues;
+			HAPI_VolumeInfo RangeVolumeInfo;
+			FHoudiniApi::VolumeInfo_Init(&RangeVolumeInfo);
+			FVector CenterOffset;
+			if (!ConvertLandscapeDataToHeightfieldData(
+				RangeHeightData, RangeXSize, RangeYSize, FVector::ZeroVector, FVector::ZeroVector, LandscapeTransform,
+				RangeFloatValues, RangeVolumeInfo, CenterOffset))
+				return false;
+
+			if (!SetHeightfieldDataRange(VolumeNodeId, PartId, RangeFloatValues, (Range.X - MinX) * YSize, VolumeName))
+				return false;
+		}
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(VolumeNodeId), false);
+
+		return true;
+	};
+
+	//--------------------------------------------------------------------------------------------------
+	// 1. Update the height volume
+	//--------------------------------------------------------------------------------------------------
+	if (!UpdateHeightVolumeFn(VolumeNodeIds[TEXT("height")], TEXT("height")))
+		return false;
+
+	//--------------------------------------------------------------------------------------------------
+	// 2. Update the layers
+	//--------------------------------------------------------------------------------------------------
+	for (int32 n = 0; n < LandscapeInfo->Layers.Num(); n++)
+	{
+		if (!LandscapeInfo->Layers[n].LayerInfoObj)
+			continue;
+
+		// Layers that came from Houdini are normalized using their whole range of values (see
+		// ConvertLandscapeLayerDataToHeightfieldData), so they have to be sent entirely
+		const bool bSendWholeLayer = LandscapeInfo->Layers[n].LayerInfoObj->LayerUsageDebugColor.A == PI;
+
+		FString LayerName;
+		HAPI_NodeId LayerVolumeNodeId = -1;
+		for (const FIntPoint& Range : MergedRanges)
+		{
+			const int32 RangeMinX = bSendWholeLayer ? MinX : Range.X;
+			const int32 RangeMaxX = bSendWholeLayer ? MaxX : Range.Y;
+
+			TArray<uint8> RangeLayerData;
+			FLinearColor LayerUsageDebugColor;
+			if (!GetLandscapeLayerData(
+				LandscapeInfo, n, RangeMinX, MinY, RangeMaxX, MaxY,
+				RangeLayerData, LayerUsageDebugColor, LayerName))
+				return false;
+
+			if (FName(LayerName).Compare(ALandscape::VisibilityLayer->LayerName) == 0)
+				LayerName = HAPI_UNREAL_VISIBILITY_LAYER_NAME;
+
+			LayerVolumeNodeId = VolumeNodeIds[LayerName];
+
+			TArray<float> RangeFloatValues;
+			HAPI_VolumeInfo RangeVolumeInfo;
+			FHoudiniApi::VolumeInfo_Init(&RangeVolumeInfo);
+			if (!ConvertLandscapeLayerDataToHeightfieldData(
+				RangeLayerData, RangeMaxX - RangeMinX + 1, YSize, LayerUsageDebugColor,
+				RangeFloatValues, RangeVolumeInfo))
+				return false;
+
+			if (!SetHeightfieldDataRange(LayerVolumeNodeId, PartId, RangeFloatValues, (RangeMinX - MinX) * YSize, LayerName))
+				return false;
+
+			if (bSendWholeLayer)
+				break;
+		}
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(LayerVolumeNodeId), false);
+	}
+
+	//--------------------------------------------------------------------------------------------------
+	// 3. Update the editable landscape layers
+	//--------------------------------------------------------------------------------------------------
+	if (IsValid(Landscape))
+	{
+		for (const FLandscapeLayer& Layer : Landscape->LandscapeLayers)
+		{
+			const FString LayerVolumeName = FString::Format(TEXT("landscapelayer_{0}"), { Layer.Name.ToString() });
+
+			FScopedSetLandscapeEditingLayer Scope(Landscape, Layer.Guid); // Scope landscape access to the current layer
+			if (!UpdateHeightVolumeFn(VolumeNodeIds[LayerVolumeName], LayerVolumeName))
+				return false;
+		}
+	}
+
+	// Finally, cook the Heightfield node
+	if (!FHoudiniEngineUtils::HapiCookNode(InInputLandscape->InputNodeId, nullptr, true))
+		return false;
+
+	InInputLandscape->DirtyRegions.Empty();
+
+	return true;
+}
+
 bool FUnrealLandscapeTranslator::CreateHeightfieldFromLandscapeComponentArray(ALandscapeProxy* LandscapeProxy,
 	const TSet<ULandscapeComponent*>& SelectedComponents, HAPI_NodeId& CreatedHeightfieldNodeId,
 	const FString& InputNodeNameStr)
@@ -684,8 +935,7 @@ bool FUnrealLandscapeTranslator::CreateHeightfieldFromLandscapeComponent(ALandsc
 	ApplyAttributesToHeightfieldNode(HeightId, PartId, LandscapeProxy);
 	
 	// Commit the height volume
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-	    FHoudiniEngine::Get().GetSession(), HeightId), false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(HeightId), false);
 
 	//--------------------------------------------------------------------------------------------------
 	// 5. Extract and convert all the layers to HF masks
@@ -824,20 +1074,11 @@ FUnrealLandscapeTranslator::ConvertLandscapeLayerDataToHeightfieldData(
 	// Convert the Int data to Float
 	LayerFloatValues.SetNumUninitialized(SizeInPoints);
 
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
-	{
-		for (int32 nX = 0; nX < HoudiniXSize; nX++)
-		{
-			// We need to invert X/Y when reading the value from Unreal
-			int32 nHoudini = nX + nY * HoudiniXSize;
-			int32 nUnreal = nY + nX * XSize;
-
-			// Convert the int values to meter
-			// Unreal's digit value have a zero value of 32768
-			double DoubleValue = ((double)IntHeightData[nUnreal] - (double)IntMin) * LayerSpacing + LayerMin;
-			LayerFloatValues[nHoudini] = (float)DoubleValue;
-		}
-	}
+	// We need to invert X/Y when reading the value from Unreal
+	FHoudiniHeightfieldConversion::ConvertLandscapeLayerToHeightfield(
+		IntHeightData.GetData(), XSize, YSize,
+		(double)IntMin, (double)LayerSpacing, (double)LayerMin,
+		LayerFloatValues.GetData());
 
 	/*
 	// Verifying the converted ZMin / ZMax
@@ -877,12 +1118,16 @@ FUnrealLandscapeTranslator::ConvertLandscapeLayerDataToHeightfieldData(
 }
 
 bool
-FUnrealLandscapeTranslator::GetLandscapeData(
+FUnrealLandscapeTranslator::GetLandscapeExtent(
 	ALandscapeProxy* LandscapeProxy,
-	TArray<uint16>& HeightData,
-	int32& XSize, int32& YSize,
-	FVector& Min, FVector& Max)
+	int32& MinX, int32& MinY,
+	int32& MaxX, int32& MaxY)
 {
+	MinX = MAX_int32;
+	MinY = MAX_int32;
+	MaxX = -MAX_int32;
+	MaxY = -MAX_int32;
+
 	if (!LandscapeProxy)
 		return false;
 
@@ -890,12 +1135,6 @@ FUnrealLandscapeTranslator::GetLandscapeData(
 	if (!LandscapeInfo)
 		return false;
 
-	// Get the landscape extents to get its size
-	int32 MinX = MAX_int32;
-	int32 MinY = MAX_int32;
-	int32 MaxX = -MAX_int32;
-	int32 MaxY = -MAX_int32;
-	
 	ALandscape* Landscape = LandscapeProxy->GetLandscapeActor();
 	if (LandscapeProxy == Landscape)
 	{
@@ -914,6 +1153,30 @@ FUnrealLandscapeTranslator::GetLandscapeData(
 		}
 	}
 
+	if (MinX == MAX_int32 || MinY == MAX_int32 || MaxX == -MAX_int32 || MaxY == -MAX_int32)
+		return false;
+
+	return true;
+}
+
+bool
+FUnrealLandscapeTranslator::GetLandscapeData(
+	ALandscapeProxy* LandscapeProxy,
+	TArray<uint16>& HeightData,
+	int32& XSize, int32& YSize,
+	FVector& Min, FVector& Max)
+{
+	if (!LandscapeProxy)
+		return false;
+
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return false;
+
+	// Get the landscape extents to get its size
+	int32 MinX, MinY, MaxX, MaxY;
+	GetLandscapeExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY);
+
 	if (!GetLandscapeData(LandscapeInfo, MinX, MinY, MaxX, MaxY, HeightData, XSize, YSize))
 		return false;
 
@@ -1062,20 +1325,12 @@ FUnrealLandscapeTranslator::ConvertLandscapeDataToHeightfieldData(
 	// Convert the Int data to Float
 	HeightfieldFloatValues.SetNumUninitialized(SizeInPoints);
 
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
-	{
-		for (int32 nX = 0; nX < HoudiniXSize; nX++)
-		{
-			// We need to invert X/Y when reading the value from Unreal
-			int32 nHoudini = nX + nY * HoudiniXSize;
-			int32 nUnreal = nY + nX * XSize;
-
-			// Convert the int values to meter
-			// Unreal's digit value have a zero value of 32768
-			double DoubleValue = ((double)IntHeightData[nUnreal] - ZCenterOffset) * ZSpacing + ZPositionOffset;
-			HeightfieldFloatValues[nHoudini] = (float)DoubleValue;
-		}
-	}
+	// We need to invert X/Y when reading the value from Unreal
+	// Unreal's digit value have a zero value of 32768
+	FHoudiniHeightfieldConversion::ConvertLandscapeHeightsToHeightfield(
+		IntHeightData.GetData(), XSize, YSize,
+		ZCenterOffset, ZSpacing, ZPositionOffset,
+		HeightfieldFloatValues.GetData());
 
 	//--------------------------------------------------------------------------------------------------
 	// 2. Convert the Unreal Transform to a HAPI_transform
@@ -1232,6 +1487,32 @@ FUnrealLandscapeTranslator::SetHeightfieldData(
 	return true;
 }
 
+bool
+FUnrealLandscapeTranslator::SetHeightfieldDataRange(
+	const HAPI_NodeId& VolumeNodeId,
+	const HAPI_PartId& PartId,
+	const TArray<float>& FloatValues,
+	const int32& Start,
+	const FString& HeightfieldName)
+{
+	// The volume already exists and has its volume info set, so we only need to replace its values
+	HAPI_GeoInfo GeoInfo;
+	FHoudiniApi::GeoInfo_Init(&GeoInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetGeoInfo(
+		FHoudiniEngine::Get().GetSession(),
+		VolumeNodeId, &GeoInfo), false);
+
+	// Volume name
+	std::string NameStr;
+	FHoudiniEngineUtils::ConvertUnrealString(HeightfieldName, NameStr);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetHeightFieldData(
+		FHoudiniEngine::Get().GetSession(),
+		GeoInfo.nodeId, PartId, NameStr.c_str(), FloatValues.GetData(), Start, FloatValues.Num()), false);
+
+	return true;
+}
+
 bool FUnrealLandscapeTranslator::AddLandscapeMaterialAttributesToVolume(
 	const HAPI_NodeId& VolumeNodeId, 
 	const HAPI_PartId& PartId,
@@ -1460,30 +1741,8 @@ FUnrealLandscapeTranslator::GetLandscapeLayerData(
 		return false;
 
 	// Get the landscape X/Y Size
-	int32 MinX = MAX_int32;
-	int32 MinY = MAX_int32;
-	int32 MaxX = -MAX_int32;
-	int32 MaxY = -MAX_int32;
-
-	ALandscape* Landscape = LandscapeProxy->GetLandscapeActor();
-	if (LandscapeProxy == Landscape)
-	{
-		// The proxy is a landscape actor, so we have to use the landscape extent (landscape components
-		// may have been moved to proxies and may not be present on this actor).
-		LandscapeInfo->GetLandscapeExtent(MinX, MinY, MaxX, MaxY);
-	}
-	else
-	{
-		// We only want to get the data for this landscape proxy.
-		// To handle streaming proxies correctly, get the extents via all the components,
-		// not by calling GetLandscapeExtent or we'll end up sending ALL the streaming proxies.
-		for (const ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
-		{
-			Comp->GetComponentExtent(MinX, MinY, MaxX, MaxY);
-		}
-	}
-
-	if(MinX == MAX_int32 || MinY == MAX_int32 || MaxX == -MAX_int32 || MaxY == -MAX_int32)
+	int32 MinX, MinY, MaxX, MaxY;
+	if (!GetLandscapeExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY))
 		return false;
 
 	if (!GetLandscapeLayerData(
@@ -2350,7 +2609,8 @@ bool FUnrealLandscapeTranslator::ExtractAndConvertAllLandscapeLayers(
 	const HAPI_VolumeInfo& HeightfieldVolumeInfo,
 	const int32 & XSize,
 	const int32 & YSize,
-	int32 & OutMergeInputIndex)
+	int32 & OutMergeInputIndex,
+	TMap<FString, HAPI_NodeId>* OutLayerVolumeNodeIds)
 {
 
 	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
@@ -2440,8 +2700,10 @@ bool FUnrealLandscapeTranslator::ExtractAndConvertAllLandscapeLayers(
 		ApplyAttributesToHeightfieldNode(LayerVolumeNodeId, PartId, LandscapeProxy);
 
 		// Commit the volume's geo
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-			FHoudiniEngine::Get().GetSession(), LayerVolumeNodeId), false);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(LayerVolumeNodeId), false);
+
+		if (OutLayerVolumeNodeIds)
+			OutLayerVolumeNodeIds->Add(LayerName, LayerVolumeNodeId);
 
 		if (!IsMask)
 		{
@@ -2464,8 +2726,7 @@ bool FUnrealLandscapeTranslator::ExtractAndConvertAllLandscapeLayers(
 		ApplyAttributesToHeightfieldNode(MaskId, PartId, LandscapeProxy);
 
 		// Commit the mask volume's geo
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-			FHoudiniEngine::Get().GetSession(), MaskId), false);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(MaskId), false);
 	}
 
 	return true;
@@ -39,10 +39,19 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 		// ------------------------------------------------------------------------------------------
 		// Unreal Landscape to Houdini Heightfield
 		// ------------------------------------------------------------------------------------------
+		// If InInputLandscape is provided, the created volumes are recorded on it
+		// so that later edits can be sent via UpdateHeightfieldDirtyRegions
 		static bool CreateHeightfieldFromLandscape(
 			ALandscapeProxy* LandcapeProxy, 
 			HAPI_NodeId& CreatedHeightfieldNodeId,
-			const FString &InputNodeNameStr);
+			const FString &InputNodeNameStr,
+			UHoudiniInputLandscape* InInputLandscape = nullptr);
+
+		// Only sends the dirty regions of the landscape to the volumes of an existing heightfield.
+		// Returns false if the heightfield needs to be fully recreated instead.
+		static bool UpdateHeightfieldDirtyRegions(
+			ALandscapeProxy* LandscapeProxy,
+			UHoudiniInputLandscape* InInputLandscape);
 
 		static bool CreateHeightfieldFromLandscapeComponentArray(
 			ALandscapeProxy* LandscapeProxy,
@@ -84,6 +93,12 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			ALandscapeProxy* LandscapeProxy
 			);
 
+		// Get the extent (in landscape vertex coordinates) of the data exported for a landscape proxy
+		static bool GetLandscapeExtent(
+			ALandscapeProxy* LandscapeProxy,
+			int32& MinX, int32& MinY,
+			int32& MaxX, int32& MaxY);
+
 		// Extracts the uint16 values of a given landscape
 		static bool GetLandscapeData(
 			ALandscapeProxy* LandscapeProxy,
@@ -142,6 +157,14 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			const HAPI_VolumeInfo& VolumeInfo,
 			const FString& HeightfieldName);
 
+		// Set a range of the volume float values of an existing heightfield volume
+		static bool SetHeightfieldDataRange(
+			const HAPI_NodeId& VolumeNodeId,
+			const HAPI_PartId& PartId,
+			const TArray<float>& FloatValues,
+			const int32& Start,
+			const FString& HeightfieldName);
+
 		static bool AddLandscapeMaterialAttributesToVolume(
 			const HAPI_NodeId& VolumeNodeId,
 			const HAPI_PartId& PartId,
@@ -284,6 +307,7 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			const HAPI_VolumeInfo& HeightfieldVolumeInfo,
 			const int32 & XSize,
 			const int32 & YSize,
-			int32 & OutMergeInputIndex);
+			int32 & OutMergeInputIndex,
+			TMap<FString, HAPI_NodeId>* OutLayerVolumeNodeIds = nullptr);
 
 };
\ No newline at end of file
@@ -29,6 +29,7 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniInputGeometryCache.h"
 
 #include "RawMesh.h"
 #include "MeshDescription.h"
@@ -41,6 +42,8 @@
 #include "Materials/MaterialInterface.h"
 #include "MeshAttributes.h"
 #include "StaticMeshAttributes.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
 
 #if WITH_EDITOR
 	#include "EditorFramework/AssetImportData.h"
@@ -131,6 +134,9 @@ FUnrealMeshTranslator::HapiCreateInputNodeForStaticMesh(
 		// Get the parent OBJ node ID before deleting!
 		HAPI_NodeId PreviousInputOBJNode = FHoudiniEngineUtils::HapiGetParentNodeId(PreviousInputNodeId);
 
+		// The previous node might have been referencing a shared static mesh node
+		FHoudiniInputGeometryCache::ReleaseNode(PreviousInputNodeId);
+
 		if (HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode(
 			FHoudiniEngine::Get().GetSession(), PreviousInputNodeId))
 		{
@@ -683,8 +689,7 @@ FUnrealMeshTranslator::CreateInputNodeForMeshSockets(
 		FreeMemoryReturn(false));
 
 	// Commit the geo.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-		FHoudiniEngine::Get().GetSession(), OutSocketsNodeId),
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(OutSocketsNodeId),
 		FreeMemoryReturn(false));
 
 	return FreeMemoryReturn(true);
@@ -1474,8 +1479,7 @@ FUnrealMeshTranslator::CreateInputNodeForRawMesh(
 	}
 
 	// Commit the geo.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-		FHoudiniEngine::Get().GetSession(), NodeId), false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(NodeId), false);
 
 	return true;
 }
@@ -1492,66 +1496,21 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 {
 	// Convert the Mesh using FStaticMeshLODResources
 
-	// Check that the mesh is not empty
-	if (LODResources.VertexBuffers.StaticMeshVertexBuffer.GetNumVertices() == 0)
-	{
-		HOUDINI_LOG_ERROR(TEXT("No vertices in mesh!"));
-		return false;
-	}
+	// Use the data that was extracted ahead on a worker thread if any, extract it now otherwise
+	FUnrealMeshLODResourcesData LODData;
+	if (!ConsumePrefetchedStaticMeshLODResources(StaticMesh, StaticMeshComponent, InLODIndex, LODData))
+		ExtractStaticMeshLODResources(LODResources, InLODIndex, StaticMesh, StaticMeshComponent, LODData);
 
-	if (LODResources.Sections.Num() == 0)
-	{
-		HOUDINI_LOG_ERROR(TEXT("No triangles in mesh!"));
+	if (!LODData.bIsValid)
 		return false;
-	}
 
-	// Vertex instance and triangle counts
-	const uint32 OrigNumVertexInstances = LODResources.VertexBuffers.StaticMeshVertexBuffer.GetNumVertices();
-	const uint32 NumTriangles = LODResources.GetNumTriangles();
-	const uint32 NumVertexInstances = NumTriangles * 3;
-	const uint32 NumSections = LODResources.Sections.Num();
+	const uint32 NumVertices = LODData.NumVertices;
+	const uint32 NumVertexInstances = LODData.NumVertexInstances;
+	const uint32 NumTriangles = LODData.NumTriangles;
+	const TArray<float>& StaticMeshVertices = LODData.Positions;
 
 	// Grab the build scale
 	const FStaticMeshSourceModel &SourceModel = StaticMesh->GetSourceModel(InLODIndex);
-	FVector BuildScaleVector = SourceModel.BuildSettings.BuildScale3D;
-
-	//--------------------------------------------------------------------------------------------------------------------- 
-	// POSITION (P)
-	//--------------------------------------------------------------------------------------------------------------------- 
-	// In FStaticMeshLODResources each vertex instances stores its position, even if the positions are not unique (in other
-	// words, in Houdini terminology, the number of points and vertices are the same. We'll do the same thing that Epic
-	// does in FBX export: we'll run through all vertex instances and use a hash to determine which instances share a 
-	// position, so that we can a smaller number of points than vertices, and vertices share point positions
-	TArray<int32> UEVertexInstanceIdxToPointIdx;
-	UEVertexInstanceIdxToPointIdx.Reserve(OrigNumVertexInstances);
-
-	TMap<FVector, int32> PositionToPointIndexMap;
-	PositionToPointIndexMap.Reserve(OrigNumVertexInstances);
-
-	TArray<float> StaticMeshVertices;
-	StaticMeshVertices.Reserve(OrigNumVertexInstances * 3);
-	for (uint32 VertexInstanceIndex = 0; VertexInstanceIndex < OrigNumVertexInstances; ++VertexInstanceIndex)
-	{
-		// Convert Unreal to Houdini
-		const FVector &PositionVector = LODResources.VertexBuffers.PositionVertexBuffer.VertexPosition(VertexInstanceIndex);
-		const int32 *FoundPointIndexPtr = PositionToPointIndexMap.Find(PositionVector);
-		if (!FoundPointIndexPtr)
-		{
-			const int32 NewPointIndex = StaticMeshVertices.Add(PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.X) / 3;
-			StaticMeshVertices.Add(PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Z);
-			StaticMeshVertices.Add(PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Y);
-
-			PositionToPointIndexMap.Add(PositionVector, NewPointIndex);
-			UEVertexInstanceIdxToPointIdx.Add(NewPointIndex);
-		}
-		else
-		{
-			UEVertexInstanceIdxToPointIdx.Add(*FoundPointIndexPtr);
-		}
-	}
-
-	StaticMeshVertices.Shrink();
-	const uint32 NumVertices = StaticMeshVertices.Num() / 3;
 
 	// Now that we know how many vertices (points), vertex instances (vertices) and triagnles we have,
 	// we can create the part.
@@ -1594,377 +1553,134 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		StaticMeshVertices.GetData(), 0, AttributeInfoPoint.count), false);
 
 	// Determine which attributes we have
-	const bool bIsVertexInstanceNormalsValid = true;
-	const bool bIsVertexInstanceTangentsValid = true;
-	const bool bIsVertexInstanceBinormalsValid = true;
-	const bool bIsVertexInstanceColorsValid = LODResources.bHasColorVertexData;
-	const uint32 NumUVLayers = FMath::Min<uint32>(LODResources.VertexBuffers.StaticMeshVertexBuffer.GetNumTexCoords(), MAX_STATIC_TEXCOORDS);
+	const bool bIsVertexInstanceNormalsValid = LODData.Normals.Num() > 0;
+	const bool bIsVertexInstanceTangentsValid = LODData.Tangents.Num() > 0;
+	const bool bIsVertexInstanceBinormalsValid = LODData.Binormals.Num() > 0;
+	const bool bHasColors = LODData.bHasColors;
+	const uint32 NumUVLayers = LODData.NumUVLayers;
 	const bool bIsVertexInstanceUVsValid = NumUVLayers > 0;
 
-	bool bUseComponentOverrideColors = false;
-	// Determine if have override colors on the static mesh component, if so prefer to use those
-	if (StaticMeshComponent &&
-		StaticMeshComponent->LODData.IsValidIndex(InLODIndex) &&
-		StaticMeshComponent->LODData[InLODIndex].OverrideVertexColors)
-	{
-		FStaticMeshComponentLODInfo& ComponentLODInfo = StaticMeshComponent->LODData[InLODIndex];
-		FColorVertexBuffer& ColorVertexBuffer = *ComponentLODInfo.OverrideVertexColors;
-
-		if (ColorVertexBuffer.GetNumVertices() == LODResources.GetNumVertices())
-		{
-			bUseComponentOverrideColors = true;
-		}
-	}
-
-	//--------------------------------------------------------------------------------------------------------------------- 
-	// MATERIAL INDEX -> MATERIAL INTERFACE
-	//---------------------------------------------------------------------------------------------------------------------
-	TArray<UMaterialInterface*> MaterialInterfaces;
-	TArray<int32> TriangleMaterialIndices;
-
-	const TArray<FStaticMaterial>& StaticMaterials = StaticMesh->GetStaticMaterials();
+	const TArray<UMaterialInterface*>& MaterialInterfaces = LODData.MaterialInterfaces;
+	const TArray<int32>& TriangleMaterialIndices = LODData.TriangleMaterialIndices;
+	const int32 NumMaterials = MaterialInterfaces.Num();
 
-	// If the static mesh component is valid, get the materials via the component to account for overrides
-	const bool bIsStaticMeshComponentValid = (IsValid(StaticMeshComponent) && StaticMeshComponent->IsValidLowLevel());
-	const int32 NumStaticMaterials = StaticMaterials.Num();
-	// If we find any invalid Material (null or pending kill), or we find a section below with an out of range MaterialIndex,
-	// then we will set UEDefaultMaterial at the invalid index
-	int32 UEDefaultMaterialIndex = INDEX_NONE;
-	UMaterialInterface *UEDefaultMaterial = nullptr;
-	if (NumStaticMaterials > 0)
+	// Now we deal with vertex instance attributes.
+	if (NumTriangles > 0)
 	{
-		MaterialInterfaces.Reserve(NumStaticMaterials);
-		for (int32 MaterialIndex = 0; MaterialIndex < NumStaticMaterials; ++MaterialIndex)
-		{
-			const FStaticMaterial &MaterialInfo = StaticMaterials[MaterialIndex];
-			UMaterialInterface *Material = nullptr;
-			if (bIsStaticMeshComponentValid)
-			{
-				Material = StaticMeshComponent->GetMaterial(MaterialIndex);
-			}
-			else
-			{
-				Material = MaterialInfo.MaterialInterface;
-			}
-			// If the Material is NULL or invalid, fallback to the default material
-			if (!IsValid(Material))
-			{
-				if (!UEDefaultMaterial)
-				{
-					UEDefaultMaterial = UMaterial::GetDefaultMaterial(EMaterialDomain::MD_Surface);
-					UEDefaultMaterialIndex = MaterialIndex;
-				}
-				Material = UEDefaultMaterial;
-				HOUDINI_LOG_WARNING(TEXT("Material Index %d (slot %s) has an invalid material, falling back to default: %s"), MaterialIndex, *(MaterialInfo.MaterialSlotName.ToString()), *(UEDefaultMaterial->GetPathName()));
-			}
-			// MaterialSlotToInterface.Add(MaterialInfo.ImportedMaterialSlotName, MaterialIndex);
-			MaterialInterfaces.Add(Material);
-		}
+		const TArray<TArray<float>>& UVs = LODData.UVs;
+		const TArray<float>& Normals = LODData.Normals;
+		const TArray<float>& Tangents = LODData.Tangents;
+		const TArray<float>& Binormals = LODData.Binormals;
+		const TArray<float>& RGBColors = LODData.RGBColors;
+		const TArray<float>& Alphas = LODData.Alphas;
+		const TArray<int32>& MeshTriangleVertexIndices = LODData.TriangleVertexIndices;
+		const TArray<int32>& MeshTriangleVertexCounts = LODData.TriangleVertexCounts;
 
-		TriangleMaterialIndices.Reserve(NumTriangles);
-	}
+		// Now transfer valid vertex instance attributes to Houdini vertex attributes
 
-	// If we haven't created UEDefaultMaterial yet, check that all the sections' MaterialIndex
-	// is valid, if not, create UEDefaultMaterial and add to MaterialInterfaces to get UEDefaultMaterialIndex
-	if (!UEDefaultMaterial || UEDefaultMaterialIndex == INDEX_NONE)
-	{
-		for (uint32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// UVS (uvX)
+		//--------------------------------------------------------------------------------------------------------------------- 
+		if (bIsVertexInstanceUVsValid)
 		{
-			// If the MaterialIndex referenced by this Section is out of range, fill MaterialInterfaces with UEDefaultMaterial
-			// up to and including MaterialIndex and log a warning
-			const int32 MaterialIndex = LODResources.Sections[SectionIndex].MaterialIndex;
-			if (!MaterialInterfaces.IsValidIndex(MaterialIndex))
+			for (uint32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; UVLayerIndex++)
 			{
-				if (!UEDefaultMaterial)
-				{
-					UEDefaultMaterial = UMaterial::GetDefaultMaterial(EMaterialDomain::MD_Surface);
-					// Add the UEDefaultMaterial to MaterialInterfaces
-					UEDefaultMaterialIndex = MaterialInterfaces.Add(UEDefaultMaterial);
-				}
-				HOUDINI_LOG_WARNING(TEXT("Section Index %d references an invalid Material Index %d, falling back to default material: %s"), SectionIndex, MaterialIndex, *(UEDefaultMaterial->GetPathName()));
-			}
-		}
-	}
+				// Construct the attribute name for this UV index.
+				FString UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
+				if (UVLayerIndex > 0)
+					UVAttributeName += FString::Printf(TEXT("%d"), UVLayerIndex + 1);
 
-	// Determine the final number of materials we have, with default for missing/invalid indices
-	const int32 NumMaterials = MaterialInterfaces.Num();
+				// Create attribute for UVs
+				HAPI_AttributeInfo AttributeInfoVertex;
+				FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
-	// Now we deal with vertex instance attributes. 
-	if (NumTriangles > 0)
-	{
-		// UV layer array. Each layer has an array of floats, 3 floats per vertex instance
-		TArray<TArray<float>> UVs;
-		// Normals: 3 floats per vertex instance
-		TArray<float> Normals;
-		// Tangents: 3 floats per vertex instance
-		TArray<float> Tangents;
-		// Binormals: 3 floats per vertex instance
-		TArray<float> Binormals;
-		// RGBColors: 3 floats per vertex instance
-		TArray<float> RGBColors;
-		// Alphas: 1 float per vertex instance
-		TArray<float> Alphas;
+				AttributeInfoVertex.count = NumVertexInstances;
+				AttributeInfoVertex.tupleSize = 3;
+				AttributeInfoVertex.exists = true;
+				AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
+				AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
+				AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-		// Initialize the arrays for the attributes that are valid
-		if (bIsVertexInstanceUVsValid)
-		{
-			UVs.SetNum(NumUVLayers);
-			for (uint32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; ++UVLayerIndex)
-			{
-				UVs[UVLayerIndex].SetNumUninitialized(NumVertexInstances * 3);
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+					FHoudiniEngine::Get().GetSession(),
+					NodeId, 0, TCHAR_TO_ANSI(*UVAttributeName), &AttributeInfoVertex), false);
+
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+					FHoudiniEngine::Get().GetSession(),
+					NodeId, 0, TCHAR_TO_ANSI(*UVAttributeName),
+					&AttributeInfoVertex, UVs[UVLayerIndex].GetData(),
+					0, AttributeInfoVertex.count), false);
 			}
 		}
 
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// NORMALS (N)
+		//---------------------------------------------------------------------------------------------------------------------
 		if (bIsVertexInstanceNormalsValid)
 		{
-			Normals.SetNumUninitialized(NumVertexInstances * 3);
+			// Create attribute for normals.
+			HAPI_AttributeInfo AttributeInfoVertex;
+			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
+
+			AttributeInfoVertex.tupleSize = 3;
+			AttributeInfoVertex.count = Normals.Num() / AttributeInfoVertex.tupleSize;
+			AttributeInfoVertex.exists = true;
+			AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
+			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
+			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
+
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+				FHoudiniEngine::Get().GetSession(),
+				NodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoVertex), false);
+
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+				FHoudiniEngine::Get().GetSession(),
+				NodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL,
+				&AttributeInfoVertex, Normals.GetData(),
+				0, AttributeInfoVertex.count), false);
 		}
 
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// TANGENT (tangentu)
+		//---------------------------------------------------------------------------------------------------------------------
 		if (bIsVertexInstanceTangentsValid)
 		{
-			Tangents.SetNumUninitialized(NumVertexInstances * 3);
+			// Create attribute for tangentu.
+			HAPI_AttributeInfo AttributeInfoVertex;
+			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
+
+			AttributeInfoVertex.tupleSize = 3;
+			AttributeInfoVertex.count = Tangents.Num() / AttributeInfoVertex.tupleSize;
+			AttributeInfoVertex.exists = true;
+			AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
+			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
+			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
+
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+				FHoudiniEngine::Get().GetSession(),
+				NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTU, &AttributeInfoVertex), false);
+
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+				FHoudiniEngine::Get().GetSession(),
+				NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTU, &AttributeInfoVertex,
+				Tangents.GetData(), 0, AttributeInfoVertex.count), false);
 		}
 
+		//--------------------------------------------------------------------------------------------------------------------- 
+		// BINORMAL (tangentv)
+		//---------------------------------------------------------------------------------------------------------------------
 		if (bIsVertexInstanceBinormalsValid)
 		{
-			Binormals.SetNumUninitialized(NumVertexInstances * 3);
-		}
+			// Create attribute for normals.
+			HAPI_AttributeInfo AttributeInfoVertex;
+			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
 
-		if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
-		{
-			RGBColors.SetNumUninitialized(NumVertexInstances * 3);
-			Alphas.SetNumUninitialized(NumVertexInstances);
-		}
-
-		// Array of vertex (point position) indices per triangle
-		TArray<int32> MeshTriangleVertexIndices;
-		MeshTriangleVertexIndices.SetNumUninitialized(NumVertexInstances);
-		// Array of vertex counts per triangle/face
-		TArray<int32> MeshTriangleVertexCounts;
-		MeshTriangleVertexCounts.SetNumUninitialized(NumTriangles);
-
-		int32 TriangleIdx = 0;
-		int32 HoudiniVertexIdx = 0;
-		FIndexArrayView TriangleVertexIndices = LODResources.IndexBuffer.GetArrayView();
-		for (uint32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
-		{
-			const FStaticMeshSection& Section = LODResources.Sections[SectionIndex];
-			for (uint32 SectionTriangleIndex = 0; SectionTriangleIndex < Section.NumTriangles; ++SectionTriangleIndex)
-			{
-				MeshTriangleVertexCounts[TriangleIdx] = 3;
-				for (int32 TriangleVertexIndex = 0; TriangleVertexIndex < 3; ++TriangleVertexIndex)
-				{
-					// Reverse the winding order for Houdini (but still start at 0)
-					const int32 WindingIdx = (3 - TriangleVertexIndex) % 3;
-					const uint32 UEVertexIndex = TriangleVertexIndices[Section.FirstIndex + SectionTriangleIndex * 3 + WindingIdx];
-
-					// Calculate the index of the first component of a vertex instance's value in an inline float array 
-					// representing vectors (3 float) per vertex instance
-					const int32 Float3Index = HoudiniVertexIdx * 3;
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// UVS (uvX)
-					//--------------------------------------------------------------------------------------------------------------------- 
-					if (bIsVertexInstanceUVsValid)
-					{
-						for (uint32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; ++UVLayerIndex)
-						{
-							const FVector2D &UV = LODResources.VertexBuffers.StaticMeshVertexBuffer.GetVertexUV(UEVertexIndex, UVLayerIndex);
-							UVs[UVLayerIndex][Float3Index + 0] = UV.X;
-							UVs[UVLayerIndex][Float3Index + 1] = 1.0f - UV.Y;
-							UVs[UVLayerIndex][Float3Index + 2] = 0;
-						}
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// NORMALS (N)
-					//---------------------------------------------------------------------------------------------------------------------
-					if (bIsVertexInstanceNormalsValid)
-					{
-						const FVector &Normal = LODResources.VertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(UEVertexIndex);
-						Normals[Float3Index + 0] = Normal.X;
-						Normals[Float3Index + 1] = Normal.Z;
-						Normals[Float3Index + 2] = Normal.Y;
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// TANGENT (tangentu)
-					//---------------------------------------------------------------------------------------------------------------------
-					if (bIsVertexInstanceTangentsValid)
-					{
-						const FVector &Tangent = LODResources.VertexBuffers.StaticMeshVertexBuffer.VertexTangentX(UEVertexIndex);
-						Tangents[Float3Index + 0] = Tangent.X;
-						Tangents[Float3Index + 1] = Tangent.Z;
-						Tangents[Float3Index + 2] = Tangent.Y;
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// BINORMAL (tangentv)
-					//---------------------------------------------------------------------------------------------------------------------
-					// In order to calculate the binormal we also need the tangent and normal
-					if (bIsVertexInstanceBinormalsValid)
-					{
-						FVector Binormal = LODResources.VertexBuffers.StaticMeshVertexBuffer.VertexTangentY(UEVertexIndex);
-						Binormals[Float3Index + 0] = Binormal.X;
-						Binormals[Float3Index + 1] = Binormal.Z;
-						Binormals[Float3Index + 2] = Binormal.Y;
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// COLORS (Cd)
-					//---------------------------------------------------------------------------------------------------------------------
-					if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
-					{
-						FVector4 Color = FLinearColor::White;
-						if (bUseComponentOverrideColors)
-						{
-							FStaticMeshComponentLODInfo& ComponentLODInfo = StaticMeshComponent->LODData[InLODIndex];
-							FColorVertexBuffer& ColorVertexBuffer = *ComponentLODInfo.OverrideVertexColors;
-							Color = ColorVertexBuffer.VertexColor(UEVertexIndex).ReinterpretAsLinear();
-						}
-						else
-						{
-							Color = LODResources.VertexBuffers.ColorVertexBuffer.VertexColor(UEVertexIndex).ReinterpretAsLinear();
-						}
-						RGBColors[Float3Index + 0] = Color[0];
-						RGBColors[Float3Index + 1] = Color[1];
-						RGBColors[Float3Index + 2] = Color[2];
-						Alphas[HoudiniVertexIdx] = Color[3];
-					}
-
-					//--------------------------------------------------------------------------------------------------------------------- 
-					// TRIANGLE/FACE VERTEX INDICES
-					//---------------------------------------------------------------------------------------------------------------------
-					if (UEVertexInstanceIdxToPointIdx.IsValidIndex(UEVertexIndex))
-					{
-						MeshTriangleVertexIndices[HoudiniVertexIdx] = UEVertexInstanceIdxToPointIdx[UEVertexIndex];
-					}
-
-					HoudiniVertexIdx++;
-				}
-
-				//--------------------------------------------------------------------------------------------------------------------- 
-				// TRIANGLE MATERIAL ASSIGNMENT
-				//---------------------------------------------------------------------------------------------------------------------
-				if (MaterialInterfaces.IsValidIndex(Section.MaterialIndex))
-				{
-					TriangleMaterialIndices.Add(Section.MaterialIndex);
-				}
-				else
-				{
-					TriangleMaterialIndices.Add(UEDefaultMaterialIndex);
-					HOUDINI_LOG_WARNING(TEXT("Section Index %d references an invalid Material Index %d, falling back to default material: %s"), SectionIndex, Section.MaterialIndex, *(UEDefaultMaterial->GetPathName()));
-				}
-
-				TriangleIdx++;
-			}
-		}
-
-		// Now transfer valid vertex instance attributes to Houdini vertex attributes
-
-		//--------------------------------------------------------------------------------------------------------------------- 
-		// UVS (uvX)
-		//--------------------------------------------------------------------------------------------------------------------- 
-		if (bIsVertexInstanceUVsValid)
-		{
-			for (uint32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; UVLayerIndex++)
-			{
-				// Construct the attribute name for this UV index.
-				FString UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
-				if (UVLayerIndex > 0)
-					UVAttributeName += FString::Printf(TEXT("%d"), UVLayerIndex + 1);
-
-				// Create attribute for UVs
-				HAPI_AttributeInfo AttributeInfoVertex;
-				FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
-
-				AttributeInfoVertex.count = NumVertexInstances;
-				AttributeInfoVertex.tupleSize = 3;
-				AttributeInfoVertex.exists = true;
-				AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-				AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-				AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
-
-				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-					FHoudiniEngine::Get().GetSession(),
-					NodeId, 0, TCHAR_TO_ANSI(*UVAttributeName), &AttributeInfoVertex), false);
-
-				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-					FHoudiniEngine::Get().GetSession(),
-					NodeId, 0, TCHAR_TO_ANSI(*UVAttributeName),
-					&AttributeInfoVertex, UVs[UVLayerIndex].GetData(),
-					0, AttributeInfoVertex.count), false);
-			}
-		}
-
-		//--------------------------------------------------------------------------------------------------------------------- 
-		// NORMALS (N)
-		//---------------------------------------------------------------------------------------------------------------------
-		if (bIsVertexInstanceNormalsValid)
-		{
-			// Create attribute for normals.
-			HAPI_AttributeInfo AttributeInfoVertex;
-			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
-
-			AttributeInfoVertex.tupleSize = 3;
-			AttributeInfoVertex.count = Normals.Num() / AttributeInfoVertex.tupleSize;
-			AttributeInfoVertex.exists = true;
-			AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
-
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
-				NodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoVertex), false);
-
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
-				NodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL,
-				&AttributeInfoVertex, Normals.GetData(),
-				0, AttributeInfoVertex.count), false);
-		}
-
-		//--------------------------------------------------------------------------------------------------------------------- 
-		// TANGENT (tangentu)
-		//---------------------------------------------------------------------------------------------------------------------
-		if (bIsVertexInstanceTangentsValid)
-		{
-			// Create attribute for tangentu.
-			HAPI_AttributeInfo AttributeInfoVertex;
-			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
-
-			AttributeInfoVertex.tupleSize = 3;
-			AttributeInfoVertex.count = Tangents.Num() / AttributeInfoVertex.tupleSize;
-			AttributeInfoVertex.exists = true;
-			AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
-
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-				FHoudiniEngine::Get().GetSession(),
-				NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTU, &AttributeInfoVertex), false);
-
-			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(),
-				NodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTU, &AttributeInfoVertex,
-				Tangents.GetData(), 0, AttributeInfoVertex.count), false);
-		}
-
-		//--------------------------------------------------------------------------------------------------------------------- 
-		// BINORMAL (tangentv)
-		//---------------------------------------------------------------------------------------------------------------------
-		if (bIsVertexInstanceBinormalsValid)
-		{
-			// Create attribute for normals.
-			HAPI_AttributeInfo AttributeInfoVertex;
-			FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
-
-			AttributeInfoVertex.tupleSize = 3;
-			AttributeInfoVertex.count = Binormals.Num() / AttributeInfoVertex.tupleSize;
-			AttributeInfoVertex.exists = true;
-			AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
+			AttributeInfoVertex.tupleSize = 3;
+			AttributeInfoVertex.count = Binormals.Num() / AttributeInfoVertex.tupleSize;
+			AttributeInfoVertex.exists = true;
+			AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
+			AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
+			AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
 			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
 				FHoudiniEngine::Get().GetSession(),
@@ -1979,7 +1695,7 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 		//--------------------------------------------------------------------------------------------------------------------- 
 		// COLORS (Cd)
 		//---------------------------------------------------------------------------------------------------------------------
-		if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
+		if (bHasColors)
 		{
 			// Create attribute for colors.
 			HAPI_AttributeInfo AttributeInfoVertex;
@@ -2355,12 +2071,835 @@ FUnrealMeshTranslator::CreateInputNodeForStaticMeshLODResources(
 	}
 
 	// Commit the geo.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-		FHoudiniEngine::Get().GetSession(), NodeId), false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(NodeId), false);
 
 	return true;
 }
 
+bool
+FUnrealMeshTranslator::ExtractStaticMeshLODResources(
+	const FStaticMeshLODResources& LODResources,
+	const int32& InLODIndex,
+	UStaticMesh* StaticMesh,
+	UStaticMeshComponent* StaticMeshComponent,
+	FUnrealMeshLODResourcesData& OutData)
+{
+	// Only reads the mesh/component data, so that this can run on a worker thread
+	OutData.bIsValid = false;
+
+	// Check that the mesh is not empty
+	if (LODResources.VertexBuffers.StaticMeshVertexBuffer.GetNumVertices() == 0)
+	{
+		HOUDINI_LOG_ERROR(TEXT("No vertices in mesh!"));
+		return false;
+	}
+
+	if (LODResources.Sections.Num() == 0)
+	{
+		HOUDINI_LOG_ERROR(TEXT("No triangles in mesh!"));
+		return false;
+	}
+
+	// Vertex instance and triangle counts
+	const uint32 OrigNumVertexInstances = LODResources.VertexBuffers.StaticMeshVertexBuffer.GetNumVertices();
+	const uint32 NumTriangles = LODResources.GetNumTriangles();
+	const uint32 NumVertexInstances = NumTriangles * 3;
+	const uint32 NumSections = LODResources.Sections.Num();
+
+	// Grab the build scale
+	const FStaticMeshSourceModel &SourceModel = StaticMesh->GetSourceModel(InLODIndex);
+	FVector BuildScaleVector = SourceModel.BuildSettings.BuildScale3D;
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// POSITION (P)
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// In FStaticMeshLODResources each vertex instances stores its position, even if the positions are not unique (in other
+	// words, in Houdini terminology, the number of points and vertices are the same. We'll do the same thing that Epic
+	// does in FBX export: we'll run through all vertex instances and use a hash to determine which instances share a 
+	// position, so that we can a smaller number of points than vertices, and vertices share point positions
+	TArray<int32> UEVertexInstanceIdxToPointIdx;
+	UEVertexInstanceIdxToPointIdx.Reserve(OrigNumVertexInstances);
+
+	TMap<FVector, int32> PositionToPointIndexMap;
+	PositionToPointIndexMap.Reserve(OrigNumVertexInstances);
+
+	TArray<float>& StaticMeshVertices = OutData.Positions;
+	StaticMeshVertices.Reserve(OrigNumVertexInstances * 3);
+	for (uint32 VertexInstanceIndex = 0; VertexInstanceIndex < OrigNumVertexInstances; ++VertexInstanceIndex)
+	{
+		// Convert Unreal to Houdini
+		const FVector &PositionVector = LODResources.VertexBuffers.PositionVertexBuffer.VertexPosition(VertexInstanceIndex);
+		const int32 *FoundPointIndexPtr = PositionToPointIndexMap.Find(PositionVector);
+		if (!FoundPointIndexPtr)
+		{
+			const int32 NewPointIndex = StaticMeshVertices.Add(PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.X) / 3;
+			StaticMeshVertices.Add(PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Z);
+			StaticMeshVertices.Add(PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION * BuildScaleVector.Y);
+
+			PositionToPointIndexMap.Add(PositionVector, NewPointIndex);
+			UEVertexInstanceIdxToPointIdx.Add(NewPointIndex);
+		}
+		else
+		{
+			UEVertexInstanceIdxToPointIdx.Add(*FoundPointIndexPtr);
+		}
+	}
+
+	StaticMeshVertices.Shrink();
+	const uint32 NumVertices = StaticMeshVertices.Num() / 3;
+
+	// Determine which attributes we have
+	const bool bIsVertexInstanceNormalsValid = true;
+	const bool bIsVertexInstanceTangentsValid = true;
+	const bool bIsVertexInstanceBinormalsValid = true;
+	const bool bIsVertexInstanceColorsValid = LODResources.bHasColorVertexData;
+	const uint32 NumUVLayers = FMath::Min<uint32>(LODResources.VertexBuffers.StaticMeshVertexBuffer.GetNumTexCoords(), MAX_STATIC_TEXCOORDS);
+	const bool bIsVertexInstanceUVsValid = NumUVLayers > 0;
+
+	bool bUseComponentOverrideColors = false;
+	// Determine if have override colors on the static mesh component, if so prefer to use those
+	if (StaticMeshComponent &&
+		StaticMeshComponent->LODData.IsValidIndex(InLODIndex) &&
+		StaticMeshComponent->LODData[InLODIndex].OverrideVertexColors)
+	{
+		FStaticMeshComponentLODInfo& ComponentLODInfo = StaticMeshComponent->LODData[InLODIndex];
+		FColorVertexBuffer& ColorVertexBuffer = *ComponentLODInfo.OverrideVertexColors;
+
+		if (ColorVertexBuffer.GetNumVertices() == LODResources.GetNumVertices())
+		{
+			bUseComponentOverrideColors = true;
+		}
+	}
+
+	//--------------------------------------------------------------------------------------------------------------------- 
+	// MATERIAL INDEX -> MATERIAL INTERFACE
+	//---------------------------------------------------------------------------------------------------------------------
+	TArray<UMaterialInterface*>& MaterialInterfaces = OutData.MaterialInterfaces;
+	TArray<int32>& TriangleMaterialIndices = OutData.TriangleMaterialIndices;
+
+	const TArray<FStaticMaterial>& StaticMaterials = StaticMesh->GetStaticMaterials();
+
+	// If the static mesh component is valid, get the materials via the component to account for overrides
+	const bool bIsStaticMeshComponentValid = (IsValid(StaticMeshComponent) && StaticMeshComponent->IsValidLowLevel());
+	const int32 NumStaticMaterials = StaticMaterials.Num();
+	// If we find any invalid Material (null or pending kill), or we find a section below with an out of range MaterialIndex,
+	// then we will set UEDefaultMaterial at the invalid index
+	int32 UEDefaultMaterialIndex = INDEX_NONE;
+	UMaterialInterface *UEDefaultMaterial = nullptr;
+	if (NumStaticMaterials > 0)
+	{
+		MaterialInterfaces.Reserve(NumStaticMaterials);
+		for (int32 MaterialIndex = 0; MaterialIndex < NumStaticMaterials; ++MaterialIndex)
+		{
+			const FStaticMaterial &MaterialInfo = StaticMaterials[MaterialIndex];
+			UMaterialInterface *Material = nullptr;
+			if (bIsStaticMeshComponentValid)
+			{
+				Material = StaticMeshComponent->GetMaterial(MaterialIndex);
+			}
+			else
+			{
+				Material = MaterialInfo.MaterialInterface;
+			}
+			// If the Material is NULL or invalid, fallback to the default material
+			if (!IsValid(Material))
+			{
+				if (!UEDefaultMaterial)
+				{
+					UEDefaultMaterial = UMaterial::GetDefaultMaterial(EMaterialDomain::MD_Surface);
+					UEDefaultMaterialIndex = MaterialIndex;
+				}
+				Material = UEDefaultMaterial;
+				HOUDINI_LOG_WARNING(TEXT("Material Index %d (slot %s) has an invalid material, falling back to default: %s"), MaterialIndex, *(MaterialInfo.MaterialSlotName.ToString()), *(UEDefaultMaterial->GetPathName()));
+			}
+			// MaterialSlotToInterface.Add(MaterialInfo.ImportedMaterialSlotName, MaterialIndex);
+			MaterialInterfaces.Add(Material);
+		}
+
+		TriangleMaterialIndices.Reserve(NumTriangles);
+	}
+
+	// If we haven't created UEDefaultMaterial yet, check that all the sections' MaterialIndex
+	// is valid, if not, create UEDefaultMaterial and add to MaterialInterfaces to get UEDefaultMaterialIndex
+	if (!UEDefaultMaterial || UEDefaultMaterialIndex == INDEX_NONE)
+	{
+		for (uint32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+		{
+			// If the MaterialIndex referenced by this Section is out of range, fill MaterialInterfaces with UEDefaultMaterial
+			// up to and including MaterialIndex and log a warning
+			const int32 MaterialIndex = LODResources.Sections[SectionIndex].MaterialIndex;
+			if (!MaterialInterfaces.IsValidIndex(MaterialIndex))
+			{
+				if (!UEDefaultMaterial)
+				{
+					UEDefaultMaterial = UMaterial::GetDefaultMaterial(EMaterialDomain::MD_Surface);
+					// Add the UEDefaultMaterial to MaterialInterfaces
+					UEDefaultMaterialIndex = MaterialInterfaces.Add(UEDefaultMaterial);
+				}
+				HOUDINI_LOG_WARNING(TEXT("Section Index %d references an invalid Material Index %d, falling back to default material: %s"), SectionIndex, MaterialIndex, *(UEDefaultMaterial->GetPathName()));
+			}
+		}
+	}
+
+	OutData.NumVertices = NumVertices;
+	OutData.NumVertexInstances = NumVertexInstances;
+	OutData.NumTriangles = NumTriangles;
+	OutData.NumUVLayers = NumUVLayers;
+	OutData.bHasColors = bUseComponentOverrideColors || bIsVertexInstanceColorsValid;
+
+	// Now we deal with vertex instance attributes.
+	if (NumTriangles > 0)
+	{
+		// UV layer array. Each layer has an array of floats, 3 floats per vertex instance
+		TArray<TArray<float>>& UVs = OutData.UVs;
+		// Normals: 3 floats per vertex instance
+		TArray<float>& Normals = OutData.Normals;
+		// Tangents: 3 floats per vertex instance
+		TArray<float>& Tangents = OutData.Tangents;
+		// Binormals: 3 floats per vertex instance
+		TArray<float>& Binormals = OutData.Binormals;
+		// RGBColors: 3 floats per vertex instance
+		TArray<float>& RGBColors = OutData.RGBColors;
+		// Alphas: 1 float per vertex instance
+		TArray<float>& Alphas = OutData.Alphas;
+
+		// Initialize the arrays for the attributes that are valid
+		if (bIsVertexInstanceUVsValid)
+		{
+			UVs.SetNum(NumUVLayers);
+			for (uint32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; ++UVLayerIndex)
+			{
+				UVs[UVLayerIndex].SetNumUninitialized(NumVertexInstances * 3);
+			}
+		}
+
+		if (bIsVertexInstanceNormalsValid)
+		{
+			Normals.SetNumUninitialized(NumVertexInstances * 3);
+		}
+
+		if (bIsVertexInstanceTangentsValid)
+		{
+			Tangents.SetNumUninitialized(NumVertexInstances * 3);
+		}
+
+		if (bIsVertexInstanceBinormalsValid)
+		{
+			Binormals.SetNumUninitialized(NumVertexInstances * 3);
+		}
+
+		if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
+		{
+			RGBColors.SetNumUninitialized(NumVertexInstances * 3);
+			Alphas.SetNumUninitialized(NumVertexInstances);
+		}
+
+		// Array of vertex (point position) indices per triangle
+		TArray<int32>& MeshTriangleVertexIndices = OutData.TriangleVertexIndices;
+		MeshTriangleVertexIndices.SetNumUninitialized(NumVertexInstances);
+		// Array of vertex counts per triangle/face
+		TArray<int32>& MeshTriangleVertexCounts = OutData.TriangleVertexCounts;
+		MeshTriangleVertexCounts.SetNumUninitialized(NumTriangles);
+
+		int32 TriangleIdx = 0;
+		int32 HoudiniVertexIdx = 0;
+		FIndexArrayView TriangleVertexIndices = LODResources.IndexBuffer.GetArrayView();
+		for (uint32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+		{
+			const FStaticMeshSection& Section = LODResources.Sections[SectionIndex];
+			for (uint32 SectionTriangleIndex = 0; SectionTriangleIndex < Section.NumTriangles; ++SectionTriangleIndex)
+			{
+				MeshTriangleVertexCounts[TriangleIdx] = 3;
+				for (int32 TriangleVertexIndex = 0; TriangleVertexIndex < 3; ++TriangleVertexIndex)
+				{
+					// Reverse the winding order for Houdini (but still start at 0)
+					const int32 WindingIdx = (3 - TriangleVertexIndex) % 3;
+					const uint32 UEVertexIndex = TriangleVertexIndices[Section.FirstIndex + SectionTriangleIndex * 3 + WindingIdx];
+
+					// Calculate the index of the first component of a vertex instance's value in an inline float array 
+					// representing vectors (3 float) per vertex instance
+					const int32 Float3Index = HoudiniVertexIdx * 3;
+
+					//--------------------------------------------------------------------------------------------------------------------- 
+					// UVS (uvX)
+					//--------------------------------------------------------------------------------------------------------------------- 
+					if (bIsVertexInstanceUVsValid)
+					{
+						for (uint32 UVLayerIndex = 0; UVLayerIndex < NumUVLayers; ++UVLayerIndex)
+						{
+							const FVector2D &UV = LODResources.VertexBuffers.StaticMeshVertexBuffer.GetVertexUV(UEVertexIndex, UVLayerIndex);
+							UVs[UVLayerIndex][Float3Index + 0] = UV.X;
+							UVs[UVLayerIndex][Float3Index + 1] = 1.0f - UV.Y;
+							UVs[UVLayerIndex][Float3Index + 2] = 0;
+						}
+					}
+
+					//--------------------------------------------------------------------------------------------------------------------- 
+					// NORMALS (N)
+					//---------------------------------------------------------------------------------------------------------------------
+					if (bIsVertexInstanceNormalsValid)
+					{
+						const FVector &Normal = LODResources.VertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(UEVertexIndex);
+						Normals[Float3Index + 0] = Normal.X;
+						Normals[Float3Index + 1] = Normal.Z;
+						Normals[Float3Index + 2] = Normal.Y;
+					}
+
+					//--------------------------------------------------------------------------------------------------------------------- 
+					// TANGENT (tangentu)
+					//---------------------------------------------------------------------------------------------------------------------
+					if (bIsVertexInstanceTangentsValid)
+					{
+						const FVector &Tangent = LODResources.VertexBuffers.StaticMeshVertexBuffer.VertexTangentX(UEVertexIndex);
+						Tangents[Float3Index + 0] = Tangent.X;
+						Tangents[Float3Index + 1] = Tangent.Z;
+						Tangents[Float3Index + 2] = Tangent.Y;
+					}
+
+					//--------------------------------------------------------------------------------------------------------------------- 
+					// BINORMAL (tangentv)
+					//---------------------------------------------------------------------------------------------------------------------
+					// In order to calculate the binormal we also need the tangent and normal
+					if (bIsVertexInstanceBinormalsValid)
+					{
+						FVector Binormal = LODResources.VertexBuffers.StaticMeshVertexBuffer.VertexTangentY(UEVertexIndex);
+						Binormals[Float3Index + 0] = Binormal.X;
+						Binormals[Float3Index + 1] = Binormal.Z;
+						Binormals[Float3Index + 2] = Binormal.Y;
+					}
+
+					//--------------------------------------------------------------------------------------------------------------------- 
+					// COLORS (Cd)
+					//---------------------------------------------------------------------------------------------------------------------
+					if (bUseComponentOverrideColors || bIsVertexInstanceColorsValid)
+					{
+						FVector4 Color = FLinearColor::White;
+						if (bUseComponentOverrideColors)
+						{
+							FStaticMeshComponentLODInfo& ComponentLODInfo = StaticMeshComponent->LODData[InLODIndex];
+							FColorVertexBuffer& ColorVertexBuffer = *ComponentLODInfo.OverrideVertexColors;
+							Color = ColorVertexBuffer.VertexColor(UEVertexIndex).ReinterpretAsLinear();
+						}
+						else
+						{
+							Color = LODResources.VertexBuffers.ColorVertexBuffer.VertexColor(UEVertexIndex).ReinterpretAsLinear();
+						}
+						RGBColors[Float3Index + 0] = Color[0];
+						RGBColors[Float3Index + 1] = Color[1];
+						RGBColors[Float3Index + 2] = Color[2];
+						Alphas[HoudiniVertexIdx] = Color[3];
+					}
+
+					//--------------------------------------------------------------------------------------------------------------------- 
+					// TRIANGLE/FACE VERTEX INDICES
+					//---------------------------------------------------------------------------------------------------------------------
+					if (UEVertexInstanceIdxToPointIdx.IsValidIndex(UEVertexIndex))
+					{
+						MeshTriangleVertexIndices[HoudiniVertexIdx] = UEVertexInstanceIdxToPointIdx[UEVertexIndex];
+					}
+
+					HoudiniVertexIdx++;
+				}
+
+				//--------------------------------------------------------------------------------------------------------------------- 
+				// TRIANGLE MATERIAL ASSIGNMENT
+				//---------------------------------------------------------------------------------------------------------------------
+				if (MaterialInterfaces.IsValidIndex(Section.MaterialIndex))
+				{
+					TriangleMaterialIndices.Add(Section.MaterialIndex);
+				}
+				else
+				{
+					TriangleMaterialIndices.Add(UEDefaultMaterialIndex);
+					HOUDINI_LOG_WARNING(TEXT("Section Index %d references an invalid Material Index %d, falling back to default material: %s"), SectionIndex, Section.MaterialIndex, *(UEDefaultMaterial->GetPathName()));
+				}
+
+				TriangleIdx++;
+			}
+		}
+	}
+
+	OutData.bIsValid = true;
+	return true;
+}
+
+
+// Static mesh LODs being extracted ahead of their upload, only accessed on the game thread
+typedef TTuple<UStaticMesh*, UStaticMeshComponent*, int32> FPrefetchedLODResourcesKey;
+static TMap<FPrefetchedLODResourcesKey, TFuture<TSharedPtr<FUnrealMeshLODResourcesData>>> PrefetchedLODResources;
+
+void
+FUnrealMeshTranslator::PrefetchStaticMeshLODResources(
+	UStaticMesh* StaticMesh,
+	UStaticMeshComponent* StaticMeshComponent,
+	const bool& ExportAllLODs)
+{
+	check(IsInGameThread());
+
+	if (!IsValid(StaticMesh))
+		return;
+
+	// Same LODs as HapiCreateInputNodeForStaticMesh
+	const int32 NumLODsToExport = (ExportAllLODs && StaticMesh->GetNumLODs() > 1) ? StaticMesh->GetNumLODs() : 1;
+	for (int32 LODIndex = 0; LODIndex < NumLODsToExport; LODIndex++)
+	{
+		const FPrefetchedLODResourcesKey Key(StaticMesh, StaticMeshComponent, LODIndex);
+		if (PrefetchedLODResources.Contains(Key))
+			continue;
+
+		const FStaticMeshLODResources* LODResources = &StaticMesh->GetLODForExport(LODIndex);
+		PrefetchedLODResources.Add(Key, Async(EAsyncExecution::ThreadPool,
+			[LODResources, LODIndex, StaticMesh, StaticMeshComponent]()
+		{
+			TSharedPtr<FUnrealMeshLODResourcesData> LODData = MakeShared<FUnrealMeshLODResourcesData>();
+			FUnrealMeshTranslator::ExtractStaticMeshLODResources(
+				*LODResources, LODIndex, StaticMesh, StaticMeshComponent, *LODData);
+			return LODData;
+		}));
+	}
+}
+
+bool
+FUnrealMeshTranslator::ConsumePrefetchedStaticMeshLODResources(
+	UStaticMesh* StaticMesh,
+	UStaticMeshComponent* StaticMeshComponent,
+	const int32& InLODIndex,
+	FUnrealMeshLODResourcesData& OutData)
+{
+	if (PrefetchedLODResources.Num() <= 0 || !IsInGameThread())
+		return false;
+
+	const FPrefetchedLODResourcesKey Key(StaticMesh, StaticMeshComponent, InLODIndex);
+	TFuture<TSharedPtr<FUnrealMeshLODResourcesData>>* LODDataFuture = PrefetchedLODResources.Find(Key);
+	if (!LODDataFuture)
+		return false;
+
+	TSharedPtr<FUnrealMeshLODResourcesData> LODData = LODDataFuture->Get();
+	PrefetchedLODResources.Remove(Key);
+	if (!LODData.IsValid())
+		return false;
+
+	OutData = MoveTemp(*LODData);
+	return true;
+}
+
+void
+FUnrealMeshTranslator::FlushPrefetchedStaticMeshLODResources()
+{
+	for (auto& CurPair : PrefetchedLODResources)
+		CurPair.Value.Wait();
+
+	PrefetchedLODResources.Empty();
+}
+
+// Adds a primitive string attribute whose values are picked in a table of strings.
+// Each string is only converted once, all the primitives using it point to the same converted string.
+static bool
+SetPrimitiveStringAttributeFromTable(
+	const HAPI_NodeId& NodeId,
+	const char* InAttributeName,
+	const TArray<FString>& InStrings,
+	const TArray<int32>& InPrimStringIndices)
+{
+	HAPI_AttributeInfo AttributeInfo;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+	AttributeInfo.count = InPrimStringIndices.Num();
+	AttributeInfo.tupleSize = 1;
+	AttributeInfo.exists = true;
+	AttributeInfo.owner = HAPI_ATTROWNER_PRIM;
+	AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
+	AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		FHoudiniEngine::Get().GetSession(), NodeId, 0, InAttributeName, &AttributeInfo), false);
+
+	TArray<const char*> RawStrings;
+	RawStrings.Reserve(InStrings.Num());
+	for (const FString& CurString : InStrings)
+		RawStrings.Add(FHoudiniEngineUtils::ExtractRawString(CurString));
+
+	TArray<const char*> PrimitiveAttrs;
+	PrimitiveAttrs.SetNumUninitialized(InPrimStringIndices.Num());
+	for (int32 PrimIdx = 0; PrimIdx < InPrimStringIndices.Num(); PrimIdx++)
+		PrimitiveAttrs[PrimIdx] = RawStrings[InPrimStringIndices[PrimIdx]];
+
+	HAPI_Result Result = FHoudiniApi::SetAttributeStringData(
+		FHoudiniEngine::Get().GetSession(), NodeId, 0, InAttributeName, &AttributeInfo,
+		PrimitiveAttrs.GetData(), 0, PrimitiveAttrs.Num());
+
+	// ExtractRawString allocates memory using malloc, free it!
+	FHoudiniEngineUtils::FreeRawStringMemory(RawStrings);
+
+	return Result == HAPI_RESULT_SUCCESS;
+}
+
+bool
+FUnrealMeshTranslator::HapiCreateInputNodeForStaticMeshComponents(
+	const TArray<UStaticMeshComponent*>& InComponents,
+	HAPI_NodeId& InOutInputNodeId,
+	const FString& InInputNodeName)
+{
+	// Only keep the components that have a mesh to send
+	TArray<UStaticMeshComponent*> Components;
+	TArray<const FStaticMeshLODResources*> ComponentsLODResources;
+	for (UStaticMeshComponent* CurSMC : InComponents)
+	{
+		if (!IsValid(CurSMC) || !IsValid(CurSMC->GetStaticMesh()))
+			continue;
+
+		Components.Add(CurSMC);
+		ComponentsLODResources.Add(&CurSMC->GetStaticMesh()->GetLODForExport(0));
+	}
+
+	const int32 NumComponents = Components.Num();
+	if (NumComponents <= 0)
+		return false;
+
+	// Extract the first LOD of all the components on worker threads
+	TArray<FUnrealMeshLODResourcesData> ComponentsData;
+	ComponentsData.SetNum(NumComponents);
+	ParallelFor(NumComponents, [&](int32 CompIdx)
+	{
+		UStaticMeshComponent* SMC = Components[CompIdx];
+		ExtractStaticMeshLODResources(*ComponentsLODResources[CompIdx], 0, SMC->GetStaticMesh(), SMC, ComponentsData[CompIdx]);
+	});
+
+	// Offsets of each component's points, vertices and primitives in the merged geometry
+	TArray<int32> PointOffsets;
+	TArray<int32> VertexOffsets;
+	TArray<int32> PrimOffsets;
+	PointOffsets.SetNumZeroed(NumComponents + 1);
+	VertexOffsets.SetNumZeroed(NumComponents + 1);
+	PrimOffsets.SetNumZeroed(NumComponents + 1);
+
+	uint32 NumUVLayers = 0;
+	bool bHasNormals = false;
+	bool bHasTangents = false;
+	bool bHasBinormals = false;
+	bool bHasColors = false;
+	for (int32 CompIdx = 0; CompIdx < NumComponents; CompIdx++)
+	{
+		const FUnrealMeshLODResourcesData& Data = ComponentsData[CompIdx];
+		const bool bIsValid = Data.bIsValid;
+		PointOffsets[CompIdx + 1] = PointOffsets[CompIdx] + (bIsValid ? Data.NumVertices : 0);
+		VertexOffsets[CompIdx + 1] = VertexOffsets[CompIdx] + (bIsValid ? Data.NumVertexInstances : 0);
+		PrimOffsets[CompIdx + 1] = PrimOffsets[CompIdx] + (bIsValid ? Data.NumTriangles : 0);
+		if (!bIsValid)
+			continue;
+
+		NumUVLayers = FMath::Max(NumUVLayers, Data.NumUVLayers);
+		bHasNormals |= Data.Normals.Num() > 0;
+		bHasTangents |= Data.Tangents.Num() > 0;
+		bHasBinormals |= Data.Binormals.Num() > 0;
+		bHasColors |= Data.bHasColors;
+	}
+
+	const int32 NumPoints = PointOffsets[NumComponents];
+	const int32 NumVertices = VertexOffsets[NumComponents];
+	const int32 NumPrims = PrimOffsets[NumComponents];
+	if (NumPrims <= 0)
+		return false;
+
+	// The component transforms, converted to Houdini's coordinate system to be applied to the extracted data.
+	// The per component strings, and the table of the materials used by all the components.
+	TArray<FTransform> HoudiniTransforms;
+	TArray<FString> MeshPaths;
+	TArray<FString> ComponentPaths;
+	TArray<FString> ActorPaths;
+	TArray<FString> LevelPaths;
+	TArray<FString> MaterialPaths;
+	TArray<TArray<int32>> ComponentMaterialIndices;
+	TArray<float> ComponentTransforms;
+	HoudiniTransforms.SetNum(NumComponents);
+	ComponentTransforms.SetNumUninitialized(NumComponents * 16);
+	MeshPaths.SetNum(NumComponents);
+	ComponentPaths.SetNum(NumComponents);
+	ActorPaths.SetNum(NumComponents);
+	LevelPaths.SetNum(NumComponents);
+	ComponentMaterialIndices.SetNum(NumComponents);
+
+	// Null materials use the default material, like in CreateFaceMaterialArray
+	UMaterialInterface* DefaultMaterial = Cast<UMaterialInterface>(FHoudiniEngine::Get().GetHoudiniDefaultMaterial().Get());
+	const int32 DefaultMaterialIndex = MaterialPaths.Add(IsValid(DefaultMaterial) ? DefaultMaterial->GetPathName() : FString());
+	TMap<UMaterialInterface*, int32> MaterialIndices;
+	for (int32 CompIdx = 0; CompIdx < NumComponents; CompIdx++)
+	{
+		UStaticMeshComponent* SMC = Components[CompIdx];
+
+		HAPI_Transform HapiTransform;
+		FHoudiniApi::Transform_Init(&HapiTransform);
+		FHoudiniEngineUtils::TranslateUnrealTransform(SMC->GetComponentTransform(), HapiTransform);
+		HoudiniTransforms[CompIdx] = FTransform(
+			FQuat(HapiTransform.rotationQuaternion[0], HapiTransform.rotationQuaternion[1], HapiTransform.rotationQuaternion[2], HapiTransform.rotationQuaternion[3]),
+			FVector(HapiTransform.position[0], HapiTransform.position[1], HapiTransform.position[2]),
+			FVector(HapiTransform.scale[0], HapiTransform.scale[1], HapiTransform.scale[2]));
+
+		const FMatrix TransformMatrix = HoudiniTransforms[CompIdx].ToMatrixWithScale();
+		for (int32 Row = 0; Row < 4; Row++)
+		{
+			for (int32 Col = 0; Col < 4; Col++)
+				ComponentTransforms[CompIdx * 16 + Row * 4 + Col] = TransformMatrix.M[Row][Col];
+		}
+
+		MeshPaths[CompIdx] = SMC->GetStaticMesh()->GetPathName();
+		ComponentPaths[CompIdx] = SMC->GetPathName();
+
+		AActor* ParentActor = SMC->GetOwner();
+		if (IsValid(ParentActor))
+		{
+			ActorPaths[CompIdx] = ParentActor->GetPathName();
+
+			// Same level path as AddLevelPathAttribute: we just want the path up to the first point
+			ULevel* Level = ParentActor->GetLevel();
+			if (IsValid(Level))
+			{
+				LevelPaths[CompIdx] = Level->GetPathName();
+				int32 DotIndex;
+				if (LevelPaths[CompIdx].FindChar('.', DotIndex))
+					LevelPaths[CompIdx].LeftInline(DotIndex, false);
+			}
+		}
+
+		for (UMaterialInterface* CurMaterial : ComponentsData[CompIdx].MaterialInterfaces)
+		{
+			int32 MaterialIndex = DefaultMaterialIndex;
+			if (IsValid(CurMaterial))
+			{
+				if (int32* FoundIndex = MaterialIndices.Find(CurMaterial))
+					MaterialIndex = *FoundIndex;
+				else
+					MaterialIndex = MaterialIndices.Add(CurMaterial, MaterialPaths.Add(CurMaterial->GetPathName()));
+			}
+
+			ComponentMaterialIndices[CompIdx].Add(MaterialIndex);
+		}
+	}
+
+	// Merge the components' data, applying their transforms, on worker threads
+	TArray<float> Positions;
+	TArray<TArray<float>> UVs;
+	TArray<float> Normals;
+	TArray<float> Tangents;
+	TArray<float> Binormals;
+	TArray<float> RGBColors;
+	TArray<float> Alphas;
+	TArray<int32> VertexList;
+	TArray<int32> PrimComponentIndices;
+	TArray<int32> PrimMaterialIndices;
+
+	Positions.SetNumUninitialized(NumPoints * 3);
+	UVs.SetNum(NumUVLayers);
+	for (TArray<float>& CurUVs : UVs)
+		CurUVs.SetNumZeroed(NumVertices * 3);
+	if (bHasNormals)
+		Normals.SetNumZeroed(NumVertices * 3);
+	if (bHasTangents)
+		Tangents.SetNumZeroed(NumVertices * 3);
+	if (bHasBinormals)
+		Binormals.SetNumZeroed(NumVertices * 3);
+	if (bHasColors)
+	{
+		// Components without colors are white
+		RGBColors.Init(1.0f, NumVertices * 3);
+		Alphas.Init(1.0f, NumVertices);
+	}
+	VertexList.SetNumUninitialized(NumVertices);
+	PrimComponentIndices.SetNumUninitialized(NumPrims);
+	PrimMaterialIndices.SetNumUninitialized(NumPrims);
+
+	ParallelFor(NumComponents, [&](int32 CompIdx)
+	{
+		const FUnrealMeshLODResourcesData& Data = ComponentsData[CompIdx];
+		if (!Data.bIsValid)
+			return;
+
+		const FTransform& Transform = HoudiniTransforms[CompIdx];
+		const FQuat Rotation = Transform.GetRotation();
+		const FVector InvScale = FTransform::GetSafeScaleReciprocal(Transform.GetScale3D());
+
+		// A mirroring transform flips the triangles, reverse their winding to keep them facing the same way
+		const bool bReverseWinding = Transform.GetDeterminant() < 0.0f;
+
+		auto ReadVector = [](const TArray<float>& InArray, const int32& InIndex)
+		{
+			return FVector(InArray[InIndex * 3 + 0], InArray[InIndex * 3 + 1], InArray[InIndex * 3 + 2]);
+		};
+
+		auto WriteVector = [](TArray<float>& OutArray, const int32& InIndex, const FVector& InVector)
+		{
+			OutArray[InIndex * 3 + 0] = InVector.X;
+			OutArray[InIndex * 3 + 1] = InVector.Y;
+			OutArray[InIndex * 3 + 2] = InVector.Z;
+		};
+
+		const int32 PointOffset = PointOffsets[CompIdx];
+		for (uint32 PointIdx = 0; PointIdx < Data.NumVertices; PointIdx++)
+			WriteVector(Positions, PointOffset + PointIdx, Transform.TransformPosition(ReadVector(Data.Positions, PointIdx)));
+
+		const int32 VertexOffset = VertexOffsets[CompIdx];
+		for (uint32 VertexIdx = 0; VertexIdx < Data.NumVertexInstances; VertexIdx++)
+		{
+			const uint32 Corner = VertexIdx % 3;
+			const int32 SrcIdx = bReverseWinding ? VertexIdx - Corner + (3 - Corner) % 3 : VertexIdx;
+			const int32 DstIdx = VertexOffset + VertexIdx;
+
+			VertexList[DstIdx] = PointOffset + Data.TriangleVertexIndices[SrcIdx];
+
+			for (uint32 UVLayerIdx = 0; UVLayerIdx < Data.NumUVLayers; UVLayerIdx++)
+				WriteVector(UVs[UVLayerIdx], DstIdx, ReadVector(Data.UVs[UVLayerIdx], SrcIdx));
+
+			// Normals use the inverse transpose of the transform
+			if (Data.Normals.Num() > 0)
+				WriteVector(Normals, DstIdx, Rotation.RotateVector(ReadVector(Data.Normals, SrcIdx) * InvScale).GetSafeNormal());
+
+			if (Data.Tangents.Num() > 0)
+				WriteVector(Tangents, DstIdx, Transform.TransformVector(ReadVector(Data.Tangents, SrcIdx)).GetSafeNormal());
+
+			if (Data.Binormals.Num() > 0)
+				WriteVector(Binormals, DstIdx, Transform.TransformVector(ReadVector(Data.Binormals, SrcIdx)).GetSafeNormal());
+
+			if (Data.bHasColors)
+			{
+				WriteVector(RGBColors, DstIdx, ReadVector(Data.RGBColors, SrcIdx));
+				Alphas[DstIdx] = Data.Alphas[SrcIdx];
+			}
+		}
+
+		const TArray<int32>& CompMaterialIndices = ComponentMaterialIndices[CompIdx];
+		const int32 PrimOffset = PrimOffsets[CompIdx];
+		for (uint32 TriangleIdx = 0; TriangleIdx < Data.NumTriangles; TriangleIdx++)
+		{
+			const int32 PrimIdx = PrimOffset + TriangleIdx;
+			PrimComponentIndices[PrimIdx] = CompIdx;
+
+			const int32 MaterialIdx = Data.TriangleMaterialIndices.IsValidIndex(TriangleIdx) ? Data.TriangleMaterialIndices[TriangleIdx] : INDEX_NONE;
+			PrimMaterialIndices[PrimIdx] = CompMaterialIndices.IsValidIndex(MaterialIdx) ? CompMaterialIndices[MaterialIdx] : DefaultMaterialIndex;
+		}
+	});
+
+	// Reuse the existing input node, or create a new one
+	HAPI_NodeId NodeId = InOutInputNodeId;
+	if (NodeId < 0 || !FHoudiniEngineUtils::IsHoudiniNodeValid(NodeId))
+	{
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateInputNode(
+			FHoudiniEngine::Get().GetSession(), &NodeId, TCHAR_TO_ANSI(*InInputNodeName)), false);
+
+		if (!FHoudiniEngineUtils::HapiCookNode(NodeId, nullptr, true))
+			return false;
+
+		InOutInputNodeId = NodeId;
+	}
+
+	// Send all the components in a single part
+	HAPI_PartInfo Part;
+	FHoudiniApi::PartInfo_Init(&Part);
+	Part.id = 0;
+	Part.nameSH = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_POINT] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_PRIM] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_VERTEX] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_DETAIL] = 0;
+	Part.vertexCount = NumVertices;
+	Part.faceCount = NumPrims;
+	Part.pointCount = NumPoints;
+	Part.type = HAPI_PARTTYPE_MESH;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
+		FHoudiniEngine::Get().GetSession(), NodeId, 0, &Part), false);
+
+	auto SetFloatAttribute = [NodeId](const char* InAttributeName, const HAPI_AttributeOwner& InOwner, const int32& InTupleSize, const TArray<float>& InData)
+	{
+		HAPI_AttributeInfo AttributeInfo;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+		AttributeInfo.count = InOwner == HAPI_ATTROWNER_DETAIL ? 1 : InData.Num() / InTupleSize;
+		AttributeInfo.tupleSize = InTupleSize;
+		AttributeInfo.exists = true;
+		AttributeInfo.owner = InOwner;
+		AttributeInfo.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(), NodeId, 0, InAttributeName, &AttributeInfo), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(), NodeId, 0, InAttributeName, &AttributeInfo,
+			InData.GetData(), 0, AttributeInfo.count), false);
+
+		return true;
+	};
+
+	if (!SetFloatAttribute(HAPI_UNREAL_ATTRIB_POSITION, HAPI_ATTROWNER_POINT, 3, Positions))
+		return false;
+
+	for (uint32 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; UVLayerIdx++)
+	{
+		FString UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
+		if (UVLayerIdx > 0)
+			UVAttributeName += FString::Printf(TEXT("%d"), UVLayerIdx + 1);
+
+		if (!SetFloatAttribute(TCHAR_TO_ANSI(*UVAttributeName), HAPI_ATTROWNER_VERTEX, 3, UVs[UVLayerIdx]))
+			return false;
+	}
+
+	if (bHasNormals && !SetFloatAttribute(HAPI_UNREAL_ATTRIB_NORMAL, HAPI_ATTROWNER_VERTEX, 3, Normals))
+		return false;
+
+	if (bHasTangents && !SetFloatAttribute(HAPI_UNREAL_ATTRIB_TANGENTU, HAPI_ATTROWNER_VERTEX, 3, Tangents))
+		return false;
+
+	if (bHasBinormals && !SetFloatAttribute(HAPI_UNREAL_ATTRIB_TANGENTV, HAPI_ATTROWNER_VERTEX, 3, Binormals))
+		return false;
+
+	if (bHasColors)
+	{
+		if (!SetFloatAttribute(HAPI_UNREAL_ATTRIB_COLOR, HAPI_ATTROWNER_VERTEX, 3, RGBColors))
+			return false;
+
+		if (!SetFloatAttribute(HAPI_UNREAL_ATTRIB_ALPHA, HAPI_ATTROWNER_VERTEX, 1, Alphas))
+			return false;
+	}
+
+	// Vertex list and face counts
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetVertexList(
+		FHoudiniEngine::Get().GetSession(), NodeId, 0, VertexList.GetData(), 0, VertexList.Num()), false);
+
+	TArray<int32> FaceCounts;
+	FaceCounts.Init(3, NumPrims);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetFaceCounts(
+		FHoudiniEngine::Get().GetSession(), NodeId, 0, FaceCounts.GetData(), 0, FaceCounts.Num()), false);
+
+	// Per primitive material, and the name/paths/index of the component the primitive comes from.
+	// The component transforms are only sent once, in a detail attribute of 16 floats per component index.
+	bool bSuccess = SetPrimitiveStringAttributeFromTable(NodeId, HAPI_UNREAL_ATTRIB_MATERIAL, MaterialPaths, PrimMaterialIndices);
+	bSuccess &= SetPrimitiveStringAttributeFromTable(NodeId, HAPI_ATTRIB_NAME, ComponentPaths, PrimComponentIndices);
+	bSuccess &= SetPrimitiveStringAttributeFromTable(NodeId, HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME, MeshPaths, PrimComponentIndices);
+	bSuccess &= SetPrimitiveStringAttributeFromTable(NodeId, HAPI_UNREAL_ATTRIB_ACTOR_PATH, ActorPaths, PrimComponentIndices);
+	bSuccess &= SetPrimitiveStringAttributeFromTable(NodeId, HAPI_UNREAL_ATTRIB_LEVEL_PATH, LevelPaths, PrimComponentIndices);
+	bSuccess &= SetFloatAttribute(HAPI_UNREAL_ATTRIB_INPUT_COMPONENT_TRANSFORM, HAPI_ATTROWNER_DETAIL, NumComponents * 16, ComponentTransforms);
+	if (!bSuccess)
+		return false;
+
+	HAPI_AttributeInfo ComponentIndexInfo;
+	FHoudiniApi::AttributeInfo_Init(&ComponentIndexInfo);
+	ComponentIndexInfo.count = NumPrims;
+	ComponentIndexInfo.tupleSize = 1;
+	ComponentIndexInfo.exists = true;
+	ComponentIndexInfo.owner = HAPI_ATTROWNER_PRIM;
+	ComponentIndexInfo.storage = HAPI_STORAGETYPE_INT;
+	ComponentIndexInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		FHoudiniEngine::Get().GetSession(), NodeId, 0, HAPI_UNREAL_ATTRIB_INPUT_COMPONENT_INDEX, &ComponentIndexInfo), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeIntData(
+		FHoudiniEngine::Get().GetSession(), NodeId, 0, HAPI_UNREAL_ATTRIB_INPUT_COMPONENT_INDEX, &ComponentIndexInfo,
+		PrimComponentIndices.GetData(), 0, NumPrims), false);
+
+	// Commit the geo.
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(NodeId), false);
+
+	return true;
+}
 
 bool
 FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
@@ -3301,8 +3840,7 @@ FUnrealMeshTranslator::CreateInputNodeForMeshDescription(
 	}
 
 	// Commit the geo.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-		FHoudiniEngine::Get().GetSession(), NodeId), false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(NodeId), false);
 
 	return true;
 }
@@ -4066,8 +4604,7 @@ FUnrealMeshTranslator::CreateInputNodeForCollider(
 		ColliderNodeId, 0, ColldierFaceCounts.GetData(), 0, ColldierFaceCounts.Num()), false);
 
 	// Commit the geo.
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-		FHoudiniEngine::Get().GetSession(), ColliderNodeId), false);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniEngineUtils::HapiCommitGeo(ColliderNodeId), false);
 
 	OutNodeId = ColliderNodeId;
 
@@ -41,6 +41,37 @@ struct FStaticMeshLODResources;
 struct FMeshDescription;
 struct FKConvexElem;
 
+// Data extracted from a static mesh LOD's render mesh, already converted to Houdini's conventions
+struct FUnrealMeshLODResourcesData
+{
+	bool bIsValid = false;
+
+	uint32 NumVertices = 0;
+	uint32 NumVertexInstances = 0;
+	uint32 NumTriangles = 0;
+	uint32 NumUVLayers = 0;
+	bool bHasColors = false;
+
+	// Point positions: 3 floats per point
+	TArray<float> Positions;
+
+	// Vertex attributes: 3 floats per vertex instance (1 for the alphas), one array per UV layer
+	TArray<TArray<float>> UVs;
+	TArray<float> Normals;
+	TArray<float> Tangents;
+	TArray<float> Binormals;
+	TArray<float> RGBColors;
+	TArray<float> Alphas;
+
+	// Point index of each vertex, and vertex count of each triangle
+	TArray<int32> TriangleVertexIndices;
+	TArray<int32> TriangleVertexCounts;
+
+	// Materials, and the material index of each triangle
+	TArray<UMaterialInterface*> MaterialInterfaces;
+	TArray<int32> TriangleMaterialIndices;
+};
+
 struct HOUDINIENGINE_API FUnrealMeshTranslator
 {
 	public:
@@ -64,6 +95,42 @@ struct HOUDINIENGINE_API FUnrealMeshTranslator
 			UStaticMesh* StaticMesh,
 			UStaticMeshComponent* StaticMeshComponent);
 
+		// Extract the data to send to Houdini from a LOD's render mesh.
+		// This only reads the mesh and component, so it can run on a worker thread while they are kept alive.
+		static bool ExtractStaticMeshLODResources(
+			const FStaticMeshLODResources& LODResources,
+			const int32& InLODIndex,
+			UStaticMesh* StaticMesh,
+			UStaticMeshComponent* StaticMeshComponent,
+			FUnrealMeshLODResourcesData& OutData);
+
+		// Start extracting the LODs of a static mesh (component) on worker threads.
+		// The data will be used by the next CreateInputNodeForStaticMeshLODResources call for that mesh/component/LOD.
+		static void PrefetchStaticMeshLODResources(
+			UStaticMesh* StaticMesh,
+			UStaticMeshComponent* StaticMeshComponent,
+			const bool& ExportAllLODs);
+
+		// Get the prefetched data for a mesh/component/LOD, waiting for its extraction to complete if needed.
+		// Returns false if that LOD hasn't been prefetched.
+		static bool ConsumePrefetchedStaticMeshLODResources(
+			UStaticMesh* StaticMesh,
+			UStaticMeshComponent* StaticMeshComponent,
+			const int32& InLODIndex,
+			FUnrealMeshLODResourcesData& OutData);
+
+		// Wait for all the pending extractions and discard the prefetched data that hasn't been used.
+		// Must be called before the prefetched meshes/components could be garbage collected.
+		static void FlushPrefetchedStaticMeshLODResources();
+
+		// Merge the first LOD of several static mesh components, with their transforms applied, in a single input node.
+		// Each primitive gets the material, name, paths and transform of the component it comes from.
+		// Reuses InOutInputNodeId if it is valid, creates a new input node otherwise.
+		static bool HapiCreateInputNodeForStaticMeshComponents(
+			const TArray<UStaticMeshComponent*>& InComponents,
+			HAPI_NodeId& InOutInputNodeId,
+			const FString& InInputNodeName);
+
 		// Convert the Mesh using FMeshDescription
 		static bool CreateInputNodeForMeshDescription(
 			const HAPI_NodeId& NodeId,
@@ -95,6 +95,8 @@
 #include "UObject/UnrealType.h"
 #include "Math/Box.h"
 #include "Misc/ScopedSlowTask.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
 
 HOUDINI_BAKING_DEFINE_LOG_CATEGORY();
 
@@ -695,41 +697,60 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToFoliage(
 	if (!FoliageInfo)
 		return false;
 
-	int32 CurrentInstanceCount = 0;
+	// Gather the foliage instances first so they can be added in one batch
+	TArray<FFoliageInstance> FoliageInstances;
 	if (SMC->IsA<UInstancedStaticMeshComponent>())
 	{
 		UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>(SMC);
 		const int32 NumInstances = ISMC->GetInstanceCount();
-		for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
+		FoliageInstances.SetNum(NumInstances);
+
+		// Instances whose transform can't be retrieved are skipped
+		TArray<uint8> ValidInstances;
+		ValidInstances.SetNumZeroed(NumInstances);
+
+		// Honour HoudiniEngine.ParallelInstanceTransforms like the runtime instancers (defined in the HoudiniEngine module)
+		const IConsoleVariable* CVarParallelInstanceTransforms =
+			IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.ParallelInstanceTransforms"));
+		const bool bParallel = !CVarParallelInstanceTransforms || CVarParallelInstanceTransforms->GetInt() != 0;
+		ParallelFor(NumInstances, [&](int32 InstanceIndex)
 		{
 			FTransform InstanceTransform;
 			const bool bWorldSpace = true;
 			if (ISMC->GetInstanceTransform(InstanceIndex, InstanceTransform, bWorldSpace))
 			{
-				FFoliageInstance FoliageInstance;
+				FFoliageInstance& FoliageInstance = FoliageInstances[InstanceIndex];
 				FoliageInstance.Location = InstanceTransform.GetLocation();
 				FoliageInstance.Rotation = InstanceTransform.GetRotation().Rotator();
 				FoliageInstance.DrawScale3D = InstanceTransform.GetScale3D();
+				ValidInstances[InstanceIndex] = 1;
+			}
+		}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
 
-				FoliageInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance);
+		int32 NumValidInstances = 0;
+		for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
+		{
+			if (!ValidInstances[InstanceIndex])
+				continue;
 
-				CurrentInstanceCount++;
-			}
+			if (NumValidInstances != InstanceIndex)
+				FoliageInstances[NumValidInstances] = FoliageInstances[InstanceIndex];
+			NumValidInstances++;
 		}
+		FoliageInstances.SetNum(NumValidInstances);
 	}
 	else
 	{
 		const FTransform ComponentToWorldTransform = SMC->GetComponentToWorld();
-		FFoliageInstance FoliageInstance;
+		FFoliageInstance& FoliageInstance = FoliageInstances.AddDefaulted_GetRef();
 		FoliageInstance.Location = ComponentToWorldTransform.GetLocation();
 		FoliageInstance.Rotation = ComponentToWorldTransform.GetRotation().Rotator();
 		FoliageInstance.DrawScale3D = ComponentToWorldTransform.GetScale3D();
-
-		FoliageInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance);
-
-		CurrentInstanceCount++;
 	}
 
+	FHoudiniInstanceTranslator::AddFoliageInstances(InstancedFoliageActor, FoliageType, *FoliageInfo, FoliageInstances);
+	const int32 CurrentInstanceCount = FoliageInstances.Num();
+
 	// TODO: This was due to a bug in UE4.22-20, check if still needed! 
 	if (FoliageInfo->GetComponent())
 		FoliageInfo->GetComponent()->BuildTreeIfOutdated(true, true);
@@ -113,6 +113,80 @@ FHoudiniEngineCommands::RegisterCommands()
 	UI_COMMAND(_PauseAssetCooking, "Pause Houdini Engine Cooking", "When activated, prevents Houdini Engine from cooking assets until unpaused.", EUserInterfaceActionType::Check, FInputChord(EKeys::P, EModifierKey::Control | EModifierKey::Alt));
 }
 
+// Saves a hip file for each started session: the main session is saved to InHIPPath,
+// and pooled session N to "<name>_sessionN.hip" next to it, as the HDAs are spread across them.
+static bool
+SaveHIPFilesForAllSessions(const FString& InHIPPath, TArray<FString>& OutSavedPaths)
+{
+	TArray<int32> SessionIndices;
+	FHoudiniEngine::Get().GetStartedSessionIndices(SessionIndices);
+	for (const int32& SessionIdx : SessionIndices)
+	{
+		const HAPI_Session* CurrentSession = FHoudiniEngine::Get().GetPooledSession(SessionIdx);
+		if (!CurrentSession)
+			continue;
+
+		FString HIPPath = InHIPPath;
+		if (SessionIdx > 0)
+			HIPPath = FPaths::GetPath(InHIPPath) / FPaths::GetBaseFilename(InHIPPath) + FString::Printf(TEXT("_session%d.hip"), SessionIdx);
+
+		// Save HIP file through Engine.
+		std::string HIPPathConverted(TCHAR_TO_UTF8(*HIPPath));
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::SaveHIPFile(CurrentSession, HIPPathConverted.c_str(), false))
+		{
+			HOUDINI_LOG_ERROR(TEXT("Failed to save the Houdini scene of session %d to %s"), SessionIdx, *HIPPath);
+			continue;
+		}
+
+		OutSavedPaths.Add(HIPPath);
+	}
+
+	return OutSavedPaths.Num() > 0;
+}
+
+// Opens the given hip file in a new Houdini process
+static bool
+OpenHIPFileInHoudini(const FString& InHIPPath)
+{
+	// Add quotes to the path to avoid issues with spaces
+	FString QuotedHIPPath = TEXT("\"") + InHIPPath + TEXT("\"");
+
+	// Then open the hip file in Houdini
+	FString LibHAPILocation = FHoudiniEngine::Get().GetLibHAPILocation();
+	FString HoudiniExecutable = FHoudiniEngine::Get().GetHoudiniExecutable();
+	FString HoudiniLocation = LibHAPILocation + TEXT("//") + HoudiniExecutable;
+
+	FProcHandle ProcHandle = FPlatformProcess::CreateProc(
+		*HoudiniLocation,
+		*QuotedHIPPath,
+		true, false, false,
+		nullptr, 0,
+		FPlatformProcess::UserTempDir(),
+		nullptr, nullptr);
+
+	if (!ProcHandle.IsValid())
+	{
+		// Try with the steam version executable instead
+		HoudiniLocation = LibHAPILocation + TEXT("//hindie.steam");
+
+		ProcHandle = FPlatformProcess::CreateProc(
+			*HoudiniLocation,
+			*QuotedHIPPath,
+			true, false, false,
+			nullptr, 0,
+			FPlatformProcess::UserTempDir(),
+			nullptr, nullptr);
+
+		if (!ProcHandle.IsValid())
+		{
+			HOUDINI_LOG_ERROR(TEXT("Failed to open scene in Houdini."));
+			return false;
+		}
+	}
+
+	return true;
+}
+
 void
 FHoudiniEngineCommands::SaveHIPFile()
 {
@@ -150,14 +224,13 @@ FHoudiniEngineCommands::SaveHIPFile()
 		FString Notification = TEXT("Saving internal Houdini scene...");
 		FHoudiniEngineUtils::CreateSlateNotification(Notification);
 
-		// ... and a log message
-		HOUDINI_LOG_MESSAGE(TEXT("Saved Houdini scene to %s"), *SaveFilenames[0]);
-
-		// Get first path.
-		std::string HIPPathConverted(TCHAR_TO_UTF8(*SaveFilenames[0]));
+		// Save the first path, one file per session if the session pool is used
+		TArray<FString> SavedPaths;
+		SaveHIPFilesForAllSessions(SaveFilenames[0], SavedPaths);
 
-		// Save HIP file through Engine.
-		FHoudiniApi::SaveHIPFile(FHoudiniEngine::Get().GetSession(), HIPPathConverted.c_str(), false);
+		// ... and a log message
+		for (const FString& SavedPath : SavedPaths)
+			HOUDINI_LOG_MESSAGE(TEXT("Saved Houdini scene to %s"), *SavedPath);
 	}
 }
 
@@ -176,56 +249,26 @@ FHoudiniEngineCommands::OpenInHoudini()
 		FPlatformProcess::UserTempDir(),
 		TEXT("HoudiniEngine"), TEXT(".hip"));
 
-	// Save HIP file through Engine.
-	std::string TempPathConverted(TCHAR_TO_UTF8(*UserTempPath));
-	FHoudiniApi::SaveHIPFile(
-		FHoudiniEngine::Get().GetSession(),
-		TempPathConverted.c_str(), false);
-
-	if (!FPaths::FileExists(UserTempPath))
-		return;
+	// Save HIP file through Engine, one file per session if the session pool is used
+	TArray<FString> SavedPaths;
+	SaveHIPFilesForAllSessions(UserTempPath, SavedPaths);
 
 	// Add a slate notification
-	FString Notification = TEXT("Opening scene in Houdini...");
-	FHoudiniEngineUtils::CreateSlateNotification(Notification);
-
-	// Add quotes to the path to avoid issues with spaces
-	UserTempPath = TEXT("\"") + UserTempPath + TEXT("\"");
-
-	// Then open the hip file in Houdini
-	FString LibHAPILocation = FHoudiniEngine::Get().GetLibHAPILocation();
-	FString HoudiniExecutable = FHoudiniEngine::Get().GetHoudiniExecutable();
-	FString HoudiniLocation = LibHAPILocation + TEXT("//") + HoudiniExecutable;
-
-	FProcHandle ProcHandle = FPlatformProcess::CreateProc(
-		*HoudiniLocation,
-		*UserTempPath,
-		true, false, false,
-		nullptr, 0,
-		FPlatformProcess::UserTempDir(),
-		nullptr, nullptr);
-
-	if (!ProcHandle.IsValid())
+	if (SavedPaths.Num() > 0)
 	{
-		// Try with the steam version executable instead
-		HoudiniLocation = LibHAPILocation + TEXT("//hindie.steam");
+		FString Notification = TEXT("Opening scene in Houdini...");
+		FHoudiniEngineUtils::CreateSlateNotification(Notification);
+	}
 
-		ProcHandle = FPlatformProcess::CreateProc(
-			*HoudiniLocation,
-			*UserTempPath,
-			true, false, false,
-			nullptr, 0,
-			FPlatformProcess::UserTempDir(),
-			nullptr, nullptr);
+	// Then open each hip file in Houdini
+	for (const FString& SavedPath : SavedPaths)
+	{
+		if (!FPaths::FileExists(SavedPath) || !OpenHIPFileInHoudini(SavedPath))
+			continue;
 
-		if (!ProcHandle.IsValid())
-		{
-			HOUDINI_LOG_ERROR(TEXT("Failed to open scene in Houdini."));
-		}
+		// ... and a log message
+		HOUDINI_LOG_MESSAGE(TEXT("Opened scene in Houdini."));
 	}
-
-	// ... and a log message
-	HOUDINI_LOG_MESSAGE(TEXT("Opened scene in Houdini."));
 }
 
 void
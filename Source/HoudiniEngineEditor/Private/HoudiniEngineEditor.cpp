@@ -32,6 +32,7 @@
 #include "HoudiniEngineStyle.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEngine.h"
+#include "HoudiniEngineRuntime.h"
 #include "HoudiniAsset.h"
 #include "HoudiniAssetBroker.h"
 #include "HoudiniAssetActorFactory.h"
@@ -39,6 +40,7 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniAssetComponentDetails.h"
 #include "HoudiniInput.h"
+#include "HoudiniInputObject.h"
 #include "HoudiniOutput.h"
 #include "HoudiniParameter.h"
 #include "HoudiniEngineUtils.h"
@@ -67,6 +69,10 @@
 #include "Editor.h"
 #include "UnrealEdGlobals.h"
 #include "Engine/Selection.h"
+#include "LandscapeComponent.h"
+#include "LandscapeInfo.h"
+#include "LandscapeProxy.h"
+#include "Misc/TransactionObjectEvent.h"
 #include "Widgets/Input/SCheckBox.h"
 #include "Logging/LogMacros.h"
 
@@ -1339,6 +1345,7 @@ FHoudiniEngineEditor::RegisterEditorDelegates()
 
 	OnDeleteActorsBegin = FEditorDelegates::OnDeleteActorsBegin.AddLambda([this](){ this->HandleOnDeleteActorsBegin(); });
 	OnDeleteActorsEnd = FEditorDelegates::OnDeleteActorsEnd.AddLambda([this](){ this-> HandleOnDeleteActorsEnd(); });
+	OnObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddRaw(this, &FHoudiniEngineEditor::HandleOnObjectTransacted);
 }
 
 void
@@ -1358,6 +1365,9 @@ FHoudiniEngineEditor::UnregisterEditorDelegates()
 
 	if (OnDeleteActorsEnd.IsValid())
 		FEditorDelegates::OnDeleteActorsEnd.Remove(OnDeleteActorsEnd);
+
+	if (OnObjectTransactedHandle.IsValid())
+		FCoreUObjectDelegates::OnObjectTransacted.Remove(OnObjectTransactedHandle);
 }
 
 FString 
@@ -1561,4 +1571,71 @@ FHoudiniEngineEditor::HandleOnDeleteActorsEnd()
 	ActorsToReselectOnDeleteActorsEnd.Empty();
 }
 
+void
+FHoudiniEngineEditor::HandleOnObjectTransacted(UObject* InObject, const FTransactionObjectEvent& InTransactionEvent)
+{
+	// Only consider finished edits (and their undo/redo), not the intermediate snapshots
+	if (InTransactionEvent.GetEventType() != ETransactionObjectEventType::Finalized
+		&& InTransactionEvent.GetEventType() != ETransactionObjectEventType::UndoRedo)
+		return;
+
+	// Sculpting and painting transact the modified landscape components
+	ULandscapeComponent* LandscapeComponent = Cast<ULandscapeComponent>(InObject);
+	if (!IsValid(LandscapeComponent))
+		return;
+
+	ULandscapeInfo* LandscapeInfo = LandscapeComponent->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return;
+
+	int32 MinX = MAX_int32;
+	int32 MinY = MAX_int32;
+	int32 MaxX = -MAX_int32;
+	int32 MaxY = -MAX_int32;
+	LandscapeComponent->GetComponentExtent(MinX, MinY, MaxX, MaxY);
+	const FIntRect DirtyRegion(MinX, MinY, MaxX, MaxY);
+
+	const int32 NumComponents = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
+	for (int32 CompIdx = 0; CompIdx < NumComponents; CompIdx++)
+	{
+		UHoudiniAssetComponent* HAC = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(CompIdx);
+		if (!IsValid(HAC))
+			continue;
+
+		for (UHoudiniInput* CurrentInput : HAC->GetInputs())
+		{
+			if (!IsValid(CurrentInput))
+				continue;
+
+			TArray<UHoudiniInputObject*>* InputObjects = CurrentInput->GetHoudiniInputObjectArray(CurrentInput->GetInputType());
+			if (!InputObjects)
+				continue;
+
+			bool bInputChanged = false;
+			for (UHoudiniInputObject* CurrentInputObject : *InputObjects)
+			{
+				UHoudiniInputLandscape* InputLandscape = Cast<UHoudiniInputLandscape>(CurrentInputObject);
+				if (!IsValid(InputLandscape))
+					continue;
+
+				ALandscapeProxy* LandscapeProxy = InputLandscape->GetLandscapeProxy();
+				if (!IsValid(LandscapeProxy) || LandscapeProxy->GetLandscapeInfo() != LandscapeInfo)
+					continue;
+
+				if (!InputLandscape->MarkRegionDirty(DirtyRegion))
+					continue;
+
+				InputLandscape->MarkChanged(true);
+				bInputChanged = true;
+			}
+
+			if (bInputChanged)
+			{
+				CurrentInput->MarkChanged(true);
+				CurrentInput->MarkDataUploadNeeded(true);
+			}
+		}
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
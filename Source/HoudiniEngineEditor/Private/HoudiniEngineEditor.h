@@ -235,6 +235,11 @@ class HOUDINIENGINEEDITOR_API FHoudiniEngineEditor : public IHoudiniEngineEditor
 		// Re-select AHoudiniAssetActors that were deselected (to avoid deletion) by HandleOnDeleteActorsBegin 
 		void HandleOnDeleteActorsEnd();
 
+		// Process the OnObjectTransacted call received from FCoreUObjectDelegates.
+		// Mark the regions of landscapes that were sculpted/painted as dirty on the landscape inputs using them,
+		// so that only those regions have to be uploaded again.
+		void HandleOnObjectTransacted(UObject* InObject, const class FTransactionObjectEvent& InTransactionEvent);
+
 	private:
 
 		// Singleton instance of Houdini Engine Editor.
@@ -342,6 +347,9 @@ class HOUDINIENGINEEDITOR_API FHoudiniEngineEditor : public IHoudiniEngineEditor
 		// Delegate handle for OnDeleteActorsEnd
 		FDelegateHandle OnDeleteActorsEnd;
 
+		// Delegate handle for OnObjectTransacted
+		FDelegateHandle OnObjectTransactedHandle;
+
 		// List of actors that HandleOnDeleteActorsBegin marked to _not_ be deleted. This
 		// is used to re-select these actors in HandleOnDeleteActorsEnd.
 		TArray<AActor*> ActorsToReselectOnDeleteActorsEnd;
@@ -159,6 +159,12 @@ FHoudiniInputDetails::CreateWidget(
 		AddExportCheckboxes(VerticalBox, InInputs);
 	}
 
+	if (MainInputType == EHoudiniInputType::World)
+	{
+		// Checkbox : Consolidate static meshes
+		AddConsolidateWorldInputCheckbox(VerticalBox, InInputs);
+	}
+
 	switch (MainInput->GetInputType())
 	{
 		case EHoudiniInputType::Geometry:
@@ -576,6 +582,82 @@ FHoudiniInputDetails::AddPackBeforeMergeCheckbox(TSharedRef< SVerticalBox > Vert
 	];
 }
 
+void
+FHoudiniInputDetails::AddConsolidateWorldInputCheckbox(TSharedRef< SVerticalBox > VerticalBox, TArray<UHoudiniInput*>& InInputs)
+{
+	if (InInputs.Num() <= 0)
+		return;
+
+	UHoudiniInput* MainInput = InInputs[0];
+
+	if (!IsValid(MainInput))
+		return;
+
+	// Lambda returning a CheckState from the input's current ConsolidateWorldInput state
+	auto IsCheckedConsolidateWorldInput = [](UHoudiniInput* InInput)
+	{
+		if (!IsValid(InInput))
+			return ECheckBoxState::Unchecked;
+
+		return InInput->GetConsolidateWorldInput() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+	};
+
+	// Lambda for changing ConsolidateWorldInput state
+	auto CheckStateChangedConsolidateWorldInput = [MainInput](TArray<UHoudiniInput*> InInputsToUpdate, ECheckBoxState NewState)
+	{
+		if (!IsValid(MainInput))
+			return;
+
+		bool bNewState = (NewState == ECheckBoxState::Checked);
+
+		if (MainInput->GetConsolidateWorldInput() == bNewState)
+			return;
+
+		// Record a transaction for undo/redo
+		FScopedTransaction Transaction(
+			TEXT(HOUDINI_MODULE_EDITOR),
+			LOCTEXT("HoudiniInputChange", "Houdini Input: Changing Consolidate static meshes"),
+			MainInput->GetOuter());
+
+		for (auto CurInput : InInputsToUpdate)
+		{
+			if (!IsValid(CurInput))
+				continue;
+
+			if (CurInput->GetConsolidateWorldInput() == bNewState)
+				continue;
+
+			CurInput->Modify();
+
+			// All the objects need to be resent, either merged or separately
+			CurInput->SetConsolidateWorldInput(bNewState);
+			CurInput->MarkChanged(true);
+			CurInput->MarkAllInputObjectsChanged(true);
+		}
+	};
+
+	TSharedPtr< SCheckBox > CheckBoxConsolidateWorldInput;
+	VerticalBox->AddSlot().Padding( 2, 2, 5, 2 ).AutoHeight()
+	[
+		SAssignNew( CheckBoxConsolidateWorldInput, SCheckBox )
+		.Content()
+		[
+			SNew( STextBlock )
+			.Text( LOCTEXT( "ConsolidateWorldInputCheckbox", "Consolidate Static Meshes" ) )
+			.ToolTipText( LOCTEXT( "ConsolidateWorldInputCheckboxTip", "Merge all the static mesh components in a single input node instead of creating one node per component. Faster to upload large selections, the components are identified by per primitive name, path and component index attributes, and their transforms are stored once per component in a detail attribute. Only the first LOD of the meshes is sent: when exporting LODs, sockets or colliders, one node per component is used instead." ) )
+			.Font( FEditorStyle::GetFontStyle( TEXT( "PropertyWindow.NormalFont" ) ) )
+		]
+		.IsChecked_Lambda([=]()
+		{
+			return IsCheckedConsolidateWorldInput(MainInput);
+		})
+		.OnCheckStateChanged_Lambda([=](ECheckBoxState NewState)
+		{
+			return CheckStateChangedConsolidateWorldInput(InInputs, NewState);
+		})
+	];
+}
+
 void
 FHoudiniInputDetails::AddImportAsReferenceCheckbox(TSharedRef< SVerticalBox > VerticalBox, TArray<UHoudiniInput*>& InInputs)
 {
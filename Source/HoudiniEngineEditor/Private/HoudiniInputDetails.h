@@ -82,6 +82,11 @@ class FHoudiniInputDetails : public TSharedFromThis<FHoudiniInputDetails, ESPMod
 			TSharedRef< SVerticalBox > VerticalBox,
 			TArray<UHoudiniInput*>& InInputs);
 
+		// Checkbox : Consolidate the world input's static meshes in a single node
+		static void AddConsolidateWorldInputCheckbox(
+			TSharedRef<SVerticalBox> InVerticalBox,
+			TArray<UHoudiniInput*>& InInputs);
+
 		// Checkboxes : Export LODs / Sockets / Collisions
 		static void AddExportCheckboxes(
 			TSharedRef<SVerticalBox> InVerticalBox,
@@ -91,6 +91,9 @@ FHoudiniPDGDetails::AddPDGAssetWidget(
 	// Commandlet Status row
 	AddPDGCommandletStatus(InPDGCategory, FHoudiniEngine::Get().GetPDGCommandletStatus());
 
+	// Work result import queue row
+	AddPDGImportQueueStatus(InPDGCategory, InPDGAssetLink);
+
 	// REFRESH / RESET Buttons
 	{
 		TSharedRef<SHorizontalBox> RefreshHBox = SNew(SHorizontalBox);
@@ -649,6 +652,50 @@ FHoudiniPDGDetails::AddPDGCommandletStatus(
     ];
 }
 
+void
+FHoudiniPDGDetails::AddPDGImportQueueStatus(
+	IDetailCategoryBuilder& InPDGCategory, UHoudiniPDGAssetLink* InPDGAssetLink)
+{
+	FDetailWidgetRow& PDGImportQueueRow = InPDGCategory.AddCustomRow(FText::GetEmpty())
+	.WholeRowContent()
+	[
+		SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot()
+		.FillWidth(1.0f)
+		.Padding(2.0f, 0.0f)
+		.VAlign(VAlign_Center)
+		.HAlign(HAlign_Center)
+		[
+			SNew(STextBlock)
+			.Visibility_Lambda([InPDGAssetLink]()
+			{
+				// Only show the import queue while work result objects are waiting or being loaded
+				if (!IsValid(InPDGAssetLink))
+					return EVisibility::Collapsed;
+
+				const bool bImporting = InPDGAssetLink->NumWorkResultObjectsQueued > 0 || InPDGAssetLink->NumWorkResultObjectsLoading > 0;
+				return bImporting ? EVisibility::Visible : EVisibility::Collapsed;
+			})
+			.Text_Lambda([InPDGAssetLink]()
+			{
+				if (!IsValid(InPDGAssetLink))
+					return FText::GetEmpty();
+
+				return FText::FromString(FString::Printf(
+					TEXT("Loading work results: %d queued, %d loading"),
+					InPDGAssetLink->NumWorkResultObjectsQueued,
+					InPDGAssetLink->NumWorkResultObjectsLoading));
+			})
+			.ColorAndOpacity_Lambda([InPDGAssetLink]()
+			{
+				// Highlight the queue when it is backing up
+				const bool bBackedUp = IsValid(InPDGAssetLink) && InPDGAssetLink->NumWorkResultObjectsQueued > 0;
+				return FSlateColor(bBackedUp ? FLinearColor::Yellow : FLinearColor::White);
+			})
+		]
+	];
+}
+
 bool
 FHoudiniPDGDetails::GetWorkItemTallyValueAndColor(
 	UHoudiniPDGAssetLink* InAssetLink,
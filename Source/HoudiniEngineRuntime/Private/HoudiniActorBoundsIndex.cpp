@@ -0,0 +1,385 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniActorBoundsIndex.h"
+
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+#include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineDefines.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectGlobals.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineWorldInputSpatialIndex(
+	TEXT("HoudiniEngine.WorldInputSpatialIndex"),
+	1,
+	TEXT("Use a spatial index of the actor bounds when updating the world inputs bound selectors.\n")
+	TEXT("0: Test the bounds of every actor in the world.\n")
+	TEXT("1: Query an octree of the actor bounds, updated from the actor events (default).\n")
+);
+
+TMap<TWeakObjectPtr<UWorld>, TUniquePtr<FHoudiniActorBoundsOctree>> FHoudiniActorBoundsIndex::Octrees;
+bool FHoudiniActorBoundsIndex::bDelegatesRegistered = false;
+FDelegateHandle FHoudiniActorBoundsIndex::OnActorMovedHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::OnLevelActorAddedHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::OnLevelActorDeletedHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::OnObjectPropertyChangedHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::OnObjectTransactedHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::OnComponentRenderStateDirtyHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::OnComponentCreatePhysicsHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::OnComponentDestroyPhysicsHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::OnLevelAddedToWorldHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::OnLevelRemovedFromWorldHandle;
+FDelegateHandle FHoudiniActorBoundsIndex::OnPostWorldCleanupHandle;
+
+void
+FHoudiniActorBoundsOctreeSemantics::SetElementId(FOctree& InOctree, const FHoudiniActorBoundsElement& InElement, FOctreeElementId2 InId)
+{
+	InOctree.ActorElementIds.Add(InElement.Actor, InId);
+}
+
+FHoudiniActorBoundsOctree::FHoudiniActorBoundsOctree()
+	: TOctree2<FHoudiniActorBoundsElement, FHoudiniActorBoundsOctreeSemantics>(FVector::ZeroVector, HALF_WORLD_MAX)
+{
+}
+
+FHoudiniActorBoundsOctree::~FHoudiniActorBoundsOctree()
+{
+	// Unbind from the components that are still alive
+	for (auto& CurPair : ComponentTransformHandles)
+	{
+		USceneComponent* CurComponent = CurPair.Key.Get();
+		if (CurComponent)
+			CurComponent->TransformUpdated.Remove(CurPair.Value);
+	}
+}
+
+bool
+FHoudiniActorBoundsIndex::IsEnabled()
+{
+#if WITH_EDITOR
+	// The index relies on the editor's actor events to stay up to date
+	return CVarHoudiniEngineWorldInputSpatialIndex.GetValueOnGameThread() != 0;
+#else
+	return false;
+#endif
+}
+
+bool
+FHoudiniActorBoundsIndex::FindActorsIntersectingBounds(
+	UWorld* InWorld,
+	const TArray<FBox>& InBounds,
+	TArray<AActor*>& OutActors)
+{
+	check(IsInGameThread());
+
+	if (!IsEnabled() || !IsValid(InWorld))
+		return false;
+
+	FHoudiniActorBoundsOctree* Octree = GetOctree(InWorld);
+	if (!Octree)
+		return false;
+
+	TSet<AActor*> FoundActors;
+	for (const FBox& CurBounds : InBounds)
+	{
+		Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(CurBounds), [&](const FHoudiniActorBoundsElement& InElement)
+		{
+			AActor* CurActor = InElement.Actor.Get();
+			if (!IsValid(CurActor))
+				return;
+
+			// The octree test is conservative, do the exact test on the boxes
+			if (!InElement.Bounds.Intersect(CurBounds))
+				return;
+
+			bool bAlreadyFound = false;
+			FoundActors.Add(CurActor, &bAlreadyFound);
+			if (bAlreadyFound)
+				return;
+
+			OutActors.Add(CurActor);
+		});
+	}
+
+	return true;
+}
+
+FHoudiniActorBoundsOctree*
+FHoudiniActorBoundsIndex::GetOctree(UWorld* InWorld)
+{
+	RegisterDelegates();
+
+	TUniquePtr<FHoudiniActorBoundsOctree>& Octree = Octrees.FindOrAdd(InWorld);
+	if (!Octree.IsValid())
+		Octree = MakeUnique<FHoudiniActorBoundsOctree>();
+
+	if (Octree->bNeedsRebuild)
+	{
+		// (Re)build the whole index from the world's actors
+		Octree = MakeUnique<FHoudiniActorBoundsOctree>();
+		for (TActorIterator<AActor> ActorItr(InWorld); ActorItr; ++ActorItr)
+		{
+			AActor* CurActor = *ActorItr;
+			if (IsValid(CurActor))
+				UpdateActor(*Octree, CurActor);
+		}
+
+		Octree->bNeedsRebuild = false;
+		return Octree.Get();
+	}
+
+	// Update the actors that have changed since the last query
+	for (const TWeakObjectPtr<AActor>& CurActor : Octree->DirtyActors)
+	{
+		if (IsValid(CurActor.Get()) && CurActor->GetWorld() == InWorld)
+			UpdateActor(*Octree, CurActor.Get());
+		else
+			RemoveActor(*Octree, CurActor);
+	}
+	Octree->DirtyActors.Empty();
+
+	return Octree.Get();
+}
+
+void
+FHoudiniActorBoundsIndex::UpdateActor(FHoudiniActorBoundsOctree& InOctree, AActor* InActor)
+{
+	FHoudiniActorBoundsElement Element;
+	Element.Actor = InActor;
+	Element.Bounds = InActor->GetComponentsBoundingBox(true);
+	Element.CenterAndExtent = FBoxCenterAndExtent(Element.Bounds);
+
+	// Track the transform updates of the actor's components (scripted moves, attached components...)
+	TInlineComponentArray<USceneComponent*> SceneComponents;
+	InActor->GetComponents(SceneComponents);
+	for (USceneComponent* CurComponent : SceneComponents)
+	{
+		if (!CurComponent || InOctree.ComponentTransformHandles.Contains(CurComponent))
+			continue;
+
+		InOctree.ComponentTransformHandles.Add(
+			CurComponent, CurComponent->TransformUpdated.AddStatic(&FHoudiniActorBoundsIndex::OnComponentTransformUpdated));
+	}
+
+	// Nothing to do if the bounds haven't changed
+	const FOctreeElementId2* ElementId = InOctree.ActorElementIds.Find(InActor);
+	if (ElementId && InOctree.IsValidElementId(*ElementId))
+	{
+		const FHoudiniActorBoundsElement& Existing = InOctree.GetElementById(*ElementId);
+		if (Existing.Bounds.Min == Element.Bounds.Min && Existing.Bounds.Max == Element.Bounds.Max)
+			return;
+	}
+
+	RemoveActor(InOctree, InActor);
+	InOctree.AddElement(Element);
+}
+
+void
+FHoudiniActorBoundsIndex::RemoveActor(FHoudiniActorBoundsOctree& InOctree, const TWeakObjectPtr<AActor>& InActor)
+{
+	FOctreeElementId2 ElementId;
+	if (!InOctree.ActorElementIds.RemoveAndCopyValue(InActor, ElementId))
+		return;
+
+	if (InOctree.IsValidElementId(ElementId))
+		InOctree.RemoveElement(ElementId);
+}
+
+void
+FHoudiniActorBoundsIndex::MarkActorDirty(AActor* InActor)
+{
+	// The indexes are only accessed from the game thread
+	if (!InActor || !IsInGameThread())
+		return;
+
+	UWorld* World = InActor->GetWorld();
+	if (!World)
+		return;
+
+	// Only track the worlds that have been queried
+	TUniquePtr<FHoudiniActorBoundsOctree>* Octree = Octrees.Find(World);
+	if (Octree && Octree->IsValid())
+		(*Octree)->DirtyActors.Add(InActor);
+}
+
+void
+FHoudiniActorBoundsIndex::OnActorChanged(AActor* InActor)
+{
+	MarkActorDirty(InActor);
+}
+
+void
+FHoudiniActorBoundsIndex::OnComponentChanged(UActorComponent* InComponent)
+{
+	// Components added/removed/re-registered change their owner's bounds
+	if (InComponent)
+		MarkActorDirty(InComponent->GetOwner());
+}
+
+void
+FHoudiniActorBoundsIndex::OnComponentRenderStateDirty(UActorComponent& InComponent)
+{
+	MarkActorDirty(InComponent.GetOwner());
+}
+
+void
+FHoudiniActorBoundsIndex::OnComponentTransformUpdated(USceneComponent* InComponent, EUpdateTransformFlags InFlags, ETeleportType InTeleport)
+{
+	if (InComponent)
+		MarkActorDirty(InComponent->GetOwner());
+}
+
+void
+FHoudiniActorBoundsIndex::OnActorDeleted(AActor* InActor)
+{
+	if (!InActor)
+		return;
+
+	// The actor might already have been removed from its world, so look for it in all indexes
+	for (auto& CurPair : Octrees)
+	{
+		if (CurPair.Value.IsValid() && CurPair.Value->ActorElementIds.Contains(InActor))
+			CurPair.Value->DirtyActors.Add(InActor);
+	}
+}
+
+void
+FHoudiniActorBoundsIndex::OnObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InPropertyChangedEvent)
+{
+	// Editing an actor or one of its components might change its bounds
+	if (AActor* Actor = Cast<AActor>(InObject))
+	{
+		MarkActorDirty(Actor);
+	}
+	else if (UActorComponent* Component = Cast<UActorComponent>(InObject))
+	{
+		MarkActorDirty(Component->GetOwner());
+	}
+}
+
+#if WITH_EDITOR
+void
+FHoudiniActorBoundsIndex::OnObjectTransacted(UObject* InObject, const FTransactionObjectEvent& InTransactionEvent)
+{
+	// Undo/redo can restore deleted actors or change their transform without any other event
+	if (AActor* Actor = Cast<AActor>(InObject))
+	{
+		MarkActorDirty(Actor);
+	}
+	else if (UActorComponent* Component = Cast<UActorComponent>(InObject))
+	{
+		MarkActorDirty(Component->GetOwner());
+	}
+}
+#endif
+
+void
+FHoudiniActorBoundsIndex::OnLevelChanged(ULevel* InLevel, UWorld* InWorld)
+{
+	TUniquePtr<FHoudiniActorBoundsOctree>* Octree = Octrees.Find(InWorld);
+	if (Octree && Octree->IsValid())
+		(*Octree)->bNeedsRebuild = true;
+}
+
+void
+FHoudiniActorBoundsIndex::OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources)
+{
+	Octrees.Remove(InWorld);
+
+	// Also get rid of the indexes of the worlds that have already been destroyed
+	for (auto Iter = Octrees.CreateIterator(); Iter; ++Iter)
+	{
+		if (!Iter.Key().IsValid())
+			Iter.RemoveCurrent();
+	}
+}
+
+void
+FHoudiniActorBoundsIndex::RegisterDelegates()
+{
+	if (bDelegatesRegistered)
+		return;
+
+#if WITH_EDITOR
+	if (GEngine)
+	{
+		OnActorMovedHandle = GEngine->OnActorMoved().AddStatic(&FHoudiniActorBoundsIndex::OnActorChanged);
+		OnLevelActorAddedHandle = GEngine->OnLevelActorAdded().AddStatic(&FHoudiniActorBoundsIndex::OnActorChanged);
+		OnLevelActorDeletedHandle = GEngine->OnLevelActorDeleted().AddStatic(&FHoudiniActorBoundsIndex::OnActorDeleted);
+	}
+
+	OnObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddStatic(&FHoudiniActorBoundsIndex::OnObjectPropertyChanged);
+	OnObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddStatic(&FHoudiniActorBoundsIndex::OnObjectTransacted);
+
+	OnComponentRenderStateDirtyHandle = UActorComponent::MarkRenderStateDirtyEvent.AddStatic(&FHoudiniActorBoundsIndex::OnComponentRenderStateDirty);
+	OnComponentCreatePhysicsHandle = UActorComponent::GlobalCreatePhysicsDelegate.AddStatic(&FHoudiniActorBoundsIndex::OnComponentChanged);
+	OnComponentDestroyPhysicsHandle = UActorComponent::GlobalDestroyPhysicsDelegate.AddStatic(&FHoudiniActorBoundsIndex::OnComponentChanged);
+#endif
+
+	OnLevelAddedToWorldHandle = FWorldDelegates::LevelAddedToWorld.AddStatic(&FHoudiniActorBoundsIndex::OnLevelChanged);
+	OnLevelRemovedFromWorldHandle = FWorldDelegates::LevelRemovedFromWorld.AddStatic(&FHoudiniActorBoundsIndex::OnLevelChanged);
+	OnPostWorldCleanupHandle = FWorldDelegates::OnPostWorldCleanup.AddStatic(&FHoudiniActorBoundsIndex::OnWorldCleanup);
+
+	bDelegatesRegistered = true;
+}
+
+void
+FHoudiniActorBoundsIndex::Shutdown()
+{
+	if (bDelegatesRegistered)
+	{
+#if WITH_EDITOR
+		if (GEngine)
+		{
+			GEngine->OnActorMoved().Remove(OnActorMovedHandle);
+			GEngine->OnLevelActorAdded().Remove(OnLevelActorAddedHandle);
+			GEngine->OnLevelActorDeleted().Remove(OnLevelActorDeletedHandle);
+		}
+
+		FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(OnObjectPropertyChangedHandle);
+		FCoreUObjectDelegates::OnObjectTransacted.Remove(OnObjectTransactedHandle);
+
+		UActorComponent::MarkRenderStateDirtyEvent.Remove(OnComponentRenderStateDirtyHandle);
+		UActorComponent::GlobalCreatePhysicsDelegate.Remove(OnComponentCreatePhysicsHandle);
+		UActorComponent::GlobalDestroyPhysicsDelegate.Remove(OnComponentDestroyPhysicsHandle);
+#endif
+
+		FWorldDelegates::LevelAddedToWorld.Remove(OnLevelAddedToWorldHandle);
+		FWorldDelegates::LevelRemovedFromWorld.Remove(OnLevelRemovedFromWorldHandle);
+		FWorldDelegates::OnPostWorldCleanup.Remove(OnPostWorldCleanupHandle);
+
+		bDelegatesRegistered = false;
+	}
+
+	Octrees.Empty();
+}
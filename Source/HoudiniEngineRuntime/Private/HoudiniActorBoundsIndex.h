@@ -0,0 +1,168 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/GenericOctree.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+class UActorComponent;
+class USceneComponent;
+class UObject;
+class UWorld;
+class ULevel;
+struct FPropertyChangedEvent;
+class FTransactionObjectEvent;
+enum class EUpdateTransformFlags : int32;
+enum class ETeleportType : uint8;
+
+// Actor stored in the bounds octree
+struct FHoudiniActorBoundsElement
+{
+	TWeakObjectPtr<AActor> Actor;
+
+	// The actor's components bounding box when it was indexed
+	FBox Bounds = FBox(ForceInit);
+	FBoxCenterAndExtent CenterAndExtent;
+};
+
+class FHoudiniActorBoundsOctree;
+
+struct FHoudiniActorBoundsOctreeSemantics
+{
+	typedef FHoudiniActorBoundsOctree FOctree;
+
+	enum { MaxElementsPerLeaf = 16 };
+	enum { MinInclusiveElementsPerNode = 7 };
+	enum { MaxNodeDepth = 12 };
+
+	typedef TInlineAllocator<MaxElementsPerLeaf> ElementAllocator;
+
+	FORCEINLINE static const FBoxCenterAndExtent& GetBoundingBox(const FHoudiniActorBoundsElement& InElement)
+	{
+		return InElement.CenterAndExtent;
+	}
+
+	FORCEINLINE static bool AreElementsEqual(const FHoudiniActorBoundsElement& A, const FHoudiniActorBoundsElement& B)
+	{
+		return A.Actor == B.Actor;
+	}
+
+	static void SetElementId(FOctree& InOctree, const FHoudiniActorBoundsElement& InElement, FOctreeElementId2 InId);
+};
+
+// Loose octree of the actor bounds of a world
+class FHoudiniActorBoundsOctree : public TOctree2<FHoudiniActorBoundsElement, FHoudiniActorBoundsOctreeSemantics>
+{
+	public:
+
+		FHoudiniActorBoundsOctree();
+		~FHoudiniActorBoundsOctree();
+
+		// Element id of each indexed actor, kept up to date by the octree when elements move between nodes
+		TMap<TWeakObjectPtr<AActor>, FOctreeElementId2> ActorElementIds;
+
+		// Actors that need their bounds to be updated before the next query
+		TSet<TWeakObjectPtr<AActor>> DirtyActors;
+
+		// TransformUpdated handles bound on the components of the indexed actors
+		TMap<TWeakObjectPtr<USceneComponent>, FDelegateHandle> ComponentTransformHandles;
+
+		// Indicates the whole index must be rebuilt before the next query (ie. a level was added/removed)
+		bool bNeedsRebuild = true;
+};
+
+// Maintains a spatial index of the actor bounds of the editor worlds, used by the world input bound selectors.
+// The index is built lazily on the first query for a world, and then updated incrementally
+// from the actor added/moved/deleted events, the transform updates of the indexed actors' components,
+// the components render state and physics state changes, and the HACs output updates:
+// the actors are only marked dirty by the events, and their bounds are recomputed on the next query.
+// Not tracked: non-colliding components added to an actor in code without a render state change,
+// their actor is only updated on its next event.
+struct HOUDINIENGINERUNTIME_API FHoudiniActorBoundsIndex
+{
+	public:
+
+		// Returns all the actors of the world whose bounds intersect one of the given boxes.
+		// Returns false if the index can't be used, in which case the caller should iterate over the world's actors.
+		static bool FindActorsIntersectingBounds(
+			UWorld* InWorld,
+			const TArray<FBox>& InBounds,
+			TArray<AActor*>& OutActors);
+
+		// Indicates if the spatial index should be used
+		static bool IsEnabled();
+
+		// Unregisters the delegates and releases the indexes
+		static void Shutdown();
+
+		// Marks an actor as needing an update in its world's index
+		static void MarkActorDirty(AActor* InActor);
+
+	protected:
+
+		static void RegisterDelegates();
+
+		// Get the index for a world, creating / rebuilding it if needed
+		static FHoudiniActorBoundsOctree* GetOctree(UWorld* InWorld);
+
+		// Adds or updates an actor in the octree
+		static void UpdateActor(FHoudiniActorBoundsOctree& InOctree, AActor* InActor);
+
+		// Removes an actor from the octree
+		static void RemoveActor(FHoudiniActorBoundsOctree& InOctree, const TWeakObjectPtr<AActor>& InActor);
+
+		// Delegate handlers
+		static void OnActorChanged(AActor* InActor);
+		static void OnActorDeleted(AActor* InActor);
+		static void OnComponentChanged(UActorComponent* InComponent);
+		static void OnComponentRenderStateDirty(UActorComponent& InComponent);
+		static void OnComponentTransformUpdated(USceneComponent* InComponent, EUpdateTransformFlags InFlags, ETeleportType InTeleport);
+		static void OnObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InPropertyChangedEvent);
+#if WITH_EDITOR
+		static void OnObjectTransacted(UObject* InObject, const FTransactionObjectEvent& InTransactionEvent);
+#endif
+		static void OnLevelChanged(ULevel* InLevel, UWorld* InWorld);
+		static void OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources);
+
+		static TMap<TWeakObjectPtr<UWorld>, TUniquePtr<FHoudiniActorBoundsOctree>> Octrees;
+
+		static bool bDelegatesRegistered;
+		static FDelegateHandle OnActorMovedHandle;
+		static FDelegateHandle OnLevelActorAddedHandle;
+		static FDelegateHandle OnLevelActorDeletedHandle;
+		static FDelegateHandle OnObjectPropertyChangedHandle;
+		static FDelegateHandle OnObjectTransactedHandle;
+		static FDelegateHandle OnComponentRenderStateDirtyHandle;
+		static FDelegateHandle OnComponentCreatePhysicsHandle;
+		static FDelegateHandle OnComponentDestroyPhysicsHandle;
+		static FDelegateHandle OnLevelAddedToWorldHandle;
+		static FDelegateHandle OnLevelRemovedFromWorldHandle;
+		static FDelegateHandle OnPostWorldCleanupHandle;
+};
@@ -1675,7 +1675,7 @@ UHoudiniAssetBlueprintComponent::ApplyComponentInstanceData(FHoudiniAssetBluepri
 		bLastCookSuccess = InstanceData->bLastCookSuccess;
 		bHasRegisteredComponentTemplate = InstanceData->bRegisteredComponentTemplate;
 
-		AssetState = InstanceData->AssetState;
+		SetAssetState(InstanceData->AssetState);
 		
 		SetCanDeleteHoudiniNodes(false);
 
@@ -1753,14 +1753,14 @@ UHoudiniAssetBlueprintComponent::OnFullyLoaded()
 		if (!PreviewActor)
 		{
 			bIsInBlueprintEditor = false;
-			AssetState = EHoudiniAssetState::None;
+			SetAssetState(EHoudiniAssetState::None);
 			return;
 		}
 
 		if (OwningActor && PreviewActor != OwningActor)  
 		{
 			bIsInBlueprintEditor = false;
-			AssetState = EHoudiniAssetState::None;
+			SetAssetState(EHoudiniAssetState::None);
 			return;
 		}
 	}
@@ -1781,7 +1781,7 @@ UHoudiniAssetBlueprintComponent::OnFullyLoaded()
 	if (IsTemplate())
 	{	
 		AssetId = -1;
-		AssetState = EHoudiniAssetState::ProcessTemplate;
+		SetAssetState(EHoudiniAssetState::ProcessTemplate);
 	}
 
 	if (IsPreview()) 
@@ -1798,7 +1798,7 @@ UHoudiniAssetBlueprintComponent::OnFullyLoaded()
 		{
 		
 			// The HoudiniAsset has changed, so we need to force the PreviewInstance to re-instantiate
-			AssetState = EHoudiniAssetState::NeedInstantiation;
+			SetAssetState(EHoudiniAssetState::NeedInstantiation);
 			bForceNeedUpdate = true;
 			bHoudiniAssetChanged = false;
 			// TODO: Make this better?
@@ -2050,7 +2050,7 @@ UHoudiniAssetBlueprintComponent::InvalidateData()
 			Input->InvalidateData();
 		}
 
-		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(AssetId, true);
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(AssetId, true, FMath::Max(GetSessionIndex(), 0));
 		AssetId = -1;
 	}
 }
@@ -615,6 +615,7 @@ UHoudiniAssetComponent::UHoudiniAssetComponent(const FObjectInitializer & Object
 	bCookOnAssetInputCook = true;
 
 	AssetId = -1;
+	SessionIndex = -1;
 	AssetState = EHoudiniAssetState::NewHDA;
 	AssetStateResult = EHoudiniAssetStateResult::None;
 	AssetCookCount = 0;
@@ -1278,6 +1279,8 @@ UHoudiniAssetComponent::MarkAsNeedCook()
 	bRecookRequested = true;
 	bRebuildRequested = false;
 
+	MarkAsNeedProcessing();
+
 	//bEditorPropertiesNeedFullUpdate = true;
 
 	// We need to mark all our parameters as changed/trigger update
@@ -1560,6 +1563,7 @@ UHoudiniAssetComponent::PostEditImport()
 
 	AssetState = EHoudiniAssetState::PreInstantiation;
 	AssetStateResult = EHoudiniAssetStateResult::None;
+	MarkAsNeedProcessing();
 	
 	// TODO?
 	// REGISTER?
@@ -2373,7 +2377,11 @@ UHoudiniAssetComponent::SetHasComponentTransformChanged(const bool& InHasChanged
 	// Only update the value if we're fully loaded
 	// This avoid triggering a recook when loading a level
 	if(bFullyLoaded)
+	{
 		bHasComponentTransformChanged = InHasChanged;
+		if (InHasChanged)
+			MarkAsNeedProcessing();
+	}
 }
 
 void UHoudiniAssetComponent::SetOutputNodeIds(const TArray<int32>& OutputNodes)
@@ -2963,9 +2971,21 @@ UHoudiniAssetComponent::SetAssetState(EHoudiniAssetState InNewState)
 	const EHoudiniAssetState OldState = AssetState;
 	AssetState = InNewState;
 
+	// Any state transition needs the manager's attention,
+	// it'll drop us from the active set once we're idle again
+	if (OldState != InNewState)
+		MarkAsNeedProcessing();
+
 	HandleOnHoudiniAssetStateChange(this, OldState, InNewState);
 }
 
+void
+UHoudiniAssetComponent::MarkAsNeedProcessing()
+{
+	if (FHoudiniEngineRuntime::IsInitialized())
+		FHoudiniEngineRuntime::Get().MarkHoudiniComponentAsActive(this);
+}
+
 void
 UHoudiniAssetComponent::HandleOnHoudiniAssetStateChange(UObject* InHoudiniAssetContext, const EHoudiniAssetState InFromState, const EHoudiniAssetState InToState)
 {
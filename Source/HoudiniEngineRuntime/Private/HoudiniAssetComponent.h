@@ -166,6 +166,7 @@ public:
 	FGuid GetHapiGUID() const { return HapiGUID; };
 	FString GetHapiAssetName() const { return HapiAssetName; };
 	FGuid GetComponentGUID() const { return ComponentGUID; };
+	int32 GetSessionIndex() const { return SessionIndex; };
 
 	int32 GetNumInputs() const { return Inputs.Num(); };
 	int32 GetNumOutputs() const { return Outputs.Num(); };
@@ -262,6 +263,8 @@ public:
 	void MarkAsNeedRebuild();
 	// Marks the asset as needing to be instantiated
 	void MarkAsNeedInstantiation();
+	// Adds the component to the manager's active set so it is processed on the next tick
+	void MarkAsNeedProcessing();
 	// The blueprint has been structurally modified
 	void MarkAsBlueprintStructureModified();
 	// The blueprint has been modified but not structurally changed.
@@ -269,6 +272,8 @@ public:
 	
 	//
 	void SetAssetCookCount(const int32& InCount) { AssetCookCount = InCount; };
+	// Pins this component to a pooled Houdini Engine session
+	void SetSessionIndex(const int32& InSessionIndex) { SessionIndex = InSessionIndex; };
 	//
 	void SetRecookRequested(const bool& InRecook) { bRecookRequested = InRecook; };
 	//
@@ -310,6 +315,8 @@ public:
 	//
 	void ClearDownstreamHoudiniAsset() { DownstreamHoudiniAssets.Empty(); };
 	//
+	const TSet<UHoudiniAssetComponent*>& GetDownstreamHoudiniAssets() const { return DownstreamHoudiniAssets; };
+	//
 	bool NotifyCookedToDownstreamAssets();
 	//
 	bool NeedsToWaitForInputHoudiniAssets();
@@ -602,6 +609,10 @@ protected:
 	UPROPERTY(DuplicateTransient)
 	int32 AssetId;
 
+	// Index of the pooled Houdini Engine session our nodes live in (-1 if not pinned yet).
+	UPROPERTY(Transient, DuplicateTransient)
+	int32 SessionIndex;
+
 	// Ids of the nodes that should be cook for this HAC
 	// This is for additional output and templated nodes if they are used.
 	UPROPERTY(Transient, DuplicateTransient)
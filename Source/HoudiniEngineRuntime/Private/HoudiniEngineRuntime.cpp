@@ -29,6 +29,7 @@
 #include "HoudiniRuntimeSettings.h"
 
 #include "HoudiniAssetComponent.h"
+#include "HoudiniActorBoundsIndex.h"
 
 #include "Modules/ModuleManager.h"
 
@@ -40,6 +41,9 @@ DEFINE_LOG_CATEGORY(LogHoudiniEngineRuntime);
 FHoudiniEngineRuntime *
 FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = nullptr;
 
+// Pooled session index used by the calling thread
+static thread_local int32 HoudiniCurrentSessionIndex = 0;
+
 
 FHoudiniEngineRuntime &
 FHoudiniEngineRuntime::Get()
@@ -72,6 +76,8 @@ void FHoudiniEngineRuntime::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FHoudiniActorBoundsIndex::Shutdown();
+
 	FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = nullptr;
 }
 
@@ -172,24 +178,119 @@ FHoudiniEngineRuntime::RegisterHoudiniComponent(UHoudiniAssetComponent* HAC, boo
 	{
 		FScopeLock ScopeLock(&CriticalSection);
 		RegisteredHoudiniComponents.Add(HAC);
+
+		// Newly registered components always need to be processed at least once
+		ActiveHoudiniComponents.Add(HAC);
 	}
 
 	HAC->NotifyHoudiniRegisterCompleted();
 }
 
 
+void
+FHoudiniEngineRuntime::MarkHoudiniComponentAsActive(UHoudiniAssetComponent* HAC)
+{
+	if (!IsInitialized())
+		return;
+
+	if (!IsValid(HAC))
+		return;
+
+	// Only registered components can be processed, transient/CDO or unregistered ones are never cooked
+	FScopeLock ScopeLock(&CriticalSection);
+	if (!IsComponentRegistered(HAC))
+		return;
+
+	ActiveHoudiniComponents.Add(HAC);
+}
+
+
+void
+FHoudiniEngineRuntime::RemoveActiveHoudiniComponent(UHoudiniAssetComponent* HAC)
+{
+	if (!IsInitialized())
+		return;
+
+	FScopeLock ScopeLock(&CriticalSection);
+	ActiveHoudiniComponents.Remove(HAC);
+}
+
+
+int32
+FHoudiniEngineRuntime::GetActiveHoudiniComponentCount()
+{
+	if (!IsInitialized())
+		return 0;
+
+	FScopeLock ScopeLock(&CriticalSection);
+	return ActiveHoudiniComponents.Num();
+}
+
+
+void
+FHoudiniEngineRuntime::GetActiveHoudiniComponents(TArray<UHoudiniAssetComponent*>& OutComponents)
+{
+	if (!IsInitialized())
+		return;
+
+	FScopeLock ScopeLock(&CriticalSection);
+	OutComponents.Reserve(OutComponents.Num() + ActiveHoudiniComponents.Num());
+	for (auto It = ActiveHoudiniComponents.CreateIterator(); It; ++It)
+	{
+		UHoudiniAssetComponent* CurrentHAC = It->Get();
+		if (!IsValid(CurrentHAC) || !IsComponentRegistered(CurrentHAC))
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		OutComponents.Add(CurrentHAC);
+	}
+}
+
+
+int32
+FHoudiniEngineRuntime::GetCurrentSessionIndex()
+{
+	return HoudiniCurrentSessionIndex;
+}
+
+
+void
+FHoudiniEngineRuntime::SetCurrentSessionIndex(const int32& InSessionIndex)
+{
+	HoudiniCurrentSessionIndex = FMath::Max(0, InSessionIndex);
+}
+
+
 void 
-FHoudiniEngineRuntime::MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent)
+FHoudiniEngineRuntime::MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent, const int32& InSessionIndex)
 {
 	if (InNodeId >= 0) 
 	{
 		// FDebug::DumpStackTraceToLog();
 
-		NodeIdsPendingDelete.AddUnique(InNodeId);
+		// Node ids are only unique within a session
+		const int32 SessionIndex = InSessionIndex >= 0 ? InSessionIndex : GetCurrentSessionIndex();
+		bool bAlreadyPending = false;
+		for (int32 Idx = 0; Idx < NodeIdsPendingDelete.Num(); Idx++)
+		{
+			if (NodeIdsPendingDelete[Idx] == InNodeId && NodeIdsPendingDeleteSessionIndices[Idx] == SessionIndex)
+			{
+				bAlreadyPending = true;
+				break;
+			}
+		}
+
+		if (!bAlreadyPending)
+		{
+			NodeIdsPendingDelete.Add(InNodeId);
+			NodeIdsPendingDeleteSessionIndices.Add(SessionIndex);
+		}
 
 		if (bDeleteParent)
 		{
-			NodeIdsParentPendingDelete.AddUnique(InNodeId);
+			NodeIdsParentPendingDelete.AddUnique(TPair<int32, int32>(InNodeId, SessionIndex));
 		}
 	}
 }
@@ -232,10 +333,11 @@ FHoudiniEngineRuntime::UnRegisterHoudiniComponent(const int32& ValidIndex)
 		UHoudiniAssetComponent* HAC = Ptr.Get();
 		if (HAC && HAC->CanDeleteHoudiniNodes())
 		{
-			MarkNodeIdAsPendingDelete(HAC->GetAssetId(), true);
+			MarkNodeIdAsPendingDelete(HAC->GetAssetId(), true, HAC->GetSessionIndex());
 		}
 	}
 	
+	ActiveHoudiniComponents.Remove(Ptr);
 	RegisteredHoudiniComponents.RemoveAt(ValidIndex);
 }
 
@@ -267,6 +369,21 @@ FHoudiniEngineRuntime::GetNodeIdsPendingDeleteAt(const int32& Index)
 }
 
 
+int32
+FHoudiniEngineRuntime::GetNodeIdsPendingDeleteSessionIndexAt(const int32& Index)
+{
+	if (!IsInitialized())
+		return 0;
+
+	FScopeLock ScopeLock(&CriticalSection);
+
+	if (!NodeIdsPendingDeleteSessionIndices.IsValidIndex(Index))
+		return 0;
+
+	return NodeIdsPendingDeleteSessionIndices[Index];
+}
+
+
 void
 FHoudiniEngineRuntime::RemoveNodeIdPendingDeleteAt(const int32& Index)
 {
@@ -278,21 +395,23 @@ FHoudiniEngineRuntime::RemoveNodeIdPendingDeleteAt(const int32& Index)
 		return;
 
 	NodeIdsPendingDelete.RemoveAt(Index);
+	NodeIdsPendingDeleteSessionIndices.RemoveAt(Index);
 }
 
 
 bool 
-FHoudiniEngineRuntime::IsParentNodePendingDelete(const int32& NodeId) 
+FHoudiniEngineRuntime::IsParentNodePendingDelete(const int32& NodeId, const int32& InSessionIndex) 
 {
-	return NodeIdsParentPendingDelete.Contains(NodeId);
+	FScopeLock ScopeLock(&CriticalSection);
+	return NodeIdsParentPendingDelete.Contains(TPair<int32, int32>(NodeId, InSessionIndex));
 }
 
 
 void 
-FHoudiniEngineRuntime::RemoveParentNodePendingDelete(const int32& NodeId) 
+FHoudiniEngineRuntime::RemoveParentNodePendingDelete(const int32& NodeId, const int32& InSessionIndex) 
 {
-	if (NodeIdsParentPendingDelete.Contains(NodeId))
-		NodeIdsParentPendingDelete.Remove(NodeId);
+	FScopeLock ScopeLock(&CriticalSection);
+	NodeIdsParentPendingDelete.Remove(TPair<int32, int32>(NodeId, InSessionIndex));
 }
 
 
@@ -66,19 +66,39 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 		UHoudiniAssetComponent* GetRegisteredHoudiniComponentAt(const int32& Index);
 
 		virtual TArray<TWeakObjectPtr<UHoudiniAssetComponent>>* GetRegisteredHoudiniComponents() { return &RegisteredHoudiniComponents; };
+
+		//
+		// Active Houdini Asset Components
+		//
+		// Components add themselves to the active set on state transitions so the manager
+		// does not have to scan every registered component on each tick
+		void MarkHoudiniComponentAsActive(UHoudiniAssetComponent* HAC);
+		void RemoveActiveHoudiniComponent(UHoudiniAssetComponent* HAC);
+		int32 GetActiveHoudiniComponentCount();
+		// Fills OutComponents with the valid active components, and removes the stale ones from the set
+		void GetActiveHoudiniComponents(TArray<UHoudiniAssetComponent*>& OutComponents);
 		
+		//
+		// Session pool
+		//
+		// Index of the pooled Houdini Engine session used by HAPI calls made on the calling thread (0 is the main session)
+		static int32 GetCurrentSessionIndex();
+		static void SetCurrentSessionIndex(const int32& InSessionIndex);
+
 		//
 		// Node deletion
 		//
-		void MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent = false);
+		// The node is deleted in InSessionIndex, or in the calling thread's current session if INDEX_NONE
+		void MarkNodeIdAsPendingDelete(const int32& InNodeId, bool bDeleteParent = false, const int32& InSessionIndex = INDEX_NONE);
 
 		int32 GetNodeIdsPendingDeleteCount();
 		int32 GetNodeIdsPendingDeleteAt(const int32& Index);
+		int32 GetNodeIdsPendingDeleteSessionIndexAt(const int32& Index);
 		void RemoveNodeIdPendingDeleteAt(const int32& Index);
 
-		bool IsParentNodePendingDelete(const int32& NodeId);
+		bool IsParentNodePendingDelete(const int32& NodeId, const int32& InSessionIndex);
 
-		void RemoveParentNodePendingDelete(const int32& NodeId);
+		void RemoveParentNodePendingDelete(const int32& NodeId, const int32& InSessionIndex);
 
 		//
 		//
@@ -101,7 +121,14 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 		// 
 		TArray<TWeakObjectPtr<UHoudiniAssetComponent>> RegisteredHoudiniComponents;
 
+		// Registered components that need to be processed by the manager
+		TSet<TWeakObjectPtr<UHoudiniAssetComponent>> ActiveHoudiniComponents;
+
 		TArray<int32> NodeIdsPendingDelete;
 
-		TArray<int32> NodeIdsParentPendingDelete;
+		// Session index of each node in NodeIdsPendingDelete
+		TArray<int32> NodeIdsPendingDeleteSessionIndices;
+
+		// Nodes whose parent should be deleted too, with their session index
+		TArray<TPair<int32, int32>> NodeIdsParentPendingDelete;
 };
\ No newline at end of file
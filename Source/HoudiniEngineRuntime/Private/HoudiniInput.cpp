@@ -34,6 +34,7 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniAssetBlueprintComponent.h"
+#include "HoudiniActorBoundsIndex.h"
 
 #include "EngineUtils.h"
 #include "Engine/Brush.h"
@@ -172,7 +173,7 @@ void UHoudiniInput::PostEditUndo()
 				 for (auto & NextNodeId : CreatedDataNodeIds)
 				 {
 					 if (bCanDeleteHoudiniNodes)
-						FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(NextNodeId, true);
+						FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(NextNodeId, true, SessionIndex);
 				 }
 
 				 CreatedDataNodeIds.Empty();
@@ -517,7 +518,14 @@ UHoudiniInput::MarkInputNodeAsPendingDelete()
 	if (InputNodeId < 0)
 		return;
 
-	InputNodesPendingDelete.Add(InputNodeId);
+	// The translator deletes these in the owning component's current session,
+	// nodes created in another session have to be deleted in that one
+	UHoudiniAssetComponent* OuterHAC = Cast<UHoudiniAssetComponent>(GetOuter());
+	if (OuterHAC && FMath::Max(OuterHAC->GetSessionIndex(), 0) != SessionIndex)
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, true, SessionIndex);
+	else
+		InputNodesPendingDelete.Add(InputNodeId);
+
 	InputNodeId = -1;
 }
 
@@ -994,6 +1002,21 @@ UHoudiniInput::CreateNewCurveInputObject(bool& bOutBlueprintStructureModified)
 	return NewCurveInputObject;
 }
 
+void
+UHoudiniInput::MarkChanged(const bool& bInChanged)
+{
+	bHasChanged = bInChanged;
+	SetNeedsToTriggerUpdate(bInChanged);
+
+	// Let our component know it needs to be processed
+	if (bInChanged)
+	{
+		UHoudiniAssetComponent* OuterHAC = GetTypedOuter<UHoudiniAssetComponent>();
+		if (OuterHAC)
+			OuterHAC->MarkAsNeedProcessing();
+	}
+}
+
 void
 UHoudiniInput::MarkAllInputObjectsChanged(const bool& bInChanged)
 {
@@ -1054,6 +1077,9 @@ void UHoudiniInput::CopyStateFrom(UHoudiniInput* InInput, bool bCopyAllPropertie
 
 	AssetNodeId = InInput->AssetNodeId;
 	InputNodeId = InInput->InputNodeId;
+	ConsolidatedInputNodeId = InInput->ConsolidatedInputNodeId;
+	ConsolidatedInputSignature = InInput->ConsolidatedInputSignature;
+	SessionIndex = InInput->SessionIndex;
 	ParmId = InInput->ParmId;
 	bCanDeleteHoudiniNodes = bInCanDeleteHoudiniNodes;
 
@@ -1148,6 +1174,16 @@ void UHoudiniInput::InvalidateData()
 		InputNodeId = -1;
 	}
 
+	// Mark the consolidated world input node for deletion
+	if (ConsolidatedInputNodeId >= 0)
+	{
+		if (bCanDeleteHoudiniNodes)
+			FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(ConsolidatedInputNodeId, true, SessionIndex);
+
+		ConsolidatedInputNodeId = -1;
+		ConsolidatedInputSignature = 0;
+	}
+
 	for(UHoudiniInputObject* InputObject : GeometryInputObjects)
 	{
 		if (!InputObject)
@@ -1197,7 +1233,7 @@ void UHoudiniInput::InvalidateData()
 		auto& HoudiniEngineRuntime = FHoudiniEngineRuntime::Get();
 		for(int32 NodeId : CreatedDataNodeIds)
 		{
-			HoudiniEngineRuntime.MarkNodeIdAsPendingDelete(NodeId, true);
+			HoudiniEngineRuntime.MarkNodeIdAsPendingDelete(NodeId, true, SessionIndex);
 		}
 	}
 	
@@ -2454,10 +2490,33 @@ UHoudiniInput::UpdateWorldSelectionFromBoundSelectors()
 
 	//UWorld* editorWorld = GEditor->GetEditorWorldContext().World();
 	UWorld* MyWorld = GetWorld();
+
+	// Only consider the actors intersecting the selectors, either from the spatial index or from all the world's actors
+	TArray<AActor*> CandidateActors;
+	if (!FHoudiniActorBoundsIndex::FindActorsIntersectingBounds(MyWorld, AllBBox, CandidateActors))
+	{
+		for (TActorIterator<AActor> ActorItr(MyWorld); ActorItr; ++ActorItr)
+		{
+			AActor *CurrentActor = *ActorItr;
+			if (!IsValid(CurrentActor))
+				continue;
+
+			FBox ActorBounds = CurrentActor->GetComponentsBoundingBox(true);
+			for (auto InBounds : AllBBox)
+			{
+				// Check if both actor's bounds intersects
+				if (!ActorBounds.Intersect(InBounds))
+					continue;
+
+				CandidateActors.Add(CurrentActor);
+				break;
+			}
+		}
+	}
+
 	TArray<AActor*> NewSelectedActors;
-	for (TActorIterator<AActor> ActorItr(MyWorld); ActorItr; ++ActorItr)
+	for (AActor* CurrentActor : CandidateActors)
 	{
-		AActor *CurrentActor = *ActorItr;
 		if (!IsValid(CurrentActor))
 			continue;
 
@@ -2482,16 +2541,7 @@ UHoudiniInput::UpdateWorldSelectionFromBoundSelectors()
 				continue;
 		}
 
-		FBox ActorBounds = CurrentActor->GetComponentsBoundingBox(true);
-		for (auto InBounds : AllBBox)
-		{
-			// Check if both actor's bounds intersects
-			if (!ActorBounds.Intersect(InBounds))
-				continue;
-
-			NewSelectedActors.Add(CurrentActor);
-			break;
-		}
+		NewSelectedActors.Add(CurrentActor);
 	}
 	
 	return UpdateWorldSelection(NewSelectedActors);
@@ -100,6 +100,15 @@ public:
 	int32 GetInputIndex() const { return bIsObjectPathParameter ? -1 : InputIndex; };
 	// Return the array containing all the nodes created for this input's data
 	TArray<int32>& GetCreatedDataNodeIds() { return CreatedDataNodeIds; };
+	// Returns the input node containing the merged static mesh components of a consolidated world input
+	int32 GetConsolidatedInputNodeId() const { return ConsolidatedInputNodeId; };
+	// Returns the signature of the components last uploaded to the consolidated input node
+	uint32 GetConsolidatedInputSignature() const { return ConsolidatedInputSignature; };
+	// Returns the index of the pooled session this input's nodes were created in
+	int32 GetSessionIndex() const { return SessionIndex; };
+	// Indicates that this world input's static mesh components are uploaded merged in a single input node.
+	// The merged node only has the first LOD of the meshes, so exporting LODs, sockets or colliders uses one node per component.
+	bool IsWorldInputConsolidated() const { return Type == EHoudiniInputType::World && bConsolidateWorldInput && !bImportAsReference && !bExportLODs && !bExportSockets && !bExportColliders; };
 	// Returns the current input type
 	EHoudiniInputType GetInputType() const { return Type; };
 	// Returns the previous input type
@@ -135,6 +144,7 @@ public:
 	bool GetExportLODs() const				{ return bExportLODs; };
 	bool GetExportSockets() const			{ return bExportSockets; };
 	bool GetExportColliders() const			{ return bExportColliders; };
+	bool GetConsolidateWorldInput() const	{ return bConsolidateWorldInput; };
 	bool IsObjectPathParameter() const		{ return bIsObjectPathParameter; };
 	float GetUnrealSplineResolution() const { return UnrealSplineResolution; };
 	
@@ -220,11 +230,7 @@ public:
 	// Mutators
 	//------------------------------------------------------------------------------------------------
 
-	void MarkChanged(const bool& bInChanged)
-	{
-		bHasChanged = bInChanged;
-		SetNeedsToTriggerUpdate(bInChanged);
-	};
+	void MarkChanged(const bool& bInChanged);
 	void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate) { bNeedsToTriggerUpdate = bInTriggersUpdate; };
 	void MarkDataUploadNeeded(const bool& bInDataUploadNeeded) { bDataUploadNeeded = bInDataUploadNeeded; };
 	void MarkAllInputObjectsChanged(const bool& bInChanged);
@@ -245,7 +251,10 @@ public:
 	void SetExportLODs(const bool& bInExportLODs)					{ bExportLODs = bInExportLODs; };
 	void SetExportSockets(const bool& bInExportSockets)				{ bExportSockets = bInExportSockets; };
 	void SetExportColliders(const bool& bInExportColliders)			{ bExportColliders = bInExportColliders; };
+	void SetConsolidateWorldInput(const bool& bInConsolidate)		{ bConsolidateWorldInput = bInConsolidate; };
 	void SetInputNodeId(const int32& InCreatedNodeId)				{ InputNodeId = InCreatedNodeId; };
+	void SetConsolidatedInputNodeId(const int32& InNodeId, const uint32& InSignature) { ConsolidatedInputNodeId = InNodeId; ConsolidatedInputSignature = InSignature; };
+	void SetSessionIndex(const int32& InSessionIndex)				{ SessionIndex = InSessionIndex; };
 	void SetUnrealSplineResolution(const float& InResolution)		{ UnrealSplineResolution = InResolution; };
 
 	virtual void SetCookOnCurveChange(const bool & bInCookOnCurveChanged)	{ bCookOnCurveChanged = bInCookOnCurveChanged; };
@@ -526,6 +535,23 @@ protected:
 	UPROPERTY()
 	float UnrealSplineResolution;
 
+	// Indicates that the static mesh components of this world input are merged in a single input node
+	// instead of creating one input node per component
+	UPROPERTY()
+	bool bConsolidateWorldInput = false;
+
+	// Input node containing the merged static mesh components when the world input is consolidated
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	int32 ConsolidatedInputNodeId = -1;
+
+	// Signature of the components/transforms/meshes uploaded to the consolidated input node
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	uint32 ConsolidatedInputSignature = 0;
+
+	// Index of the pooled session the input's nodes were created in, so they can be deleted from the game thread
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	int32 SessionIndex = 0;
+
 	//-------------------------------------------------------------------------------------------------------------------------
 	// Skeletal Inputs
 	UPROPERTY()
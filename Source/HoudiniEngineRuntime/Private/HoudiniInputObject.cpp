@@ -62,6 +62,7 @@ UHoudiniInputObject::UHoudiniInputObject(const FObjectInitializer& ObjectInitial
 	, Type(EHoudiniInputObjectType::Invalid)
 	, InputNodeId(-1)
 	, InputObjectNodeId(-1)
+	, SessionIndex(0)
 	, bHasChanged(false)
 	, bNeedsToTriggerUpdate(false)
 	, bTransformChanged(false)
@@ -762,14 +763,14 @@ UHoudiniInputObject::InvalidateData()
 
 	if (InputNodeId >= 0)
 	{
-		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId);
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputNodeId, false, SessionIndex);
 		InputNodeId = -1;
 	}
 
 	// ... and the parent OBJ as well to clean up
 	if (InputObjectNodeId >= 0)
 	{
-		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputObjectNodeId);
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(InputObjectNodeId, false, SessionIndex);
 		InputObjectNodeId = -1;
 	}
 
@@ -1382,6 +1383,45 @@ UHoudiniInputActor::InvalidateData()
 	Super::InvalidateData();
 }
 
+void
+UHoudiniInputLandscape::InvalidateData()
+{
+	// The uploaded volumes are about to be deleted
+	ClearUploadedHeightfieldData();
+
+	Super::InvalidateData();
+}
+
+bool
+UHoudiniInputLandscape::MarkRegionDirty(const FIntRect& InRegion)
+{
+	if (UploadedVolumeNodeIds.Num() > 0)
+	{
+		// Ignore regions that are not part of the uploaded heightfield (ie, other streaming proxies)
+		if (InRegion.Max.X < UploadedExtent.Min.X || InRegion.Min.X > UploadedExtent.Max.X
+			|| InRegion.Max.Y < UploadedExtent.Min.Y || InRegion.Min.Y > UploadedExtent.Max.Y)
+			return false;
+	}
+
+	DirtyRegions.Add(InRegion);
+	return true;
+}
+
+bool
+UHoudiniInputLandscape::CanUploadDirtyRegions() const
+{
+	return DirtyRegions.Num() > 0 && UploadedVolumeNodeIds.Num() > 0 && InputNodeId >= 0;
+}
+
+void
+UHoudiniInputLandscape::ClearUploadedHeightfieldData()
+{
+	DirtyRegions.Empty();
+	UploadedVolumeNodeIds.Empty();
+	UploadedExtent = FIntRect();
+	UploadedLandscapeTransform = FTransform::Identity;
+}
+
 bool UHoudiniInputLandscape::ShouldTrackComponent(UActorComponent* InComponent)
 {
 	// We explicitly disable tracking of any components for landscape inputs since the Landscape tools
@@ -1799,6 +1839,7 @@ UHoudiniInputObject::CopyStateFrom(UHoudiniInputObject* InInput, bool bCopyAllPr
 
 	InputNodeId = InInput->InputNodeId;
 	InputObjectNodeId = InInput->InputObjectNodeId;
+	SessionIndex = InInput->SessionIndex;
 	bHasChanged = InInput->bHasChanged;
 	bNeedsToTriggerUpdate = InInput->bNeedsToTriggerUpdate;
 	bTransformChanged = InInput->bTransformChanged;
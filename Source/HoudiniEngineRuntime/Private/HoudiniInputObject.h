@@ -190,6 +190,10 @@ public:
 	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
 	int32 InputObjectNodeId;
 
+	// Index of the pooled session InputNodeId and InputObjectNodeId were created in
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	int32 SessionIndex;
+
 	// Guid that uniquely identifies this input object.
 	// Also useful to correlate inputs between blueprint component templates and instances.
 	UPROPERTY(DuplicateTransient)
@@ -679,10 +683,34 @@ public:
 
 	void SetLandscapeProxy(UObject* InLandscapeProxy);
 
+	virtual void InvalidateData() override;
+
+	// Marks a region of the landscape (in inclusive landscape vertex coordinates) as modified.
+	// Returns false if the region is outside of the uploaded heightfield.
+	bool MarkRegionDirty(const FIntRect& InRegion);
+
+	// Returns true if the last heightfield upload can be updated by only sending the dirty regions
+	bool CanUploadDirtyRegions() const;
+
+	// Forget the volumes of the last heightfield upload, next upload will resend the whole landscape
+	void ClearUploadedHeightfieldData();
+
 	// Used to restore an input landscape's transform to its original state
 	UPROPERTY()
 	FTransform CachedInputLandscapeTraqnsform;
 
+	// Regions of the landscape (in inclusive landscape vertex coordinates) modified since the last upload
+	TArray<FIntRect> DirtyRegions;
+
+	// Volume node ids of the last heightfield upload, by volume name
+	TMap<FString, int32> UploadedVolumeNodeIds;
+
+	// Landscape extent (in inclusive landscape vertex coordinates) of the last heightfield upload
+	FIntRect UploadedExtent;
+
+	// Landscape transform used to convert the heights of the last heightfield upload
+	FTransform UploadedLandscapeTransform;
+
 protected:
 	virtual bool UsesInputObjectNode() const override { return true; }
 
@@ -425,6 +425,12 @@ struct HOUDINIENGINERUNTIME_API FHoudiniOutputObject
 		// at bake time. 
 		UPROPERTY()
 		TMap<FString, FString> CachedTokens;
+
+		// Stable ids of the instances of an instancer output component, in the component's instance order.
+		// Used to only update the instances that have changed since the previous cook.
+		// Not saved: after a reload, the first cook updates all the instances.
+		UPROPERTY(Transient)
+		TArray<int32> InstanceIds;
 };
 
 
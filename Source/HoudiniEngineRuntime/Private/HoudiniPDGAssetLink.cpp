@@ -58,6 +58,8 @@ UHoudiniPDGAssetLink::UHoudiniPDGAssetLink(const FObjectInitializer& ObjectIniti
 	, bUseTOPOutputFilter(true)
 	, NumWorkitems(0)
 	, WorkItemTally()
+	, NumWorkResultObjectsQueued(0)
+	, NumWorkResultObjectsLoading(0)
 	, OutputCachePath()
 	, bNeedsUIRefresh(false)
 	, OutputParentActor(nullptr)
@@ -172,6 +174,50 @@ FTOPWorkResult::GetWorkResultObjectByArrayIndex(const int32& InArrayIndex)
 	return &ResultObjects[InArrayIndex];
 }
 
+int32
+FTOPWorkResult::IndexOfWorkResultObjectByName(const FString& InName) const
+{
+	// ResultObjects is public and often replaced as a whole, so validate the index against the array
+	bool bRebuilt = false;
+	if (ResultObjectIndexByName.Num() != ResultObjects.Num())
+	{
+		RebuildResultObjectIndex();
+		bRebuilt = true;
+	}
+
+	const int32* FoundIndex = ResultObjectIndexByName.Find(InName);
+	if (FoundIndex && ResultObjects.IsValidIndex(*FoundIndex) && ResultObjects[*FoundIndex].Name == InName)
+		return *FoundIndex;
+
+	if (bRebuilt)
+		return INDEX_NONE;
+
+	// The index is stale (names changed in place), rebuild it and try again
+	RebuildResultObjectIndex();
+	FoundIndex = ResultObjectIndexByName.Find(InName);
+	return FoundIndex ? *FoundIndex : INDEX_NONE;
+}
+
+FTOPWorkResultObject*
+FTOPWorkResult::GetWorkResultObjectByName(const FString& InName)
+{
+	return GetWorkResultObjectByArrayIndex(IndexOfWorkResultObjectByName(InName));
+}
+
+void
+FTOPWorkResult::RebuildResultObjectIndex() const
+{
+	ResultObjectIndexByName.Reset();
+	ResultObjectIndexByName.Reserve(ResultObjects.Num());
+	const int32 NumEntries = ResultObjects.Num();
+	for (int32 Index = 0; Index < NumEntries; ++Index)
+	{
+		// Keep the first entry for duplicate names, like a linear search would
+		if (!ResultObjectIndexByName.Contains(ResultObjects[Index].Name))
+			ResultObjectIndexByName.Add(ResultObjects[Index].Name, Index);
+	}
+}
+
 
 FWorkItemTallyBase::~FWorkItemTallyBase()
 {
@@ -353,6 +399,9 @@ UTOPNode::UTOPNode()
 
 	WorkResultParent = nullptr;
 	WorkResult.SetNum(0);
+	NumIndexedWorkResults = 0;
+	bWorkResultIndexDirty = true;
+	FirstInvalidWorkResultSearchStart = 0;
 
 	bHidden = false;
 	bAutoLoad = false;
@@ -631,17 +680,25 @@ UTOPNode::GetBakedWorkResultObjectOutputs(int32 InWorkResultArrayIndex, int32 In
 int32
 UTOPNode::ArrayIndexOfWorkResultByID(const int32& InWorkItemID) const
 {
-	const int32 NumEntries = WorkResult.Num();
-	for (int32 Index = 0; Index < NumEntries; ++Index)
-	{
-		const FTOPWorkResult& CurResult = WorkResult[Index];
-		if (CurResult.WorkItemID == InWorkItemID)
-		{
-			return Index;
-		}
-	}
+	// Invalid ids are not indexed
+	if (InWorkItemID == INDEX_NONE)
+		return ArrayIndexOfFirstInvalidWorkResult();
 
-	return INDEX_NONE;
+	// Entries added or removed without going through AddWorkResult / RemoveWorkResults invalidate the index
+	if (bWorkResultIndexDirty || NumIndexedWorkResults != WorkResult.Num())
+		RebuildWorkResultIndex();
+
+	const int32* FoundIndex = WorkResultIndexByID.Find(InWorkItemID);
+	if (!FoundIndex)
+		return INDEX_NONE;
+
+	if (WorkResult.IsValidIndex(*FoundIndex) && WorkResult[*FoundIndex].WorkItemID == InWorkItemID)
+		return *FoundIndex;
+
+	// The index is stale, rebuild it and try again
+	RebuildWorkResultIndex();
+	FoundIndex = WorkResultIndexByID.Find(InWorkItemID);
+	return FoundIndex ? *FoundIndex : INDEX_NONE;
 }
 
 FTOPWorkResult*
@@ -657,16 +714,22 @@ UTOPNode::GetWorkResultByID(const int32& InWorkItemID)
 int32
 UTOPNode::ArrayIndexOfFirstInvalidWorkResult() const
 {
+	// Invalid entries are re-used in array index order, so don't search from the start of the array every time
+	if (bWorkResultIndexDirty || NumIndexedWorkResults != WorkResult.Num())
+		RebuildWorkResultIndex();
+
 	const int32 NumEntries = WorkResult.Num();
-	for (int32 Index = 0; Index < NumEntries; ++Index)
+	for (int32 Index = FMath::Max(FirstInvalidWorkResultSearchStart, 0); Index < NumEntries; ++Index)
 	{
 		const FTOPWorkResult& CurResult = WorkResult[Index];
 		if (CurResult.WorkItemID == INDEX_NONE)
 		{
+			FirstInvalidWorkResultSearchStart = Index;
 			return Index;
 		}
 	}
 
+	FirstInvalidWorkResultSearchStart = NumEntries;
 	return INDEX_NONE;
 }
 
@@ -678,6 +741,74 @@ UTOPNode::GetWorkResultByArrayIndex(const int32& InArrayIndex)
 	return &WorkResult[InArrayIndex];
 }
 
+int32
+UTOPNode::AddWorkResult(const FTOPWorkResult& InWorkResult)
+{
+	if (bWorkResultIndexDirty || NumIndexedWorkResults != WorkResult.Num())
+		RebuildWorkResultIndex();
+
+	const int32 Index = WorkResult.Add(InWorkResult);
+	if (InWorkResult.WorkItemID != INDEX_NONE && !WorkResultIndexByID.Contains(InWorkResult.WorkItemID))
+		WorkResultIndexByID.Add(InWorkResult.WorkItemID, Index);
+	NumIndexedWorkResults = WorkResult.Num();
+
+	return Index;
+}
+
+void
+UTOPNode::SetWorkResultID(const int32& InArrayIndex, const int32& InWorkItemID)
+{
+	if (!WorkResult.IsValidIndex(InArrayIndex))
+		return;
+
+	if (bWorkResultIndexDirty || NumIndexedWorkResults != WorkResult.Num())
+		RebuildWorkResultIndex();
+
+	FTOPWorkResult& CurResult = WorkResult[InArrayIndex];
+	if (CurResult.WorkItemID == InWorkItemID)
+		return;
+
+	const int32* PreviousIndex = WorkResultIndexByID.Find(CurResult.WorkItemID);
+	if (PreviousIndex && *PreviousIndex == InArrayIndex)
+		WorkResultIndexByID.Remove(CurResult.WorkItemID);
+
+	CurResult.WorkItemID = InWorkItemID;
+	if (InWorkItemID != INDEX_NONE)
+	{
+		if (!WorkResultIndexByID.Contains(InWorkItemID))
+			WorkResultIndexByID.Add(InWorkItemID, InArrayIndex);
+	}
+	else
+	{
+		FirstInvalidWorkResultSearchStart = FMath::Min(FirstInvalidWorkResultSearchStart, InArrayIndex);
+	}
+}
+
+void
+UTOPNode::InvalidateWorkResultIndex() const
+{
+	bWorkResultIndexDirty = true;
+}
+
+void
+UTOPNode::RebuildWorkResultIndex() const
+{
+	WorkResultIndexByID.Reset();
+	WorkResultIndexByID.Reserve(WorkResult.Num());
+	const int32 NumEntries = WorkResult.Num();
+	for (int32 Index = 0; Index < NumEntries; ++Index)
+	{
+		// Keep the first entry for duplicate ids, like a linear search would
+		const int32 WorkItemID = WorkResult[Index].WorkItemID;
+		if (WorkItemID != INDEX_NONE && !WorkResultIndexByID.Contains(WorkItemID))
+			WorkResultIndexByID.Add(WorkItemID, Index);
+	}
+
+	NumIndexedWorkResults = NumEntries;
+	FirstInvalidWorkResultSearchStart = 0;
+	bWorkResultIndexDirty = false;
+}
+
 bool
 UTOPNode::IsParentTOPNetwork(UTOPNetwork const * const InNetwork) const
 {
@@ -1144,6 +1275,7 @@ UHoudiniPDGAssetLink::ClearTOPNodeWorkItemResults(UTOPNode* TOPNode)
 		CurrentWorkResult.ClearAndDestroyResultObjects(HoudiniComponentGuid);
 	}
 	TOPNode->WorkResult.Empty();
+	TOPNode->InvalidateWorkResultIndex();
 
 	FOutputActorOwner& OutputActorOwner = TOPNode->GetOutputActorOwner();
 	AActor* OutputActor = OutputActorOwner.GetOutputActor();
@@ -1194,14 +1326,14 @@ UHoudiniPDGAssetLink::DestroyWorkItemByID(const int32& InWorkItemID, UTOPNode* I
 	if (!IsValid(InTOPNode))
 		return;
 	
-	// TODO: Update ClearWorkItemResultByID or GetWorkResultByID to return the index of the work item
-	// so that we don't have to find its index again to remove it from the array
 	ClearWorkItemResultByID(InWorkItemID, InTOPNode);
 	// Find the index of the FTOPWorkResult for InWorkItemID in InTOPNode.WorkResult and remove it
-	const int32 Index = InTOPNode->WorkResult.IndexOfByPredicate(
-		[InWorkItemID](const FTOPWorkResult& InWorkItem) { return InWorkItem.WorkItemID == InWorkItemID; });
+	const int32 Index = InTOPNode->ArrayIndexOfWorkResultByID(InWorkItemID);
 	if (Index != INDEX_NONE && Index >= 0)
+	{
 		InTOPNode->WorkResult.RemoveAt(Index);
+		InTOPNode->InvalidateWorkResultIndex();
+	}
 }
 
 FTOPWorkResult*
@@ -190,6 +190,15 @@ public:
 	FTOPWorkResultObject* GetWorkResultObjectByHAPIResultInfoIndex(const int32& InWorkItemResultInfoIndex);
 	// Return the FTOPWorkResultObject at InArrayIndex in the ResultObjects array, or nullptr if InArrayIndex is not a valid index.
 	FTOPWorkResultObject* GetWorkResultObjectByArrayIndex(const int32& InArrayIndex);
+	// Find the FTOPWorkResultObject entry by Name and return its array index or INDEX_NONE, if it could not be found.
+	int32 IndexOfWorkResultObjectByName(const FString& InName) const;
+	// Find the FTOPWorkResultObject entry by Name and return it, or nullptr if it could not be found.
+	FTOPWorkResultObject* GetWorkResultObjectByName(const FString& InName);
+
+protected:
+
+	// Rebuilds ResultObjectIndexByName from ResultObjects
+	void RebuildResultObjectIndex() const;
 
 public:
 
@@ -201,6 +210,13 @@ public:
 	UPROPERTY(NonTransactional)
 	TArray<FTOPWorkResultObject>	ResultObjects;
 
+protected:
+
+	// Transient index of ResultObjects by name, rebuilt when it doesn't match the array anymore
+	mutable TMap<FString, int32>	ResultObjectIndexByName;
+
+public:
+
 	/*
 	UPROPERTY()
 	TArray<UObject*>				ResultObjects;
@@ -480,7 +496,7 @@ public:
 	// Get the FHoudiniPDGWorkResultObjectBakedOutput for a work item (FTOPWorkResult) and specific result object (const version).
 	bool GetBakedWorkResultObjectOutputs(int32 InWorkResultArrayIndex, int32 InWorkResultObjectArrayIndex, FHoudiniPDGWorkResultObjectBakedOutput const*& OutBakedOutput) const;
 
-	// Search for the first FTOPWorkResult entry by WorkItemID and return its array index or INDEX_NONE, if it could not be found.
+	// Find the FTOPWorkResult entry by WorkItemID and return its array index or INDEX_NONE, if it could not be found.
 	int32 ArrayIndexOfWorkResultByID(const int32& InWorkItemID) const;
 	// Search for the first FTOPWorkResult entry by WorkItemID and return it, or nullptr if it could not be found.
 	FTOPWorkResult* GetWorkResultByID(const int32& InWorkItemID);
@@ -490,6 +506,20 @@ public:
 	// Return the FTOPWorkResult at InArrayIndex in the WorkResult array, or nullptr if InArrayIndex is not a valid index.
 	FTOPWorkResult* GetWorkResultByArrayIndex(const int32& InArrayIndex);
 
+	// Adds a FTOPWorkResult to the WorkResult array and the work item id index, returns its array index.
+	int32 AddWorkResult(const FTOPWorkResult& InWorkResult);
+	// Sets the WorkItemID of the FTOPWorkResult at InArrayIndex and updates the work item id index.
+	void SetWorkResultID(const int32& InArrayIndex, const int32& InWorkItemID);
+	// Removes the FTOPWorkResult entries matching InPredicate from the WorkResult array and invalidates the index.
+	template <typename PredicateType>
+	int32 RemoveWorkResults(const PredicateType& InPredicate)
+	{
+		InvalidateWorkResultIndex();
+		return WorkResult.RemoveAll(InPredicate);
+	}
+	// Must be called after modifying the WorkResult array or work item ids directly.
+	void InvalidateWorkResultIndex() const;
+
 	// Returns true if InNetwork is the parent TOP Net of this node.
 	bool IsParentTOPNetwork(UTOPNetwork const * const InNetwork) const;
 
@@ -520,6 +550,23 @@ public:
 	UPROPERTY(NonTransactional)
 	TArray<FTOPWorkResult>	WorkResult;
 
+protected:
+
+	// Rebuilds WorkResultIndexByID from the WorkResult array
+	void RebuildWorkResultIndex() const;
+
+	// Transient index of the WorkResult array by WorkItemID. The ids are transient as well, so the index is simply
+	// rebuilt from the array after loading / duplicating the node.
+	mutable TMap<int32, int32> WorkResultIndexByID;
+	// Number of WorkResult entries when the index was last updated, used to detect direct changes to the array.
+	mutable int32 NumIndexedWorkResults;
+	// True when WorkResultIndexByID needs to be rebuilt
+	mutable bool bWorkResultIndexDirty;
+	// Array index to start the search for the next invalid work result from
+	mutable int32 FirstInvalidWorkResultSearchStart;
+
+public:
+
 	// Hidden in the nodes combobox
 	UPROPERTY()
 	bool					bHidden;
@@ -837,6 +884,13 @@ public:
 	UPROPERTY(Transient, NonTransactional)
 	FAggregatedWorkItemTally		WorkItemTally;
 
+	// Number of work result objects waiting to be loaded (updated by the PDG manager)
+	UPROPERTY(Transient, NonTransactional)
+	int32						NumWorkResultObjectsQueued;
+	// Number of work result objects currently being loaded (updated by the PDG manager)
+	UPROPERTY(Transient, NonTransactional)
+	int32						NumWorkResultObjectsLoading;
+
 	UPROPERTY()
 	FString						OutputCachePath;
 
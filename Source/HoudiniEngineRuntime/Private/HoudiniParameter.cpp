@@ -26,6 +26,8 @@
 
 #include "HoudiniParameter.h"
 
+#include "HoudiniAssetComponent.h"
+
 UHoudiniParameter::UHoudiniParameter(const FObjectInitializer & ObjectInitializer)
 	: Super(ObjectInitializer)
 	, ParmType(EHoudiniParameterType::Invalid)
@@ -73,6 +75,21 @@ UHoudiniParameter::IsChildParameter() const
 	return ParentParmId >= 0;
 }
 
+void
+UHoudiniParameter::MarkChanged(const bool& bInChanged)
+{
+	bHasChanged = bInChanged;
+	SetNeedsToTriggerUpdate(bInChanged);
+
+	// Let our component know it needs to be processed
+	if (bInChanged)
+	{
+		UHoudiniAssetComponent* OuterHAC = GetTypedOuter<UHoudiniAssetComponent>();
+		if (OuterHAC)
+			OuterHAC->MarkAsNeedProcessing();
+	}
+}
+
 void
 UHoudiniParameter::RevertToDefault()
 {
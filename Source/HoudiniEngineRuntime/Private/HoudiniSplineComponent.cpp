@@ -111,6 +111,7 @@ UHoudiniSplineComponent::UHoudiniSplineComponent(const FObjectInitializer & Obje
 	, bIsInputCurve(false)
 	, bIsEditableOutputCurve(false)
 	, NodeId(-1)
+	, SessionIndex(0)
 {
 
 	// Add two default points to the curve
@@ -545,11 +546,18 @@ void UHoudiniSplineComponent::MarkChanged(const bool& Changed)
 	bNeedsToTriggerUpdate = Changed;
 }
 
+void UHoudiniSplineComponent::SetNodeId(const int32& NewNodeId)
+{
+	NodeId = NewNodeId;
+	if (NewNodeId >= 0)
+		SessionIndex = FHoudiniEngineRuntime::GetCurrentSessionIndex();
+}
+
 void UHoudiniSplineComponent::MarkInputNodesAsPendingKill()
 {
 	// InputObject->MarkPendingKill();
 	if(NodeId > -1)
-		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(NodeId);
+		FHoudiniEngineRuntime::Get().MarkNodeIdAsPendingDelete(NodeId, false, SessionIndex);
 
 	SetNodeId(-1); // Set nodeId to invalid for reconstruct on re-do
 }
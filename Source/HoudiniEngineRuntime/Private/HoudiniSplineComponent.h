@@ -138,8 +138,8 @@ class HOUDINIENGINERUNTIME_API UHoudiniSplineComponent : public USceneComponent,
 		FORCEINLINE
 		int32 GetNodeId() const { return NodeId; }
 
-		FORCEINLINE
-		void SetNodeId(const int32& NewNodeId) { NodeId = NewNodeId; }
+		// Also records the calling thread's current session as the one the node lives in
+		void SetNodeId(const int32& NewNodeId);
 
 		FORCEINLINE
 		FString GetGeoPartName() const { return PartName; }
@@ -240,6 +240,10 @@ class HOUDINIENGINERUNTIME_API UHoudiniSplineComponent : public USceneComponent,
 		UPROPERTY(Transient, DuplicateTransient)
 		int32 NodeId;
 
+		// Index of the pooled session NodeId was created in
+		UPROPERTY(Transient, DuplicateTransient)
+		int32 SessionIndex;
+
 		UPROPERTY()
 		FString PartName;
 };